@@ -0,0 +1,363 @@
+/**
+ *  @file       AETGLibrary.cpp
+ *  @brief      C interface of the embeddable generation library
+ *  @author     Mark L. Short
+ *  @date       October 18, 2026
+ */
+
+#include "stdafx.h"
+
+#include <algorithm>
+#include <new>
+#include "GenerationContext.h"
+#include "SuiteVerifier.h"
+
+#include "AETGLibrary.h"
+
+/**
+  @brief  The library side of an AETG_CONTEXT handle
+*/
+struct AETG_CONTEXT
+{
+    CGenerationContext  context;    ///< model, engine, scratch state and results
+    int                 nError;     ///< result code of the last call
+};
+
+/**
+  @brief  Runs a call on a context, so that no exception crosses the interface
+
+  @param [in] pContext       the context
+  @param [in] fnCall         the call, returning AETG_OK or an AETG_E_ code
+
+  @retval int                containing the result code of the call
+*/
+template <typename FN>
+static int Invoke(AETG_CONTEXT* pContext, FN fnCall) noexcept
+{
+    if (pContext == nullptr)
+        return AETG_E_INVALIDARG;
+
+    try
+    {
+        pContext->nError = fnCall(pContext->context);
+    }
+    catch (const std::bad_alloc&)
+    {
+        pContext->nError = AETG_E_NOMEMORY;
+    }
+    catch (...)
+    {
+        pContext->nError = AETG_E_INTERNAL;
+    }
+
+    return pContext->nError;
+}
+
+/**
+  @brief  Converts rows of cells into test cases of a system
+
+  @param [in]  system        target CComponentSystem
+  @param [in]  pCells        the rows, in row major order
+  @param [in]  nNumRows      number of rows
+  @param [out] lstTestSuite  the test cases, as global levels
+
+  @retval true               on success
+  @retval false              if a cell is out of range
+*/
+static bool CellsToTestCases(const CComponentSystem& system, const int* pCells, size_t nNumRows,
+                             std::list<CTestCase>& lstTestSuite)
+{
+    FACTOR_T nNumFactors = system.get_NumFactors( );
+
+    lstTestSuite.clear();
+
+    if ((pCells == nullptr) && (nNumRows > 0))
+        return false;
+
+    for (size_t nRow = 0; nRow < nNumRows; nRow++)
+    {
+        lstTestSuite.emplace_back();
+
+        CTestCase& TestCase = lstTestSuite.back();
+        TestCase.Init(nNumFactors);
+
+        for (FACTOR_T nCurFactor = 0; nCurFactor < nNumFactors; nCurFactor++)
+        {
+            int     iCell     = pCells[nRow * nNumFactors + nCurFactor];
+            LEVEL_T nMinLevel = system.GetMinLevel(nCurFactor);
+
+            if (iCell == AETG_DONT_CARE)
+                continue;
+
+            if ((iCell < 0) || (iCell > system.GetMaxLevel(nCurFactor) - nMinLevel))
+                return false;
+
+            TestCase[nCurFactor] = static_cast<LEVEL_T>(nMinLevel + iCell);
+        }
+    }
+
+    return true;
+}
+
+unsigned int AETG_CALL AETG_GetVersion(void)
+{
+    return AETG_API_VERSION;
+}
+
+AETG_CONTEXT* AETG_CALL AETG_CreateContext(void)
+{
+    AETG_CONTEXT* pResult = nullptr;
+
+    try
+    {
+        pResult = new AETG_CONTEXT;
+        pResult->nError = AETG_OK;
+    }
+    catch (...)
+    {
+        pResult = nullptr;
+    }
+
+    return pResult;
+}
+
+void AETG_CALL AETG_DestroyContext(AETG_CONTEXT* pContext)
+{
+    delete pContext;
+}
+
+int AETG_CALL AETG_SetModel(AETG_CONTEXT* pContext, const unsigned int* pNumLevels,
+                            size_t nNumFactors, unsigned int nT)
+{
+    return Invoke(pContext, [&](CGenerationContext& context)
+        {
+            std::vector<LEVEL_T> rgNumLevels;
+
+            if ((pNumLevels == nullptr) || (nNumFactors == 0) || (nNumFactors >= FACTOR_INVALID))
+                return AETG_E_INVALIDARG;
+
+            for (size_t n = 0; n < nNumFactors; n++)
+            {
+                if (pNumLevels[n] >= LEVEL_INVALID)
+                    return AETG_E_MODEL;
+
+                rgNumLevels.push_back(static_cast<LEVEL_T>(pNumLevels[n]));
+            }
+
+            return context.SetModel(rgNumLevels, static_cast<WORD>(std::min(nT, 0xFFFFu))) ?
+                   AETG_OK : AETG_E_MODEL;
+        });
+}
+
+int AETG_CALL AETG_AddRelation(AETG_CONTEXT* pContext, const unsigned int* pFactors,
+                               size_t nNumFactors, unsigned int nT)
+{
+    return Invoke(pContext, [&](CGenerationContext& context)
+        {
+            if ((pFactors == nullptr) || (nNumFactors == 0))
+                return AETG_E_INVALIDARG;
+
+            std::vector<FACTOR_T> rgFactors;
+
+            for (size_t n = 0; n < nNumFactors; n++)
+                rgFactors.push_back(static_cast<FACTOR_T>(std::min(pFactors[n], 0xFFFFu)));
+
+            return context.AddRelation(rgFactors, static_cast<WORD>(std::min(nT, 0xFFFFu))) ?
+                   AETG_OK : AETG_E_MODEL;
+        });
+}
+
+int AETG_CALL AETG_AddForbiddenTuple(AETG_CONTEXT* pContext, const int* pCells)
+{
+    return Invoke(pContext, [&](CGenerationContext& context)
+        {
+            std::list<CTestCase> lstRow;
+            std::vector<LEVEL_T> rgLevels;
+
+            if (CellsToTestCases(context.get_System(), pCells, 1, lstRow) == false)
+                return AETG_E_INVALIDARG;
+
+            const CTestCase& TestCase = lstRow.front();
+
+            for (size_t nCurFactor = 0; nCurFactor < TestCase.get_Size(); nCurFactor++)
+            {
+                if (IsValidLevel(TestCase[nCurFactor]))
+                    rgLevels.push_back(TestCase[nCurFactor]);
+            }
+
+            return context.AddForbiddenTuple(rgLevels) ? AETG_OK : AETG_E_MODEL;
+        });
+}
+
+int AETG_CALL AETG_SetEngine(AETG_CONTEXT* pContext, const char* szEngine)
+{
+    return Invoke(pContext, [&](CGenerationContext& context)
+        {
+            return context.SetEngine(szEngine) ? AETG_OK : AETG_E_ENGINE;
+        });
+}
+
+int AETG_CALL AETG_SetSeed(AETG_CONTEXT* pContext, unsigned int nSeed)
+{
+    return Invoke(pContext, [&](CGenerationContext& context)
+        {
+            context.SetSeed(nSeed);
+            return AETG_OK;
+        });
+}
+
+int AETG_CALL AETG_Generate(AETG_CONTEXT* pContext, unsigned int nRepetitions, double dBudget)
+{
+    return AETG_Extend(pContext, nullptr, 0, nRepetitions, dBudget);
+}
+
+int AETG_CALL AETG_GenerateRows(AETG_CONTEXT* pContext, AETG_ROW_CALLBACK fnRow, void* pUser,
+                                double dBudget)
+{
+    return Invoke(pContext, [&](CGenerationContext& context)
+        {
+            if (fnRow == nullptr)
+                return AETG_E_INVALIDARG;
+
+            const CComponentSystem& system = context.get_System( );
+            std::vector<int>        rgCells(system.get_NumFactors( ));
+
+            context.SetRowSink([&](const CTestCase& TestCase)
+                {
+                    for (FACTOR_T nCurFactor = 0; nCurFactor < rgCells.size(); nCurFactor++)
+                    {
+                        LEVEL_T nLevel = (nCurFactor < TestCase.get_Size()) ? TestCase[nCurFactor] : LEVEL_INVALID;
+
+                        rgCells[nCurFactor] = IsValidLevel(nLevel) ?
+                                              static_cast<int>(nLevel - system.GetMinLevel(nCurFactor)) :
+                                              AETG_DONT_CARE;
+                    }
+
+                    return fnRow(pUser, rgCells.data(), rgCells.size()) != 0;
+                });
+
+            bool bResult = context.Generate(1, dBudget);
+
+            context.SetRowSink(ROW_SINK());
+
+            if (bResult)
+                return AETG_OK;
+
+            return (system.get_NumFactors() == 0) ? AETG_E_MODEL : AETG_E_BUDGET;
+        });
+}
+
+int AETG_CALL AETG_Extend(AETG_CONTEXT* pContext, const int* pCells, size_t nNumRows,
+                          unsigned int nRepetitions, double dBudget)
+{
+    return Invoke(pContext, [&](CGenerationContext& context)
+        {
+            std::list<CTestCase> lstSeedSuite;
+
+            if (CellsToTestCases(context.get_System(), pCells, nNumRows, lstSeedSuite) == false)
+                return AETG_E_INVALIDARG;
+
+            context.SetSeedSuite(lstSeedSuite);
+
+            bool bResult = context.Generate(nRepetitions, dBudget);
+
+            // the rows extend this call only
+            context.SetSeedSuite(std::list<CTestCase>());
+
+            if (bResult)
+                return AETG_OK;
+
+            return (context.get_System().get_NumFactors() == 0) ? AETG_E_MODEL : AETG_E_BUDGET;
+        });
+}
+
+int AETG_CALL AETG_GetStats(const AETG_CONTEXT* pContext, AETG_STATS* pStats)
+{
+    if ((pContext == nullptr) || (pStats == nullptr))
+        return AETG_E_INVALIDARG;
+
+    const CGenerationContext& context = pContext->context;
+
+    pStats->nNumRows       = context.get_TestSuite().size();
+    pStats->nNumFactors    = context.get_System().get_NumFactors();
+    pStats->nRepetitions   = context.get_Repetitions();
+    pStats->dSeconds       = context.get_Seconds();
+    pStats->nNumUnresolved = context.get_NumUnresolved();
+
+    return AETG_OK;
+}
+
+int AETG_CALL AETG_GetRows(const AETG_CONTEXT* pContext, int* pCells, size_t nNumCells)
+{
+    if (pContext == nullptr)
+        return AETG_E_INVALIDARG;
+
+    const CComponentSystem&     system       = pContext->context.get_System();
+    const std::list<CTestCase>& lstTestSuite = pContext->context.get_TestSuite();
+    FACTOR_T                    nNumFactors  = system.get_NumFactors( );
+
+    if (lstTestSuite.empty())
+        return AETG_OK;
+
+    if (pCells == nullptr)
+        return AETG_E_INVALIDARG;
+
+    if (nNumCells < lstTestSuite.size() * nNumFactors)
+        return AETG_E_BUFFER;
+
+    for (const auto& it : lstTestSuite)
+    {
+        for (FACTOR_T nCurFactor = 0; nCurFactor < nNumFactors; nCurFactor++)
+        {
+            LEVEL_T nLevel = (nCurFactor < it.get_Size()) ? it[nCurFactor] : LEVEL_INVALID;
+
+            *pCells++ = IsValidLevel(nLevel) ? static_cast<int>(nLevel - system.GetMinLevel(nCurFactor))
+                                             : AETG_DONT_CARE;
+        }
+    }
+
+    return AETG_OK;
+}
+
+int AETG_CALL AETG_Verify(AETG_CONTEXT* pContext, const int* pCells, size_t nNumRows,
+                          unsigned int nT, size_t* pnNumTuples, size_t* pnNumMissing)
+{
+    return Invoke(pContext, [&](CGenerationContext& context)
+        {
+            std::list<CTestCase> lstTestSuite;
+            CSuiteVerifier       verifier;
+            size_t               nNumMissing = 0;
+
+            if (CellsToTestCases(context.get_System(), pCells, nNumRows, lstTestSuite) == false)
+                return AETG_E_INVALIDARG;
+
+            if (context.Verify(lstTestSuite, static_cast<WORD>(std::min(nT, 0xFFFFu)), verifier,
+                               nNumMissing) == false)
+                return AETG_E_MODEL;
+
+            if (pnNumTuples)
+                *pnNumTuples = verifier.get_NumTuples();
+
+            if (pnNumMissing)
+                *pnNumMissing = nNumMissing;
+
+            return AETG_OK;
+        });
+}
+
+const char* AETG_CALL AETG_GetLastError(const AETG_CONTEXT* pContext)
+{
+    if (pContext == nullptr)
+        return "null context";
+
+    if (pContext->nError == AETG_E_INVALIDARG)
+        return "invalid argument";
+
+    if (pContext->nError == AETG_E_NOMEMORY)
+        return "out of memory";
+
+    if (pContext->nError == AETG_E_INTERNAL)
+        return "internal error";
+
+    return pContext->context.get_LastError().c_str();
+}
@@ -0,0 +1,270 @@
+/**
+ *  @file       AETGLibrary.h
+ *  @brief      C interface of the embeddable generation library
+ *
+ *  Provides type definitions for: AETG_CONTEXT, AETG_STATS
+ *
+ *  Every call works on a context created by AETG_CreateContext.  Contexts
+ *  share no state, so generations on separate contexts may run on separate
+ *  threads at the same time; a single context is to be used by one thread
+ *  at a time.
+ *
+ *  Test cases cross the interface as rows of int cells, one per factor, in
+ *  row major order.  A cell holds the level within its factor, in the range
+ *  [0 .. levels - 1], or AETG_DONT_CARE.
+ *
+ *  Define AETG_EXPORTS when building the library as a DLL and AETG_DLL when
+ *  using it as one; with neither, the interface is linked in statically.
+ *
+ *  @author     Mark L. Short
+ *  @date       October 18, 2026
+ */
+#pragma once
+
+#if !defined(__AETG_LIBRARY_H__)
+#define __AETG_LIBRARY_H__
+
+#include <stddef.h>
+
+#if defined(_WIN32) && defined(AETG_EXPORTS)
+    #define AETG_API    __declspec(dllexport)
+#elif defined(_WIN32) && defined(AETG_DLL)
+    #define AETG_API    __declspec(dllimport)
+#else
+    #define AETG_API
+#endif
+
+#if defined(_WIN32)
+    #define AETG_CALL   __cdecl
+#else
+    #define AETG_CALL
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/// version of the interface, raised only by incompatible changes
+#define AETG_API_VERSION        2
+
+/// cell of a factor left for generation to assign, or not part of a tuple
+#define AETG_DONT_CARE          (-1)
+
+/// result codes
+#define AETG_OK                 0     ///< success
+#define AETG_E_INVALIDARG       1     ///< a null pointer, or a cell out of range
+#define AETG_E_MODEL            2     ///< invalid levels, strength, relation or forbidden tuple
+#define AETG_E_ENGINE           3     ///< unknown generation engine
+#define AETG_E_BUDGET           4     ///< no complete suite was generated in the time budget
+#define AETG_E_BUFFER           5     ///< the buffer given is too small
+#define AETG_E_NOMEMORY         6     ///< out of memory
+#define AETG_E_INTERNAL         7     ///< an unexpected failure
+
+/// a generation context; its contents are private to the library
+typedef struct AETG_CONTEXT AETG_CONTEXT;
+
+/**
+  @brief  Receives a row of a suite as soon as it is generated
+
+  @param [in] pUser          the pointer given to AETG_GenerateRows
+  @param [in] pCells         the row, one cell per factor
+  @param [in] nNumFactors    number of cells
+
+  @retval int                non-zero to continue, 0 to abandon the generation
+*/
+typedef int (AETG_CALL *AETG_ROW_CALLBACK)(void* pUser, const int* pCells, size_t nNumFactors);
+
+/**
+  @brief  Figures describing the last generation of a context
+*/
+typedef struct AETG_STATS
+{
+    size_t        nNumRows;        ///< rows of the generated suite
+    size_t        nNumFactors;     ///< cells of each row
+    unsigned int  nRepetitions;    ///< suites generated, the smallest kept
+    double        dSeconds;        ///< duration of the generation, in seconds
+    size_t        nNumUnresolved;  ///< tuples neither covered nor shown to be forbidden
+} AETG_STATS;
+
+/**
+  @brief  Returns the version of the interface
+
+  @retval unsigned int       containing AETG_API_VERSION of the library
+*/
+AETG_API unsigned int  AETG_CALL AETG_GetVersion(void);
+
+/**
+  @brief  Creates a generation context
+
+  @retval AETG_CONTEXT*      on success containing the context
+  @retval NULL               if out of memory
+*/
+AETG_API AETG_CONTEXT* AETG_CALL AETG_CreateContext(void);
+
+/**
+  @brief  Destroys a generation context
+
+  @param [in] pContext       the context, or NULL
+*/
+AETG_API void          AETG_CALL AETG_DestroyContext(AETG_CONTEXT* pContext);
+
+/**
+  @brief  Sets the factors, levels and base strength of the model
+
+  Clears the relations and forbidden tuples of any previous model.
+
+  @param [in] pContext       the context
+  @param [in] pNumLevels     number of levels, indexed by factor
+  @param [in] nNumFactors    number of factors
+  @param [in] nT             base interaction strength, [1 .. nNumFactors]
+
+  @retval int                AETG_OK or an AETG_E_ result code
+*/
+AETG_API int           AETG_CALL AETG_SetModel(AETG_CONTEXT* pContext, const unsigned int* pNumLevels,
+                                               size_t nNumFactors, unsigned int nT);
+
+/**
+  @brief  Adds a sub-relation of a higher strength to the model
+
+  @param [in] pContext       the context
+  @param [in] pFactors       factors of the relation
+  @param [in] nNumFactors    number of factors of the relation
+  @param [in] nT             strength of the relation
+
+  @retval int                AETG_OK or an AETG_E_ result code
+*/
+AETG_API int           AETG_CALL AETG_AddRelation(AETG_CONTEXT* pContext, const unsigned int* pFactors,
+                                                  size_t nNumFactors, unsigned int nT);
+
+/**
+  @brief  Forbids a combination of levels from appearing in any test case
+
+  @param [in] pContext       the context
+  @param [in] pCells         one row of cells, AETG_DONT_CARE for the factors
+                             outside of the tuple
+
+  @retval int                AETG_OK or an AETG_E_ result code
+*/
+AETG_API int           AETG_CALL AETG_AddForbiddenTuple(AETG_CONTEXT* pContext, const int* pCells);
+
+/**
+  @brief  Selects the generation engine
+
+  @param [in] pContext       the context
+  @param [in] szEngine       "aetg" (the default), "dda" or "ipog"
+
+  @retval int                AETG_OK or an AETG_E_ result code
+*/
+AETG_API int           AETG_CALL AETG_SetEngine(AETG_CONTEXT* pContext, const char* szEngine);
+
+/**
+  @brief  Fixes the seed of the context's random engine, making generation
+          repeatable
+
+  @param [in] pContext       the context
+  @param [in] nSeed          the seed
+
+  @retval int                AETG_OK or an AETG_E_ result code
+*/
+AETG_API int           AETG_CALL AETG_SetSeed(AETG_CONTEXT* pContext, unsigned int nSeed);
+
+/**
+  @brief  Generates a suite for the model
+
+  @param [in] pContext       the context
+  @param [in] nRepetitions   number of suites to generate, the smallest kept
+  @param [in] dBudget        time budget in seconds, or 0 for none
+
+  @retval int                AETG_OK or an AETG_E_ result code
+*/
+AETG_API int           AETG_CALL AETG_Generate(AETG_CONTEXT* pContext, unsigned int nRepetitions,
+                                               double dBudget);
+
+/**
+  @brief  Generates a suite for the model, handing over each row as soon as
+          it is generated
+
+  The callback runs on the calling thread, between the steps of the
+  generation, so a test runner may start on the first rows before the last
+  are known.  A single suite is generated and left unreduced, the rows
+  retrieved by AETG_GetRows being those handed over.
+
+  @param [in] pContext       the context
+  @param [in] fnRow          receives each row
+  @param [in] pUser          passed through to fnRow
+  @param [in] dBudget        time budget in seconds, or 0 for none
+
+  @retval int                AETG_OK or an AETG_E_ result code, AETG_E_BUDGET
+                             should fnRow abandon the generation
+*/
+AETG_API int           AETG_CALL AETG_GenerateRows(AETG_CONTEXT* pContext, AETG_ROW_CALLBACK fnRow,
+                                                   void* pUser, double dBudget);
+
+/**
+  @brief  Extends existing rows into a suite for the model
+
+  The rows are kept, with their AETG_DONT_CARE cells assigned, and only the
+  rows needed to complete the coverage are added to them.
+
+  @param [in] pContext       the context
+  @param [in] pCells         the rows to extend
+  @param [in] nNumRows       number of rows
+  @param [in] nRepetitions   number of suites to generate, the smallest kept
+  @param [in] dBudget        time budget in seconds, or 0 for none
+
+  @retval int                AETG_OK or an AETG_E_ result code
+*/
+AETG_API int           AETG_CALL AETG_Extend(AETG_CONTEXT* pContext, const int* pCells, size_t nNumRows,
+                                             unsigned int nRepetitions, double dBudget);
+
+/**
+  @brief  Retrieves the figures of the last generation
+
+  @param [in]  pContext      the context
+  @param [out] pStats        the figures
+
+  @retval int                AETG_OK or an AETG_E_ result code
+*/
+AETG_API int           AETG_CALL AETG_GetStats(const AETG_CONTEXT* pContext, AETG_STATS* pStats);
+
+/**
+  @brief  Copies out the generated suite
+
+  @param [in]  pContext      the context
+  @param [out] pCells        receives nNumRows * nNumFactors cells
+  @param [in]  nNumCells     size of pCells, in cells
+
+  @retval int                AETG_OK or an AETG_E_ result code
+*/
+AETG_API int           AETG_CALL AETG_GetRows(const AETG_CONTEXT* pContext, int* pCells, size_t nNumCells);
+
+/**
+  @brief  Verifies the t-way coverage of a suite against the model
+
+  @param [in]  pContext      the context
+  @param [in]  pCells        the rows to verify
+  @param [in]  nNumRows      number of rows
+  @param [in]  nT            strength to verify, or 0 for the model's
+  @param [out] pnNumTuples   number of t-way tuples, or NULL
+  @param [out] pnNumMissing  number of uncovered t-way tuples, or NULL
+
+  @retval int                AETG_OK or an AETG_E_ result code
+*/
+AETG_API int           AETG_CALL AETG_Verify(AETG_CONTEXT* pContext, const int* pCells, size_t nNumRows,
+                                             unsigned int nT, size_t* pnNumTuples, size_t* pnNumMissing);
+
+/**
+  @brief  Returns the reason the last call on a context failed
+
+  @param [in] pContext       the context
+
+  @retval const char*        containing the reason, empty after a success;
+                             valid until the next call on the context
+*/
+AETG_API const char*   AETG_CALL AETG_GetLastError(const AETG_CONTEXT* pContext);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,393 @@
+/**
+ *  @file       AETGTestSuite.cpp
+ *  @brief      CAETGTestSuite class implementation
+ *  @author     Mark L. Short
+ *  @date       October 18, 2026
+ */
+
+#include "stdafx.h"
+
+#include "ComponentSystem.h"
+#include "DebugUtility.h"
+
+#include "AETGTestSuite.h"
+
+/**
+  @brief  Returns the index of the largest level of a sequence
+  
+  @param [in] system         CComponentSystem whose engine breaks ties
+  @param [in] vLevels        target sequence of level values
+
+  @retval LEVEL_T            on success containing the index value 
+  @retval LEVEL_INVALID      on error
+*/
+LEVEL_T FindGreatestOccuringLevel(const CComponentSystem& system, const std::vector<size_t>& vLevels);
+
+size_t
+CAETGTestSuite::GenerateTestCase(const CComponentSystem& system, CTestCase& TestCase)
+{
+    CTestCase Candidate;
+
+    size_t    nBestCoverage = 0;
+    int       iRandomMod    = 2;
+
+    // start with an empty test case, which will not be accepted into the 
+    // suite should none of the candidates cover anything
+    TestCase = CTestCase( );
+
+    for (int j = 0; j < TEST_CASE_CANDIDATES; j++)
+    {
+        size_t nCoverage = GenerateT3TestCaseCandidate(system, Candidate);
+
+        if (nCoverage > nBestCoverage)
+        {
+            nBestCoverage  = nCoverage;
+            TestCase       = Candidate;
+        }
+        else if ((nCoverage == nBestCoverage) && (nCoverage != 0))
+        { // two candidates with the same coverage?
+          // let's randomly decide who will be considered
+          // the best
+            if (system.GetRandomIndex(iRandomMod) == 0)
+            {
+                TestCase   = Candidate;
+                iRandomMod = iRandomMod << 1;
+            }
+        }
+    }
+
+    return nBestCoverage;
+}
+
+LEVEL_T 
+FindGreatestOccuringLevel(const CComponentSystem& system, const std::vector<size_t>& vLevels)
+{
+    LEVEL_T nResult        = LEVEL_INVALID;
+
+    size_t  iMaxLevelCount = 0;
+    int     iNumLevels     = vLevels.size();
+    int     iRandomMod     = 2;
+
+    for (int i = 0; i < iNumLevels; i++)
+    {
+        if (vLevels[i] > iMaxLevelCount)
+        {
+            iMaxLevelCount = vLevels[i];
+            nResult        = i;
+        }
+        else if ((vLevels[i] == iMaxLevelCount) && (vLevels[i] > 0))
+        {   // some level of randomization to mix things up a bit
+            if (system.GetRandomIndex(iRandomMod) == 0)
+            {
+                nResult = i;
+                iRandomMod ++;
+            }
+        }
+    }
+
+    return nResult;
+}
+
+/**
+    In AETG, covering arrays are constructed one row at a time. To generate a 
+    row, the first t-tuple is selected based on the one involved in most uncovered
+    pairs. Remaining factors are assigned levels in a random order. Levels are
+    selected based on the one that covers the most new t-tuples. For each row that 
+    is actually added to the covering array, there are a number, M, candidate rows 
+    that are generated and only a candidate that covers the most new t-tuples is 
+    added to the covering array. Once a covering is constructed, a number, R, of 
+    test suites are generated and the smallest test suite generated is reported. 
+    This process continues until all pairs are covered.
+
+<b> AETG Example 1: </b>
+
+1 begin
+2   set MinArray to ∞
+3   for i ← 1 to R [number of test suites] do
+4       start with no tests in T
+5       N ← ∞
+6       while there are uncovered t-tuples in T do
+7           start with an empty test C and an empty test BestCandidate
+8           for j ← 1 to M [candidate rows] do
+9               select the first pair that appears in the largest number of uncovered pairs
+10              while free factors remain do
+11                  randomly select a factor f
+12                  select a level v that is in the largest number of uncovered pairs with uniform factors
+13              end while
+14              if C covers more t-tuples than BestCandidate then
+15                  BestCandidate ← C
+16              end if
+17          end for
+18          add test BestCandidate to T
+19          N ← N + 1
+20      end while
+21      if T has N < MinArray tests then
+22          MinArray ← N
+23          BestArray ← T
+24      end if
+25  end for
+26 end
+
+<b> AETG Example 2: </b>
+
+1. initialize test set TS to be an empty set
+2. let UC be the set of all t-way combinations to be covered
+3. while (UC is not empty) 
+    {
+4.    let p,v be the parameter value that appears the most number of times in UC
+5.    // generate m candidates
+6.    for (int i = 0; i < m; i++) 
+        {
+7.        let p be the 1st parameter, and reorder all other parameters randomly,
+              denote the reordered parameters as p1, p2, ... pk.
+8.        // select values for each candidate
+9.        for (int j = 1; j <= k; j++) 
+              {
+10.          select a value for the j-th parameter pj such that the most uncovered
+               combinations can be covered
+11.           }
+12.       }
+13. select a test r from m candidates such that it covers the most uncovered combinations
+14. add r into ts and remove from UC the set of combinations covered by r
+15. }
+16. return ts
+
+*/
+size_t 
+CAETGTestSuite::GenerateT2TestCaseCandidate(const CComponentSystem& system, CTestCase& Candidate)
+{
+    size_t   nResult = 0;
+
+    if (m_nNumFactors > 1) // no reason to go further if we don't have at least 2 factors
+    {
+        // initialize the candidate
+        Candidate.Init(m_nNumFactors);
+
+        //  1. Choose a parameter f and a value l for f such that that parameter 
+        //     value appears in the greatest number of uncovered pairs.
+
+        LEVEL_T  nBestLevel  = FindGreatestOccuringLevel(system, m_rgLevelCount);
+        FACTOR_T nCurFactor  = system.GetFactor(nBestLevel);
+        //   DebugTrace (_T("Greatest Occuring (Factor,Level): (%d, %d) \n"), nFactor, nLevel);
+        Candidate[nCurFactor]  = nBestLevel;
+
+        //  2. Let f1 = f. Then choose a random order for the remaining parameters. 
+        //     Then we have an order for all k parameters f1, ... fk.
+
+        std::vector<FACTOR_T> vFactorOrder;
+        //  randomize factor order
+        system.GetShuffledFactors(vFactorOrder);
+
+        const CConstraintSet& constraints  = system.get_Constraints( );
+        bool                  bConstrained = system.HasConstraints( );
+
+        for (size_t i = 0; i < vFactorOrder.size( ); i++)
+        {
+            nCurFactor = vFactorOrder[i];
+            // verify to make sure we have not already included it in our candidate
+            if (IsValidLevel(Candidate[nCurFactor]) == false)
+            {
+                // now we need to determine which of the levels for this factor
+                // will cover the greatest number of uncovered t-tuples
+                LEVEL_T nMinFactorLevel = system.GetMinLevel(nCurFactor);
+                LEVEL_T nMaxFactorLevel = system.GetMaxLevel(nCurFactor);
+
+                nBestLevel = LEVEL_INVALID;
+                size_t nCoverage     = 0;
+                size_t nBestCoverage = 0;
+                int    iRandomMod    = 2;
+
+                // levels completing a forbidden tuple are passed over
+                if (bConstrained)
+                    constraints.GetBlockingMask(Candidate, nCurFactor, m_rgBlocking);
+
+                for (int j = nMinFactorLevel; j <= nMaxFactorLevel; j++)
+                {
+                    if (bConstrained && !constraints.IsFeasible(m_rgBlocking, j))
+                        continue;
+
+                    Candidate[nCurFactor] = j;
+                    nCoverage = CalculateT2TestCaseCoverage(Candidate);
+
+                    if (nCoverage > nBestCoverage)
+                    {
+                        nBestCoverage = nCoverage;
+                        nBestLevel    = j;         // identify the level with the best coverage
+                        nResult       = nCoverage; // return best coverage value to caller
+                    }
+                    else if (nCoverage == nBestCoverage)
+                    {  // let's randomly determine who is going to be considered the highest
+                        if (system.GetRandomIndex(iRandomMod) == 0)
+                        {
+                            nBestLevel = j;
+                            iRandomMod++;
+                        }
+                    }
+                }
+
+                // if we didn't find a level needing to be covered, go
+                // ahead and assign something reasonable for the level
+                if (IsValidLevel(nBestLevel) == false)
+                    nBestLevel = bConstrained ? GetRandomFeasibleLevel(system, nCurFactor) 
+                                              : nMinFactorLevel;
+
+                Candidate[nCurFactor] = nBestLevel;
+            }
+        }
+    }
+
+    return nResult;
+}
+
+LEVEL_T
+CAETGTestSuite::GetRandomFeasibleLevel(const CComponentSystem& system, FACTOR_T nFactor) const
+{
+    LEVEL_T nMinFactorLevel = system.GetMinLevel(nFactor);
+    LEVEL_T nMaxFactorLevel = system.GetMaxLevel(nFactor);
+
+    LEVEL_T nResult = system.GetRandomLevel(nFactor);
+
+    if (system.HasConstraints())
+    {
+        // walk on from the random level to the first feasible one, leaving 
+        // the factor unassigned should there be none
+        LEVEL_T nNumLevels = nMaxFactorLevel - nMinFactorLevel + 1;
+        LEVEL_T nStart     = nResult;
+
+        nResult = LEVEL_INVALID;
+        for (LEVEL_T n = 0; (n < nNumLevels) && !IsValidLevel(nResult); n++)
+        {
+            LEVEL_T nLevel = nMinFactorLevel + (nStart - nMinFactorLevel + n) % nNumLevels;
+
+            if (system.get_Constraints().IsFeasible(m_rgBlocking, nLevel))
+                nResult = nLevel;
+        }
+    }
+
+    return nResult;
+}
+
+size_t 
+CAETGTestSuite::GenerateT3TestCaseCandidate(const CComponentSystem& system, CTestCase& Candidate)
+{
+    size_t   nResult = 0;
+
+    if (m_nNumFactors > 2) // no reason to go further if we don't have at least 3 factors
+    {
+        // initialize the candidate
+        Candidate.Init(m_nNumFactors);
+
+        //  1. Choose a parameter f and a value l for f such that that parameter value appears 
+        //     in the greatest number of uncovered pairs.
+
+        LEVEL_T  nBestLevel = FindGreatestOccuringLevel(system, m_rgLevelCount);
+
+#ifdef _DEBUG
+        if (IsValidLevel(nBestLevel) == false)
+            DebugTrace (_T("*** FindGreatestOccuringLevel - LEVEL_INVALID \n") );
+#endif
+        FACTOR_T nCurFactor = system.GetFactor(nBestLevel);
+
+#ifdef _DEBUG
+//      DebugTrace (_T("  Greatest Occuring (Factor,Level): (%d, %d) \n"), nCurFactor, nBestLevel);
+#endif
+        Candidate[nCurFactor] = nBestLevel;
+
+        //  2. Let f1 = f. Then choose a random order for the remaining parameters. Then we have 
+        //     an order for all k parameters f1, ... fk.
+
+        std::vector<FACTOR_T> vFactorOrder;
+        //  randomize factor order
+        system.GetShuffledFactors(vFactorOrder);
+
+        const CConstraintSet& constraints  = system.get_Constraints( );
+        bool                  bConstrained = system.HasConstraints( );
+
+        for (size_t i = 0; i < vFactorOrder.size(); i++)
+        {
+            nCurFactor = vFactorOrder[i];
+            // verify to make sure we have not already included it in our candidate
+            if (IsValidLevel(Candidate[nCurFactor]) == false)
+            {
+                // now we need to determine which of the levels for this factor
+                // will cover the greatest number of uncovered t-tuples
+                LEVEL_T nMinFactorLevel = system.GetMinLevel(nCurFactor);
+                LEVEL_T nMaxFactorLevel = system.GetMaxLevel(nCurFactor);
+                size_t  nCoverage       = 0;
+                size_t  nBestCoverage   = 0;
+                int     iRandomMod      = 2;
+                nBestLevel     = LEVEL_INVALID;
+
+                // levels completing a forbidden tuple are passed over
+                if (bConstrained)
+                    constraints.GetBlockingMask(Candidate, nCurFactor, m_rgBlocking);
+                // Check to see if the Candidate has t-1 number of valid factors assigned
+                if (Candidate.GetNumValidFactors() + 1 < m_nT)
+                {  // no?
+                   // then just iterate over the min..max levels for the factor
+                   // and assign the one that has the highest level count
+                    
+                    for (int n = nMinFactorLevel; n <= nMaxFactorLevel; n++)
+                    {
+                        if (bConstrained && !constraints.IsFeasible(m_rgBlocking, n))
+                            continue;
+
+                        if (m_rgLevelCount[n] > nBestCoverage)
+                        {
+                            nBestLevel    = n;
+                            nBestCoverage = m_rgLevelCount[nBestLevel];
+                        }
+                        else if ((m_rgLevelCount[n] == nBestCoverage) && (nBestCoverage > 0))
+                        {// let's randomly determine who is going to be considered the highest
+                            if (system.GetRandomIndex(iRandomMod) == 0)
+                            {
+                                nBestLevel = n;
+                                iRandomMod++;
+                            }
+                        }
+                    }
+                    if (IsValidLevel(nBestLevel) == false)
+                        nBestLevel = GetRandomFeasibleLevel(system, nCurFactor);
+
+                    Candidate[nCurFactor] = nBestLevel;
+                }
+                else
+                {
+                    for (int j = nMinFactorLevel; j <= nMaxFactorLevel; j++)
+                    {
+                        if (bConstrained && !constraints.IsFeasible(m_rgBlocking, j))
+                            continue;
+
+                        Candidate[nCurFactor] = j;
+
+                        nCoverage = CalculateT3TestCaseCoverage(Candidate);
+
+                        if (nCoverage > nBestCoverage)
+                        {
+                            nBestCoverage = nCoverage;
+                            nBestLevel    = j;         // identify the level with the best coverage
+                            nResult       = nCoverage; // return best coverage value to caller
+                        }
+                        else if ((nCoverage == nBestCoverage) && (nCoverage > 0))
+                        {  // let's randomly determine who is going to be considered the highest
+                            if (system.GetRandomIndex(iRandomMod) == 0)
+                            {
+                                nBestLevel = j;
+                                iRandomMod++;
+                            }
+                        }
+                    }
+                }
+
+                // if we didn't find a level needing to be covered, go
+                // ahead and assign something reasonable for the level
+                if (IsValidLevel(nBestLevel) == false)
+                    nBestLevel = GetRandomFeasibleLevel(system, nCurFactor);
+
+                Candidate[nCurFactor] = nBestLevel;
+            }
+        }
+    }
+
+    return nResult;
+}
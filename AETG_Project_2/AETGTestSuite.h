@@ -0,0 +1,99 @@
+/**
+ *  @file       AETGTestSuite.h
+ *  @brief      CAETGTestSuite class interface
+ *
+ *  Provides type definitions for: CAETGTestSuite
+ *
+ *  @author     Mark L. Short
+ *  @date       October 18, 2026
+ */
+
+#pragma once
+
+#if !defined(__AETG_TEST_SUITE_H__)
+#define __AETG_TEST_SUITE_H__
+
+#ifndef __TEST_SUITE_H__
+    #include "TestSuite.h"
+#endif
+
+/**
+  @brief  AETG test case generation engine
+
+  Each test case is chosen as the best of TEST_CASE_CANDIDATES randomized 
+  greedy candidates, as described by Cohen, Dalal, Fredman and Patton.
+*/
+class CAETGTestSuite : public CTestSuite
+{
+    std::vector<QWORD>  m_rgBlocking;   ///< forbidden tuple mask of the factor being assigned
+
+public:
+    /// Default Constructor
+    CAETGTestSuite( ) noexcept
+        : CTestSuite()
+    { };
+
+    /// Default Destructor
+    virtual ~CAETGTestSuite( ) = default;
+
+/**
+  @brief  Generates the next test case to be added to the suite
+
+  TEST_CASE_CANDIDATES candidates are generated, the one covering the greatest
+  number of uncovered tuples is selected, with ties being randomly broken.
+
+  @param [in]   system       CComponentSystem object, containing the inputs
+  @param [out]  TestCase     the resultant CTestCase object
+
+  @retval size_t             containing the number of uncovered 3-way tuples
+                             covered by the test case
+*/
+    virtual size_t GenerateTestCase(const CComponentSystem& system, CTestCase& TestCase) override;
+
+/**
+  @brief  Returns the short name of the engine
+
+  @retval const char*        "aetg"
+*/
+    virtual const char* GetEngineName(void) const noexcept override
+    { return "aetg"; };
+
+/**
+  @brief  Generates a 2-way test case candidate
+
+  Under constraints, levels completing a forbidden tuple are passed over.
+
+  @param [in]   system       CComponentSystem object, containing the inputs
+  @param [out]  Candidate    the resultant CTestCase object
+
+  @retval size_t             containing the candidate coverage value
+*/
+    size_t GenerateT2TestCaseCandidate(const CComponentSystem& system, CTestCase& Candidate);
+
+/**
+  @brief  Generates a 3-way test case candidate
+
+  @param [in]   system       CComponentSystem object, containing the inputs
+  @param [out]  Candidate    the resultant CTestCase object
+
+  @retval size_t             containing the candidate coverage value
+*/
+    size_t GenerateT3TestCaseCandidate(const CComponentSystem& system, CTestCase& Candidate);
+
+protected:
+/**
+  @brief  Picks a random level of a factor which completes no forbidden tuple
+
+  The forbidden tuple mask of the factor is expected to be current in 
+  m_rgBlocking.
+
+  @param [in]   system       CComponentSystem object, containing the inputs
+  @param [in]   nFactor      factor to pick a level for
+
+  @retval LEVEL_T            containing the level, or LEVEL_INVALID should 
+                             every level of the factor be infeasible
+*/
+    LEVEL_T GetRandomFeasibleLevel(const CComponentSystem& system, FACTOR_T nFactor) const;
+};
+
+#endif
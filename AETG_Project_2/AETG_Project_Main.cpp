@@ -116,20 +116,28 @@
 
 #include "DebugUtility.h"
 #include "ComponentSystem.h"
-#include "TestSuite.h"
+#include "SuiteAnnealer.h"
+#include "SuiteWriter.h"
+#include "BinarySuite.h"
+#include "SuiteVerifier.h"
+#include "SuiteReader.h"
+#include "SuiteReorderer.h"
+#include "SuiteCache.h"
+#include "GenerationContext.h"
+#include "GenerationService.h"
+#include "ServiceHost.h"
+#include "BatchGenerator.h"
+#include "ProcessGenerator.h"
+#include "Checkpoint.h"
 
 #include <chrono>
-#include <ostream>
+#include <filesystem>
 #include <fstream>
 #include <sstream>
 
 #if defined(UNICODE) || defined(_UNICODE)
-    #define tostream       std::wostream
-    #define tofstream      std::wofstream
     #define tstringstream  std::wstringstream
 #else
-    #define tostream       std::ostream
-    #define tofstream      std::ofstream
     #define tstringstream  std::stringstream
 #endif
 
@@ -151,47 +159,671 @@ typedef std::chrono::duration<double>                       TIME_DURATION;
 /// Global const specifying the number of repetitions
 constexpr const int     NUM_REPETITIONS = 100;
 
-/// Global component system object
-CComponentSystem        g_System;
-/// Global test suite object
-CTestSuite              g_TestSuite;
+/// Global const specifying the default seconds between checkpoints
+constexpr const double  DEFAULT_CHECKPOINT_INTERVAL = 60.0;
 
 
+/**
+    @brief Calculates the coverage curve of a test suite
+
+    @param [in]  system     CComponentSystem the suite was generated for
+    @param [in]  lstSuite   the test cases
+    @param [out] rgCurve    number of t-way tuples first covered by each row
+*/
+void CalcCoverageCurve(const CComponentSystem& system, const std::list<CTestCase>& lstSuite,
+                       std::vector<size_t>& rgCurve)
+{
+    CCoverageMap        bmpUncovered;
+    std::vector<size_t> rgLevelCount;
+
+    rgCurve.clear();
+
+    if (bmpUncovered.Init(system, system.get_Strength()))
+    {
+        bmpUncovered.Fill(rgLevelCount);
+
+        for (auto& it : lstSuite)
+            rgCurve.push_back(bmpUncovered.Cover(it, rgLevelCount));
+    }
+}
+
+/**
+    @brief Selects the test suite generation engine from the command line
+
+    The engine is selected with <b>-engine aetg</b> (default), 
+    <b>-engine dda</b> for the density-based algorithm or <b>-engine ipog</b> 
+    for the in-parameter-order algorithm.
+
+    @param [in] argc        number of command line arguments
+    @param [in] argv        command line arguments
+
+    @retval std::unique_ptr the selected generation engine
+*/
+std::unique_ptr<CTestSuite> SelectTestSuite(int argc, _TCHAR* argv[])
+{
+    std::unique_ptr<CTestSuite> pResult;
+
+    for (int i = 1; i < argc - 1; i++)
+    {
+        if (_tcscmp(argv[i], _T("-engine")) == 0)
+        {
+            // engine names are plain ASCII
+            std::string strEngine;
+
+            for (const TCHAR* p = argv[i + 1]; *p; p++)
+                strEngine += static_cast<char>(*p);
+
+            std::unique_ptr<CTestSuite> pEngine = CGenerationContext::CreateTestSuite(strEngine.c_str());
+
+            if (pEngine)
+                pResult = std::move(pEngine);
+        }
+    }
+
+    if (pResult == nullptr)
+        pResult = CGenerationContext::CreateTestSuite(nullptr);
+
+    return pResult;
+}
+
+/**
+    @brief Tests whether a command line option is present
+
+    @param [in] argc        number of command line arguments
+    @param [in] argv        command line arguments
+    @param [in] szOption    target option, e.g. <b>-noreduce</b>
+
+    @retval true            if the option is present
+    @retval false           otherwise
+*/
+bool IsOptionSet(int argc, _TCHAR* argv[], const TCHAR* szOption)
+{
+    for (int i = 1; i < argc; i++)
+    {
+        if (_tcscmp(argv[i], szOption) == 0)
+            return true;
+    }
+
+    return false;
+}
+
+/**
+    @brief Retrieves the numeric value following a command line option
+
+    @param [in] argc        number of command line arguments
+    @param [in] argv        command line arguments
+    @param [in] szOption    target option, e.g. <b>-anneal</b>
+    @param [in] dDefault    value returned when the option is absent
+
+    @retval double          containing the option value
+*/
+double GetOptionValue(int argc, _TCHAR* argv[], const TCHAR* szOption, double dDefault)
+{
+    for (int i = 1; i < argc - 1; i++)
+    {
+        if (_tcscmp(argv[i], szOption) == 0)
+            return _tstof(argv[i + 1]);
+    }
+
+    return dDefault;
+}
+
+/**
+    @brief Retrieves the string following a command line option
+
+    @param [in] argc        number of command line arguments
+    @param [in] argv        command line arguments
+    @param [in] szOption    target option, e.g. <b>-out</b>
+    @param [in] szDefault   value returned when the option is absent
+
+    @retval const TCHAR*    containing the option value
+*/
+const TCHAR* GetOptionString(int argc, _TCHAR* argv[], const TCHAR* szOption, 
+                             const TCHAR* szDefault)
+{
+    for (int i = 1; i < argc - 1; i++)
+    {
+        if (_tcscmp(argv[i], szOption) == 0)
+            return argv[i + 1];
+    }
+
+    return szDefault;
+}
 
 /**
-    @brief Outputs test suite to an ostream
+    @brief Parses a comma separated list of level counts, e.g. <b>2,2,12</b>
 
-    @param [in,out] os      reference to an ostream
-    @param [in] testSuite   target
+    @param [in]  szList      the list, a single count applying to every factor
+    @param [out] rgNumLevels the level counts, empty for an empty list
 
-    @retval tostream
+    @retval true            on success
+    @retval false           if a count is not a positive number
 */
-tostream& OutputTestSuite(tostream& os, const CTestSuite& testSuite)
+bool ParseLevelCounts(const TCHAR* szList, std::vector<LEVEL_T>& rgNumLevels)
 {
-    os << testSuite.get_TestSuiteSize() << std::endl << std::endl;
+    rgNumLevels.clear( );
+
+    for (const TCHAR* p = szList; *p; )
+    {
+        TCHAR* pEnd   = nullptr;
+        long   nValue = _tcstol(p, &pEnd, 10);
+
+        if ((pEnd == p) || (nValue <= 0) || (nValue >= LEVEL_INVALID))
+            return false;
+
+        rgNumLevels.push_back(static_cast<LEVEL_T>(nValue));
+
+        p = pEnd;
+        if (*p == _T(','))
+            p++;
+        else if (*p)
+            return false;
+    }
+
+    return true;
+}
+
+/**
+    @brief Parses a sub-relation of a variable-strength system, e.g. 
+           <b>4:0,1,2,3</b> for 4-way coverage of the first four factors
+
+    @param [in]  szRelation  the strength, a colon and the factors
+    @param [out] relation    the parsed sub-relation
+
+    @retval true            on success
+    @retval false           if the sub-relation is malformed
+*/
+bool ParseRelation(const TCHAR* szRelation, STRENGTH_RELATION& relation)
+{
+    TCHAR* pEnd = nullptr;
+    long   nT   = _tcstol(szRelation, &pEnd, 10);
+
+    if ((pEnd == szRelation) || (*pEnd != _T(':')) || (nT <= 0) || (nT > MAX_T_WAY))
+        return false;
+
+    relation.nT = static_cast<WORD>(nT);
+    relation.rgFactors.clear( );
+
+    for (const TCHAR* p = pEnd + 1; *p; )
+    {
+        long nFactor = _tcstol(p, &pEnd, 10);
+
+        if ((pEnd == p) || (nFactor < 0) || (nFactor >= FACTOR_INVALID))
+            return false;
+
+        relation.rgFactors.push_back(static_cast<FACTOR_T>(nFactor));
+
+        p = pEnd;
+        if (*p == _T(','))
+            p++;
+        else if (*p)
+            return false;
+    }
+
+    return relation.rgFactors.empty( ) == false;
+}
+
+/**
+    @brief Selects the test suite output format from the command line
+
+    The format is selected with <b>-format text</b> (default), 
+    <b>-format csv</b> or <b>-format tsv</b>.  The binary format, 
+    <b>-format bin</b>, is not written by CSuiteWriter and is handled 
+    separately.
+
+    @param [in] argc        number of command line arguments
+    @param [in] argv        command line arguments
+
+    @retval SUITE_FORMAT    the selected output format
+*/
+SUITE_FORMAT SelectSuiteFormat(int argc, _TCHAR* argv[])
+{
+    SUITE_FORMAT eResult  = SUITE_FORMAT::TEXT;
+    const TCHAR* szFormat = GetOptionString(argc, argv, _T("-format"), _T("text"));
+
+    if (_tcscmp(szFormat, _T("csv")) == 0)
+        eResult = SUITE_FORMAT::CSV;
+    else if (_tcscmp(szFormat, _T("tsv")) == 0)
+        eResult = SUITE_FORMAT::TSV;
+
+    return eResult;
+}
+
+/**
+    @brief Verifies the t-way coverage of an existing suite file
+
+    Invoked with <b>-verify path</b>, optionally followed by <b>-t n</b> 
+    (default 3) and, for text suites, <b>-levels v</b> or <b>-levels v1,v2,..</b> (default inferred).
+    With <b>-constraints path</b>, tuples containing a forbidden tuple are 
+    not counted.  The coverage percentage and the lowest ranked missing 
+    tuples are reported.
+
+    @param [in] argc        number of command line arguments
+    @param [in] argv        command line arguments
+    @param [in] szPath      path of the suite file
+
+    @retval int             0 if the suite provides full coverage, 1 if tuples 
+                            are missing, 2 on error
+*/
+int VerifySuite(int argc, _TCHAR* argv[], const TCHAR* szPath)
+{
+    /// maximum number of missing tuples listed
+    constexpr const size_t MAX_REPORTED = 20;
+
+    CSuiteVerifier             verifier;
+    std::vector<MISSING_TUPLE> rgMissing;
+
+    WORD    nT         = static_cast<WORD>   (GetOptionValue(argc, argv, _T("-t"), T_WAY));
+    std::vector<LEVEL_T> rgTextLevels;
+    std::vector<std::vector<LEVEL_T>> rgForbidden;
+    const TCHAR* szConstr = GetOptionString(argc, argv, _T("-constraints"), nullptr);
+
+    TIME_POINT tpStart = std::chrono::system_clock::now( );
+
+    if ((ParseLevelCounts(GetOptionString(argc, argv, _T("-levels"), _T("")), rgTextLevels) == false) ||
+        (verifier.Load(szPath, rgTextLevels) == false))
+    {
+        tcerr << _T("unable to load ") << szPath << std::endl;
+        return 2;
+    }
+
+    if (szConstr && 
+        ((ReadForbiddenTuples(szConstr, rgForbidden) == false) || 
+         (verifier.SetForbiddenTuples(rgForbidden) == false)))
+    {
+        tcerr << _T("unable to load ") << szConstr << std::endl;
+        return 2;
+    }
+
+    size_t nMissing = verifier.Verify(nT, MAX_REPORTED, rgMissing);
+
+    if (verifier.get_NumTuples() == 0)
+    {
+        tcerr << _T("t must be in [1..") << MAX_T_WAY << _T("] and no more than k") << std::endl;
+        return 2;
+    }
+
+    TIME_DURATION durElapsed = std::chrono::system_clock::now( ) - tpStart;
+
+    tcout << _T("Rows: ")     << verifier.get_NumRows()    
+          << _T(" Factors: ") << verifier.get_NumFactors() 
+          << _T(" t: ")       << nT << std::endl;
+    tcout << _T("Tuples: ")   << verifier.get_NumTuples()  
+          << _T(" Missing: ") << nMissing;
+    if (verifier.get_NumExcluded() > 0)
+        tcout << _T(" Forbidden: ") << verifier.get_NumExcluded();
+    tcout << std::endl;
+    tcout << _T("Coverage: ") << std::fixed << std::setprecision(4) 
+          << verifier.get_CoveragePercent() << _T("%") << std::endl;
+
+    for (auto& it : rgMissing)
+    {
+        tcout << _T("  missing (");
+        for (WORD i = 0; i < nT; i++)
+            tcout << _T(" f") << it.rgColumns[i] << _T("=") << it.rgLevels[i];
+        tcout << _T(" )") << std::endl;
+    }
+
+    if (nMissing > rgMissing.size())
+        tcout << _T("  ... ") << (nMissing - rgMissing.size()) << _T(" more") << std::endl;
+
+    tcout << _T("Verified in ") << durElapsed.count() << _T("s") << std::endl;
+
+    return (nMissing == 0) ? 0 : 1;
+}
+
+/**
+    @brief Runs as a long running generation service
+
+    Invoked with <b>-serve endpoint</b>, a named pipe on Windows or a Unix
+    domain socket elsewhere, optionally followed by <b>-cache dir</b>, 
+    <b>-cachesize MB</b> and <b>-budget seconds</b>, the default and 
+    largest time budget of a request.  Requests are served until one asks 
+    for a shutdown; the protocol is described with CGenerationService.
+
+    @param [in] argc        number of command line arguments
+    @param [in] argv        command line arguments
+    @param [in] szEndpoint  the pipe name or socket path
+
+    @retval int             0 once shut down, 2 on error
+*/
+int ServeRequests(int argc, _TCHAR* argv[], const TCHAR* szEndpoint)
+{
+    CGenerationService service;
+
+    double dCacheMB = GetOptionValue(argc, argv, _T("-cachesize"), 
+                                     static_cast<double>(DEFAULT_CACHE_CAPACITY >> 20));
+
+    if (service.Init(GetOptionString(argc, argv, _T("-cache"), nullptr), 
+                     static_cast<QWORD>(dCacheMB * 1024 * 1024),
+                     GetOptionValue(argc, argv, _T("-budget"), DEFAULT_SERVICE_BUDGET)) == false)
+    {
+        tcerr << _T("unable to open cache ") << GetOptionString(argc, argv, _T("-cache"), _T("")) << std::endl;
+        return 2;
+    }
+
+    tcout << _T("Serving requests on ") << szEndpoint << std::endl;
+
+    int iResult = RunServiceHost(szEndpoint, 
+                                 [&service](const std::string& strRequest, std::string& strResponse)
+                                 { return service.HandleRequest(strRequest, strResponse); });
+
+    if (iResult == 3)
+        tcerr << _T("a service is already running on ") << szEndpoint << std::endl;
+    else if (iResult != 0)
+        tcerr << _T("unable to serve on ") << szEndpoint << std::endl;
+
+    return (iResult == 0) ? 0 : 2;
+}
+
+/**
+    @brief Reads the models of a batch file
+
+    Each line holds a model as <b>k levels [t] [engine]</b>, the levels a 
+    single count or one count per factor, e.g. <b>10 6</b>, 
+    <b>3 2,2,12 2</b> or <b>40 4 3 ipog</b>.  Blank lines and text following 
+    a <b>#</b> are ignored.
+
+    @param [in]  szPath      path of the batch file
+    @param [in]  modelDefault strength, engine and repetitions of a line 
+                             that does not give its own
+    @param [out] rgModels    the models, in order of the file
+
+    @retval true            on success
+    @retval false           if the file cannot be read or a line is malformed
+*/
+bool ReadBatchModels(const TCHAR* szPath, const BATCH_MODEL& modelDefault, 
+                     std::vector<BATCH_MODEL>& rgModels)
+{
+    std::ifstream ifs(szPath);
+    std::string   strLine;
+    size_t        nLine = 0;
+
+    rgModels.clear( );
+
+    if (!ifs)
+        return false;
+
+    while (std::getline(ifs, strLine))
+    {
+        nLine++;
+        strLine = strLine.substr(0, strLine.find('#'));
+
+        std::istringstream iss(strLine);
+        std::string        strFactors;
+        std::string        strLevels;
+        BATCH_MODEL        model = modelDefault;
+
+        if (!(iss >> strFactors))
+            continue;
+
+        // level lists are plain ASCII
+        tstring strTLevels;
+        int     iFactors = atoi(strFactors.c_str());
+
+        if (iss >> strLevels)
+            strTLevels.assign(strLevels.begin(), strLevels.end());
+
+        if ((iFactors <= 0) || (ParseLevelCounts(strTLevels.c_str(), model.rgNumLevels) == false) ||
+            model.rgNumLevels.empty() || 
+            ((model.rgNumLevels.size() > 1) && (model.rgNumLevels.size() != static_cast<size_t>(iFactors))))
+        {
+            tcerr << szPath << _T("(") << nLine << _T("): expected k and a level count or one per factor") 
+                  << std::endl;
+            return false;
+        }
+
+        if (model.rgNumLevels.size() == 1)
+            model.rgNumLevels.assign(iFactors, model.rgNumLevels[0]);
+
+        int iT = 0;
+
+        if ((iss >> iT) && (iT > 0))
+            model.nT = static_cast<WORD>(iT);
+
+        iss.clear();
+        iss >> model.strEngine;
+
+        rgModels.push_back(model);
+    }
+
+    return true;
+}
+
+/**
+    @brief Generates suites for every model of a batch file
+
+    Invoked with <b>-batch path</b>, a file read by ReadBatchModels, 
+    optionally followed by <b>-t n</b>, <b>-engine name</b> and 
+    <b>-repetitions n</b> (default 100) for lines that do not give their own,
+    <b>-threads n</b> (default one per hardware thread), <b>-format</b> and
+    <b>-out dir</b> (default <b>Data\</b>).  The models and their 
+    repetitions share one work-stealing pool, and each suite is written, and
+    its figures reported, as soon as its model is done.
+
+    @param [in] argc        number of command line arguments
+    @param [in] argv        command line arguments
+    @param [in] szPath      path of the batch file
+
+    @retval int             0 on success, 1 if a model failed, 2 on error
+*/
+int RunBatch(int argc, _TCHAR* argv[], const TCHAR* szPath)
+{
+    BATCH_MODEL              modelDefault;
+    std::vector<BATCH_MODEL> rgModels;
+    CBatchGenerator          batch;
+    CSuiteWriter             writer;
+    size_t                   nNumDone   = 0;
+    size_t                   nNumFailed = 0;
+
+    SUITE_FORMAT eFormat  = SelectSuiteFormat(argc, argv);
+    bool         bBinary  = (_tcscmp(GetOptionString(argc, argv, _T("-format"), _T("")), _T("bin")) == 0);
+    const TCHAR* szEngine = GetOptionString(argc, argv, _T("-engine"), _T("aetg"));
+
+    modelDefault.nT           = static_cast<WORD> (GetOptionValue(argc, argv, _T("-t"), T_WAY));
+    modelDefault.nRepetitions = static_cast<DWORD>(GetOptionValue(argc, argv, _T("-repetitions"), NUM_REPETITIONS));
+
+    // engine names are plain ASCII
+    for (const TCHAR* p = szEngine; *p; p++)
+        modelDefault.strEngine += static_cast<char>(*p);
+
+    if (ReadBatchModels(szPath, modelDefault, rgModels) == false)
+    {
+        tcerr << _T("unable to load ") << szPath << std::endl;
+        return 2;
+    }
+
+    std::filesystem::path pathOutDir;
+
+    if (const TCHAR* szOutDir = GetOptionString(argc, argv, _T("-out"), nullptr))
+    {
+        pathOutDir = szOutDir;
+    }
+    else
+    {
+        TCHAR szModulePath[_MAX_PATH] = { 0 };
+
+        GetModulePath(szModulePath, _countof(szModulePath) - 1);
+
+        pathOutDir = std::filesystem::path(szModulePath) / _T("..") / _T("Data");
+    }
+
+    TIME_POINT tpStart = std::chrono::system_clock::now( );
+
+    batch.Start(static_cast<unsigned int>(GetOptionValue(argc, argv, _T("-threads"), 0)),
+                [&](const BATCH_RESULT& result)
+        {
+            const BATCH_MODEL& model = *result.pModel;
+            tstringstream      ssLevels;
+            tstringstream      ss;
+
+            // named as in interactive mode, along with any strength or 
+            // engine other than the default
+            bool bMixed = false;
+
+            for (auto it : model.rgNumLevels)
+                bMixed |= (it != model.rgNumLevels[0]);
+
+            ssLevels << model.rgNumLevels[0];
+            for (size_t n = 1; bMixed && (n < model.rgNumLevels.size()); n++)
+                ssLevels << _T(",") << model.rgNumLevels[n];
+
+            ss << _T("CSCE5420_AETG_") << model.rgNumLevels.size() << _T("_") << ssLevels.str();
+
+            if (model.nT != T_WAY)
+                ss << _T("_t") << model.nT;
+
+            if (!model.strEngine.empty() && (model.strEngine != "aetg"))
+                ss << _T("_") << tstring(model.strEngine.begin(), model.strEngine.end());
+
+            ss << (bBinary                        ? _T("_mls.bin") :
+                   (eFormat == SUITE_FORMAT::CSV) ? _T("_mls.csv") : 
+                   (eFormat == SUITE_FORMAT::TSV) ? _T("_mls.tsv") : _T("_mls.txt"));
+
+            std::filesystem::path pathSuite = pathOutDir / ss.str();
+
+            nNumDone++;
+
+            tcout << _T("[") << nNumDone << _T("/") << rgModels.size() << _T("] k = ") 
+                  << model.rgNumLevels.size() << _T(" v = ") << ssLevels.str() << _T(" t = ") << model.nT;
+
+            if (result.nRepetitions == 0)
+            {
+                nNumFailed++;
+                tcout << _T(" failed: ") << tstring(result.strError.begin(), result.strError.end()) << std::endl;
+                return;
+            }
+
+            tcout << _T(" Best ")   << result.nBest 
+                  << _T(" Avg ")    << result.nAverage 
+                  << _T(" Worst ")  << result.nWorst
+                  << _T(" Reps ")   << result.nRepetitions
+                  << _T(" in ")     << result.dElapsed << _T("s") << std::endl;
 
-    for (auto &it : testSuite )
-        os << it << std::endl;
+            if (result.nUnresolved > 0)
+                tcerr << result.nUnresolved << _T(" tuples could be neither covered nor shown to be")
+                      << _T(" forbidden, coverage may be incomplete") << std::endl;
 
-    return os;
+            std::vector<LEVEL_T> rgMinLevel;
+            LEVEL_T              nMinLevel = 0;
+
+            for (auto it : model.rgNumLevels)
+            {
+                rgMinLevel.push_back(nMinLevel);
+                nMinLevel = static_cast<LEVEL_T>(nMinLevel + it);
+            }
+
+            bool bResult = bBinary ? WriteBinarySuite(pathSuite.c_str(), rgMinLevel, model.rgNumLevels, model.nT,
+                                                      result.lstTestSuite, result.nSeed, model.strEngine.c_str(), 
+                                                      result.nRepetitions)
+                                   : (writer.Open(pathSuite.c_str(), eFormat) && 
+                                      writer.WriteSuite(result.lstTestSuite));
+            writer.Close( );
+
+            if (bResult == false)
+            {
+                nNumFailed++;
+                tcerr << _T("unable to write ") << pathSuite.c_str() << std::endl;
+            }
+        });
+
+    for (auto& it : rgModels)
+        batch.Submit(it);
+
+    batch.Wait( );
+
+    TIME_DURATION durElapsed = std::chrono::system_clock::now( ) - tpStart;
+
+    tcout << _T("Batch of ") << rgModels.size() << _T(" models on ") 
+          << batch.get_Pool().get_NumThreads() << _T(" threads in ") 
+          << durElapsed.count() << _T("s, ") 
+          << batch.get_Pool().get_NumSteals() << _T(" work items stolen") << std::endl;
+
+    return (nNumFailed == 0) ? 0 : 1;
 }
 
 /**
-    @brief Outputs test suite to an ostream
+    @brief Reorders an existing suite file by its rate of t-way coverage
+
+    Invoked with <b>-reorder path</b>, optionally followed by <b>-t n</b> 
+    (default 3), <b>-levels v[,..]</b> for text suites (default inferred), 
+    <b>-format</b> and <b>-out path</b> (default path.reordered).  With 
+    <b>-curve</b> the coverage curve of the new order is written alongside.
 
-    @param [in,out] os      reference to an ostream
-    @param [in] testSuite   target
+    @param [in] argc        number of command line arguments
+    @param [in] argv        command line arguments
+    @param [in] szPath      path of the suite file
 
-    @retval tostream
+    @retval int             0 on success, 2 on error
 */
-tostream& OutputTestSuite(tostream& os, const std::list<CTestCase>& testSuite)
+int ReorderSuite(int argc, _TCHAR* argv[], const TCHAR* szPath)
 {
-    os << testSuite.size() << std::endl << std::endl;
+    CSuiteReorderer      reorderer;
+    CSuiteWriter         writer;
+    std::vector<LEVEL_T> rgMinLevel;
+    std::vector<LEVEL_T> rgNumLevels;
+    std::list<CTestCase> lstTestSuite;
+    std::vector<size_t>  rgCurve;
+    QWORD                nSeed = 0;
+
+    WORD    nT         = static_cast<WORD>   (GetOptionValue(argc, argv, _T("-t"), T_WAY));
+    std::vector<LEVEL_T> rgTextLevels;
+
+    SUITE_FORMAT eFormat  = SelectSuiteFormat(argc, argv);
+    bool         bBinary  = (_tcscmp(GetOptionString(argc, argv, _T("-format"), _T("")), _T("bin")) == 0);
+
+    tstringstream ss;
+    ss << GetOptionString(argc, argv, _T("-out"), szPath);
+    if (GetOptionString(argc, argv, _T("-out"), nullptr) == nullptr)
+        ss << _T(".reordered");
+
+    TIME_POINT tpStart = std::chrono::system_clock::now( );
+
+    if ((ParseLevelCounts(GetOptionString(argc, argv, _T("-levels"), _T("")), rgTextLevels) == false) ||
+        (ReadTestSuite(szPath, rgTextLevels, rgMinLevel, rgNumLevels, lstTestSuite, &nSeed) == false))
+    {
+        tcerr << _T("unable to load ") << szPath << std::endl;
+        return 2;
+    }
+
+    if (reorderer.Init(rgMinLevel, rgNumLevels, nT) == false)
+    {
+        tcerr << _T("t must be in [1..") << MAX_T_WAY << _T("] and no more than k") << std::endl;
+        return 2;
+    }
+
+    size_t nContributing = reorderer.Reorder(lstTestSuite, rgCurve);
+
+    TIME_DURATION durElapsed = std::chrono::system_clock::now( ) - tpStart;
+
+    bool bResult = bBinary ? WriteBinarySuite(ss.str().c_str(), rgMinLevel, rgNumLevels, nT,
+                                              lstTestSuite, nSeed, "reorder", 1)
+                           : (writer.Open(ss.str().c_str(), eFormat) && 
+                              writer.WriteSuite(lstTestSuite));
+    writer.Close( );
+
+    if (bResult && IsOptionSet(argc, argv, _T("-curve")) && (ss.str() != _T("-")))
+    {
+        bResult = writer.Open((ss.str() + _T(".curve")).c_str(), eFormat) &&
+                  writer.WriteCoverageCurve(rgCurve, reorderer.get_NumTuples());
+        writer.Close( );
+    }
+
+    if (bResult == false)
+    {
+        tcerr << _T("unable to write ") << ss.str() << std::endl;
+        return 2;
+    }
 
-    for (auto& it : testSuite)
-        os << it << std::endl;
+    if (ss.str() != _T("-"))
+    {
+        tcout << _T("Rows: ")         << lstTestSuite.size() 
+              << _T(" Contributing: ") << nContributing 
+              << _T(" t: ")            << nT << std::endl;
+        tcout << _T("Reordered in ")  << durElapsed.count() << _T("s") << std::endl;
+    }
 
-    return os;
+    return 0;
 }
 
 /**
@@ -201,153 +833,503 @@ int _tmain(int argc, _TCHAR* argv[])
 {
     bool bExit    = false;
 
-    int  iFactors = 0;
-    int  iLevels  = 0;
+    int     iFactors = 0;
+    tstring strLevels;
+
+    const TCHAR* szVerify = GetOptionString(argc, argv, _T("-verify"), nullptr);
+
+    if (szVerify)
+        return VerifySuite(argc, argv, szVerify);
+
+    const TCHAR* szReorder = GetOptionString(argc, argv, _T("-reorder"), nullptr);
+
+    if (szReorder)
+        return ReorderSuite(argc, argv, szReorder);
+
+    // a worker process of a multi-process generation, started by another
+    // instance given -processes
+    const TCHAR* szWorker = GetOptionString(argc, argv, _T("-worker"), nullptr);
+
+    if (szWorker)
+        return CProcessGenerator::RunWorker(szWorker, 
+                   static_cast<unsigned int>(GetOptionValue(argc, argv, _T("-slot"), 0)));
+
+    const TCHAR* szServe = GetOptionString(argc, argv, _T("-serve"), nullptr);
+
+    if (szServe)
+        return ServeRequests(argc, argv, szServe);
+
+    const TCHAR* szBatch = GetOptionString(argc, argv, _T("-batch"), nullptr);
+
+    if (szBatch)
+        return RunBatch(argc, argv, szBatch);
+
+    CComponentSystem            system;
+    std::unique_ptr<CTestSuite> pTestSuite = SelectTestSuite(argc, argv);
+    CTestSuite&                 testSuite  = *pTestSuite;
+    bool        bReduce   = !IsOptionSet(argc, argv, _T("-noreduce"));
+    bool        bMerge    = IsOptionSet(argc, argv, _T("-dontcare"));
+    double      dAnneal   = GetOptionValue(argc, argv, _T("-anneal"), 0.0);
+    bool        bStream   = IsOptionSet(argc, argv, _T("-stream"));
+    bool        bCurve    = IsOptionSet(argc, argv, _T("-curve"));
+    unsigned int nProcesses = static_cast<unsigned int>(GetOptionValue(argc, argv, _T("-processes"), 1));
+
+    testSuite.set_UseConstructions(!IsOptionSet(argc, argv, _T("-noconstruct")));
+    bool bRecursive = IsOptionSet(argc, argv, _T("-recursive"));
+
+    testSuite.set_UseRecursive(bRecursive);
+
+    // a bitmap beyond half of the physical memory is spilled to the temporary
+    // directory anyway; -spill sends any bitmap to the given one
+    const TCHAR* szSpill  = GetOptionString(argc, argv, _T("-spill"), nullptr);
+
+    if (szSpill)
+        testSuite.SetSpill(szSpill, 1);
+
+    SUITE_FORMAT eFormat  = SelectSuiteFormat(argc, argv);
+    bool         bBinary  = (_tcscmp(GetOptionString(argc, argv, _T("-format"), _T("")), _T("bin")) == 0);
+    const TCHAR* szOutput = GetOptionString(argc, argv, _T("-out"), nullptr);
+    const TCHAR* szSeed   = GetOptionString(argc, argv, _T("-seed"), nullptr);
+    const TCHAR* szConstr = GetOptionString(argc, argv, _T("-constraints"), nullptr);
+    const TCHAR* szCache  = GetOptionString(argc, argv, _T("-cache"), nullptr);
+
+    // a suite written to standard output leaves it to the suite, so the 
+    // prompts and progress go to standard error
+    tostream&    tcmsg    = (szOutput && (_tcscmp(szOutput, _T("-")) == 0)) ? tcerr : tcout;
+    bool         bRefresh = IsOptionSet(argc, argv, _T("-cacheupdate"));
+    const TCHAR* szCheckpoint = GetOptionString(argc, argv, _T("-checkpoint"), nullptr);
+    TIME_DURATION durCheckpoint(GetOptionValue(argc, argv, _T("-checkpointinterval"), 
+                                               DEFAULT_CHECKPOINT_INTERVAL));
 
     std::list<CTestCase> lstBestTestSuite;
+    std::vector<size_t>  rgBestCurve;
+    std::list<CTestCase> lstSeedSuite;
+    std::vector<LEVEL_T> rgSeedMinLevel;
+    std::vector<LEVEL_T> rgSeedNumLevels;
+    std::vector<std::vector<LEVEL_T>> rgForbidden;
+    std::vector<STRENGTH_RELATION>    rgRelations;
+
+    // the base strength and any number of higher strength sub-relations, 
+    // e.g. -t 2 -relation 4:0,1,2,3 for pairwise coverage with 4-way 
+    // coverage of the first four factors
+    WORD nT = static_cast<WORD>(GetOptionValue(argc, argv, _T("-t"), T_WAY));
+
+    if ((nT < 2) || (nT > MAX_T_WAY))
+    {
+        tcerr << _T("t must be in [2..") << MAX_T_WAY << _T("]") << std::endl;
+        return 2;
+    }
 
-    // Seed the random-number generator with the current time so that
-    // the numbers will be different every time we run.
-    srand((unsigned) std::chrono::system_clock::now( ).time_since_epoch( ).count( ));
+    for (int i = 1; i < argc - 1; i++)
+    {
+        if (_tcscmp(argv[i], _T("-relation")) == 0)
+        {
+            rgRelations.emplace_back( );
+
+            if (ParseRelation(argv[++i], rgRelations.back()) == false)
+            {
+                tcerr << _T("malformed relation ") << argv[i] << std::endl;
+                return 2;
+            }
+        }
+    }
+
+    // merging and annealing only know of a single strength
+    if (rgRelations.empty() == false)
+    {
+        bMerge  = false;
+        dAnneal = 0.0;
+    }
+
+    if (szSeed)
+    {
+        std::vector<LEVEL_T> rgTextLevels;
+
+        if ((ParseLevelCounts(GetOptionString(argc, argv, _T("-levels"), _T("")), rgTextLevels) == false) ||
+            (ReadTestSuite(szSeed, rgTextLevels, rgSeedMinLevel, rgSeedNumLevels, lstSeedSuite) == false))
+        {
+            tcerr << _T("unable to load ") << szSeed << std::endl;
+            return 2;
+        }
+
+        // merging and annealing rearrange the suite, which would lose the 
+        // positions of the seed test cases
+        bMerge  = false;
+        dAnneal = 0.0;
+    }
+
+    if (szConstr && (ReadForbiddenTuples(szConstr, rgForbidden) == false))
+    {
+        tcerr << _T("unable to load ") << szConstr << std::endl;
+        return 2;
+    }
+
+    // a cached suite stands in for the whole generation, though a seeded run
+    // depends on more than the model and is never cached
+    CSuiteCache cache;
+
+    if (szCache && !szSeed && !bStream)
+    {
+        double dCacheMB = GetOptionValue(argc, argv, _T("-cachesize"), 
+                                         static_cast<double>(DEFAULT_CACHE_CAPACITY >> 20));
+
+        if (cache.Open(szCache, static_cast<QWORD>(dCacheMB * 1024 * 1024)) == false)
+            tcerr << _T("unable to open cache ") << szCache << std::endl;
+    }
 
     while (!bExit)
     {
-        tcout << _T("Please enter factors [1..100]:");
+        tcmsg << _T("Please enter factors [1..100]:");
         tcin  >> iFactors;
-        tcout << _T("Please enter levels  [1..100]:");
-        tcin  >> iLevels;
+        tcmsg << _T("Please enter levels  [1..100]:");
+        tcin  >> strLevels;
+
+        // a mixed-level system is entered as one count per factor, e.g. 2,2,12
+        std::vector<LEVEL_T> rgNumLevels;
+
+        if ((iFactors <= 0) || (ParseLevelCounts(strLevels.c_str(), rgNumLevels) == false) || rgNumLevels.empty() ||
+            ((rgNumLevels.size() > 1) && (rgNumLevels.size() != static_cast<size_t>(iFactors))))
+        {
+            tcerr << _T("expected a level count or one per factor") << std::endl;
+
+            if (!tcin)
+                break;
+            continue;
+        }
+
+        if (rgNumLevels.size() == 1)
+            rgNumLevels.assign(iFactors, rgNumLevels[0]);
 
         TIME_DURATION durElapsed;           
-        TIME_DURATION durCumulativeElapsedTime; // used to determine average
+        TIME_DURATION durCumulativeElapsedTime = TIME_DURATION::zero( ); // used to determine average
         size_t nCummulativeAETG = 0;            // used to determine average
         size_t nBestAETG        = 0;
         size_t nWorstAETG       = 0;
+        size_t nBestUnresolved  = 0;            // tuples the best suite may be missing
 
-        g_System.Init(static_cast<FACTOR_T>(iFactors), 
-                      static_cast<LEVEL_T> (iLevels));
+        system.Init(rgNumLevels);
 
-        g_TestSuite.Init( g_System );
+        if (system.SetStrength(nT) == false)
+        {
+            tcerr << _T("t must be no more than k") << std::endl;
+            continue;
+        }
 
-        CTestCase Candidate;
+        for (auto& it : rgRelations)
+        {
+            if (system.AddRelation(it.rgFactors, it.nT) == false)
+                tcerr << _T("ignoring relation of strength ") << it.nT 
+                      << _T(", which must exceed t and fit its factors") << std::endl;
+        }
 
-        for (int i = 0; i < NUM_REPETITIONS; i++)
+        for (size_t n = 0; n < rgForbidden.size(); n++)
         {
-            size_t     nCurAETG = g_TestSuite.ClearTestSuite();
+            if (system.AddForbiddenTuple(rgForbidden[n]) == false)
+                tcerr << _T("ignoring forbidden tuple ") << (n + 1) 
+                      << _T(" of ") << szConstr << std::endl;
+        }
 
-            TIME_POINT tpStart  = std::chrono::system_clock::now( );
+        testSuite.Init( system );
 
-            size_t nNumTuples   = g_TestSuite.GenerateUncoveredT3Tuples(g_System);
+        if (szSeed)
+            testSuite.SetSeedSuite(system, rgSeedMinLevel, rgSeedNumLevels, lstSeedSuite);
 
-            tcout << std::setw(4) << i << _T(") ---------------------------------(") << nNumTuples 
-                  << std::endl;
+        tstringstream ss;
 
-            g_TestSuite.GenerateMinLevelCandidate(g_System, Candidate);
-#ifdef _DEBUG
-            TCHAR szBuffer[256] = { 0 };
+        if (szOutput)
+        {
+            ss << szOutput;
+        }
+        else
+        {
+            TCHAR szModulePath[_MAX_PATH] = { 0 };
 
-            DebugTrace(_T(" Min) Best ( %s), UC Tuples Covered: %d \n"),
-                       Candidate.ToString(szBuffer, _countof(szBuffer)),
-                       g_TestSuite.CalculateT3TestCaseCoverage(Candidate));
-#endif
-            g_TestSuite.AddToT3TestSuite(Candidate);
+            GetModulePath(szModulePath, _countof(szModulePath) - 1);
 
-            g_TestSuite.GenerateMaxLevelCandidate(g_System, Candidate);
-#ifdef _DEBUG
-            DebugTrace(_T(" Max) Best ( %s), UC Tuples Covered: %d \n"),
-                       Candidate.ToString(szBuffer, _countof(szBuffer)),
-                       g_TestSuite.CalculateT3TestCaseCoverage(Candidate));
-#endif
-            g_TestSuite.AddToT3TestSuite(Candidate);
+            ss << szModulePath << _T("..\\Data\\CSCE5420_AETG_") 
+               << iFactors << _T("_") << strLevels 
+               << (bBinary                        ? _T("_mls.bin") :
+                   (eFormat == SUITE_FORMAT::CSV) ? _T("_mls.csv") : 
+                   (eFormat == SUITE_FORMAT::TSV) ? _T("_mls.tsv") : _T("_mls.txt"));
+        }
+
+        CSuiteWriter writer;
+
+        // a streamed suite is written row by row as it is generated, so it 
+        // is neither repeated nor post-processed; the binary header needs the
+        // row count up front, so it cannot be streamed
+        if (bStream && !bBinary && writer.Open(ss.str().c_str(), eFormat))
+        {
+            if (eFormat != SUITE_FORMAT::TEXT)
+                writer.WriteHeader(0, system.get_NumFactors( ));
+
+            testSuite.SetSuiteWriter(&writer);
+        }
+
+        std::string strCacheKey = CSuiteCache::MakeKey(system, rgForbidden, bMerge);
+        bool        bCacheHit   = !bRefresh && cache.Lookup(strCacheKey, system, lstBestTestSuite);
+
+        // there is nothing to be gained from repeating a deterministic engine,
+        // nor an orthogonal array construction, which is already optimal
+        int  iRepetitions = bCacheHit ? 0 :
+                            (testSuite.IsDeterministic() || writer.IsOpen() ||
+                             testSuite.CanConstructTestSuite(system)) ? 1 : NUM_REPETITIONS;
+
+        CProcessGenerator procGenerator;
+        PROCESS_RESULT    procResult   = { };
+        bool              bProcessed   = false;
+
+        // the repetitions may go to worker processes sharing one coverage 
+        // image, falling back to this process should they fail
+        if ((nProcesses > 1) && (iRepetitions > 1) && !szSeed)
+        {
+            bProcessed = procGenerator.Generate(system, rgForbidden, testSuite, nProcesses, 
+                                                static_cast<DWORD>(iRepetitions), bReduce, bMerge, 
+                                                lstBestTestSuite, procResult);
+            if (bProcessed)
+            {
+                iRepetitions             = static_cast<int>(procResult.nRepetitions);
+                nBestAETG                = procResult.nBest;
+                nWorstAETG               = procResult.nWorst;
+                nBestUnresolved          = procResult.nUnresolved;
+                nCummulativeAETG         = procResult.nTotal;
+                durCumulativeElapsedTime = TIME_DURATION(procResult.dSeconds);
 
-            while (g_TestSuite.get_NumUncoveredT3Tuples() > 0)
+                if (bCurve)
+                    CalcCoverageCurve(system, lstBestTestSuite, rgBestCurve);
+            }
+            else
             {
-                CTestCase            BestCandidate;
+                tcerr << _T("unable to run worker processes, generating in process") << std::endl;
+            }
+        }
 
-                size_t               nBestCoverage = 0;
-                int                  iRandomMod    = 2;
+        CCheckpointWriter checkpointWriter;
+        CHECKPOINT        checkpoint   = { };
+        GENERATION_STATE  stateResumed;
+        TIME_POINT        tpStart;
+        TIME_POINT        tpCheckpoint = std::chrono::system_clock::now( );
+        TIME_DURATION     durResumed   = TIME_DURATION::zero( );
+        int               iFirst       = 0;
+        bool              bResume      = false;
 
-                for (int j = 0; j < TEST_CASE_CANDIDATES; j++)
-                {
-                    size_t nCoverage = g_TestSuite.GenerateT3TestCaseCandidate(g_System, Candidate);
-#ifdef _DEBUG
-//                    DebugTrace(_T("  %2d) Candidate ( %s) \n"), j,
-//                               Candidate.ToString(szBuffer, _countof(szBuffer) - 1) );
-#endif
-                    if (nCoverage > nBestCoverage)
-                    {
-                        nBestCoverage  = nCoverage;
-                        BestCandidate  = Candidate;
-                    }
-                    else if ((nCoverage == nBestCoverage) && (nCoverage != 0))
-                    { // two candidates with the same coverage?
-                      // let's randomly decide who will be considered
-                      // the best
-                        if (( rand( ) % iRandomMod ) == 0)
-                        {
-                            BestCandidate = Candidate;
-                            iRandomMod    = iRandomMod << 1;
-                        }
-                    }
-                }
-
-                nCurAETG = g_TestSuite.AddToT3TestSuite(BestCandidate);
-
-#ifdef _DEBUG
-                DebugTrace(_T("Best ( %s), UC Tuples Covered: %d Remaining: %d SuiteSize: %d\n"), 
-                           BestCandidate.ToString(szBuffer, _countof(szBuffer)),
-                           nBestCoverage, 
-                           g_TestSuite.get_NumUncoveredT3Tuples(), 
-                           g_TestSuite.get_TestSuiteSize() );
-#endif
-            } // end while (g_TestSuite.GetNumUncoveredT3Tuples() > 0)
+        // the progress of the repetitions is written out every so often, on a
+        // thread of its own, for a run cut short to be resumed from; a seeded
+        // run, like the cache, depends on more than the key describes
+        if (szCheckpoint && !bProcessed && !szSeed && !writer.IsOpen() && (iRepetitions > 0) &&
+            checkpointWriter.Start(szCheckpoint))
+        {
+            std::ostringstream ssKey;
+
+            ssKey << strCacheKey << ";e=" << testSuite.GetEngineName( )
+                  << ";n=" << (bReduce ? 1 : 0) << (testSuite.get_UseConstructions() ? 1 : 0)
+                  << (testSuite.get_UseRecursive() ? 1 : 0);
+
+            if (ReadCheckpoint(szCheckpoint, checkpoint) && (checkpoint.strKey == ssKey.str()) &&
+                (checkpoint.nRepetitions == static_cast<DWORD>(iRepetitions)) &&
+                (checkpoint.nCompleted < checkpoint.nRepetitions) &&
+                system.SetRandomState(checkpoint.strRandomState))
+            {
+                iFirst                   = static_cast<int>(checkpoint.nCompleted);
+                bResume                  = checkpoint.bInProgress;
+                stateResumed             = std::move(checkpoint.State);
+                durResumed               = TIME_DURATION(checkpoint.dCurSeconds);
+                nBestAETG                = checkpoint.nBest;
+                nWorstAETG               = checkpoint.nWorst;
+                nCummulativeAETG         = checkpoint.nTotal;
+                durCumulativeElapsedTime = TIME_DURATION(checkpoint.dSeconds);
+                lstBestTestSuite.swap(checkpoint.lstBestTestSuite);
+                rgBestCurve.swap(checkpoint.rgBestCurve);
+                nBestUnresolved          = checkpoint.nBestUnresolved;
+
+                tcmsg << _T("Resuming from ") << szCheckpoint << _T(" at repetition ") 
+                      << iFirst << std::endl;
+            }
+
+            checkpoint = CHECKPOINT();
+            checkpoint.strKey       = ssKey.str( );
+            checkpoint.nRepetitions = static_cast<DWORD>(iRepetitions);
+        }
+
+        // captures the run so far, the generation in progress included if
+        // bInProgress; only the capture itself holds up generation
+        auto PostCheckpoint = [&](DWORD nCompleted, bool bInProgress)
+        {
+            TIME_POINT tpNow = std::chrono::system_clock::now( );
+
+            if (tpNow - tpCheckpoint < durCheckpoint)
+                return;
+
+            auto pCheckpoint = std::make_unique<CHECKPOINT>( );
+
+            pCheckpoint->strKey           = checkpoint.strKey;
+            pCheckpoint->nRepetitions     = checkpoint.nRepetitions;
+            pCheckpoint->nCompleted       = nCompleted;
+            pCheckpoint->nBest            = nBestAETG;
+            pCheckpoint->nWorst           = nWorstAETG;
+            pCheckpoint->nTotal           = nCummulativeAETG;
+            pCheckpoint->dSeconds         = durCumulativeElapsedTime.count( );
+            pCheckpoint->lstBestTestSuite = lstBestTestSuite;
+            pCheckpoint->rgBestCurve      = rgBestCurve;
+            pCheckpoint->nBestUnresolved  = nBestUnresolved;
+            pCheckpoint->strRandomState   = system.GetRandomState( );
+            pCheckpoint->bInProgress      = bInProgress;
+            pCheckpoint->dCurSeconds      = 0.0;
+
+            if (bInProgress)
+            {
+                pCheckpoint->dCurSeconds = (durResumed + TIME_DURATION(tpNow - tpStart)).count( );
+                testSuite.SaveState(pCheckpoint->State);
+            }
+
+            checkpointWriter.Post(std::move(pCheckpoint));
+            tpCheckpoint = std::chrono::system_clock::now( );
+        };
+
+        for (int i = iFirst; !bProcessed && (i < iRepetitions); i++)
+        {
+            tcmsg << std::setw(4) << i << _T(") ---------------------------------(") 
+                  << system.CalcNumberOfRequiredConfigurations() << std::endl;
+
+            tpStart = std::chrono::system_clock::now( );
+
+            if (checkpointWriter.IsStarted())
+                testSuite.SetCheckpointSink([&, i] { PostCheckpoint(static_cast<DWORD>(i), true); });
+
+            size_t     nCurAETG = 0;
+
+            // a repetition cut short carries on from the row it had reached
+            if (bResume && testSuite.ResumeTestSuite(system, stateResumed))
+            {
+                nCurAETG = testSuite.get_TestSuiteSize( );
+            }
+            else
+            {
+                if (bResume)
+                    tcerr << _T("unable to resume the repetition, starting it over") << std::endl;
+
+                // a recursive construction comes out the same every time, so
+                // only the first repetition makes one and the rest search
+                testSuite.set_UseRecursive(bRecursive && (i == 0));
+
+                durResumed = TIME_DURATION::zero( );
+                nCurAETG   = testSuite.GenerateTestSuite(system);
+            }
+
+            bResume      = false;
+            stateResumed = GENERATION_STATE();
+            testSuite.SetCheckpointSink(CHECKPOINT_SINK());
+
+            if (bReduce && !writer.IsOpen())
+                nCurAETG -= testSuite.ReduceTestSuite(system);
+
+            if (bMerge && !writer.IsOpen())
+                nCurAETG -= testSuite.MergeTestSuite(system);
 
             TIME_POINT tpEnd = std::chrono::system_clock::now( );
 
-            durElapsed       = tpEnd - tpStart;
+            durElapsed       = tpEnd - tpStart + durResumed;
+            durResumed       = TIME_DURATION::zero( );
 
             durCumulativeElapsedTime += durElapsed;
             nCummulativeAETG         += nCurAETG;
 
             if (( nBestAETG == 0 ) || ( nCurAETG < nBestAETG ))
             {
-                nBestAETG = nCurAETG;
+                nBestAETG       = nCurAETG;
+                nBestUnresolved = testSuite.get_NumUnresolvedTuples( );
+                rgBestCurve     = testSuite.get_CoverageCurve( );
                 lstBestTestSuite.clear();
-                g_TestSuite.SpliceTestSuite(lstBestTestSuite);
+                testSuite.SpliceTestSuite(lstBestTestSuite);
             }
 
             if (( nWorstAETG == 0 ) || ( nCurAETG > nWorstAETG ))
             {
                 nWorstAETG = nCurAETG;
             }
-        } // end for (int i = 0; i < NUM_REPETITIONS; i++)
-        tcout << _T("For v = ") << iLevels << (" t = 3") << (" k = ") << iFactors 
+
+            if (checkpointWriter.IsStarted())
+                PostCheckpoint(static_cast<DWORD>(i + 1), false);
+        } // end for (int i = 0; i < iRepetitions; i++)
+
+        // a completed run has nothing to resume
+        checkpointWriter.Stop(true);
+        tcmsg << _T("For v = ") << strLevels << _T(" t = ") << nT << (" k = ") << iFactors 
               << std::endl;
-        tcout << _T("-------------------------------------------------------") << std::endl;
-        tcout << _T("Avg execution time: ") << (durCumulativeElapsedTime.count() / NUM_REPETITIONS) 
-              << _T("s") << std::endl;
-        tcout << _T("Best  mAETG: ")        << nBestAETG  << std::endl;
-        tcout << _T("Avg   mAETG: ")        << (nCummulativeAETG / NUM_REPETITIONS) << std::endl;
-        tcout << _T("Worst mAETG: ")        << nWorstAETG << std::endl;
-
-        tofstream     of;
-        tstringstream ss;
+        tcmsg << _T("-------------------------------------------------------") << std::endl;
 
-        TCHAR szModulePath[_MAX_PATH] = { 0 };
+        if (bCacheHit)
+        {
+            if (bCurve)
+                CalcCoverageCurve(system, lstBestTestSuite, rgBestCurve);
 
-        GetModulePath(szModulePath, _countof(szModulePath) - 1);
+            tcmsg << _T("Cached mAETG: ")   << lstBestTestSuite.size() << std::endl;
+        }
+        else
+        {
+            tcmsg << _T("Avg execution time: ") << (durCumulativeElapsedTime.count() / iRepetitions) 
+                  << _T("s") << std::endl;
+            tcmsg << _T("Best  mAETG: ")        << nBestAETG  << std::endl;
+            tcmsg << _T("Avg   mAETG: ")        << (nCummulativeAETG / iRepetitions) << std::endl;
+            tcmsg << _T("Worst mAETG: ")        << nWorstAETG << std::endl;
+        }
+
+        // the constraints left the completion search unable to settle some
+        // tuples either way, so the suite may fall short of full coverage
+        if (nBestUnresolved > 0)
+            tcerr << nBestUnresolved << _T(" tuples could be neither covered nor shown to be")
+                  << _T(" forbidden, coverage may be incomplete") << std::endl;
 
-        ss << szModulePath << _T("..\\Data\\CSCE5420_AETG_") 
-           << iFactors << _T("_") << iLevels 
-           << _T("_mls.txt");
+        if ((dAnneal > 0.0) && (nBestAETG > 0) && !writer.IsOpen())
+        {
+            CSuiteAnnealer annealer;
+
+            if (annealer.Init(system, nT))
+            {
+                annealer.Shrink(lstBestTestSuite, dAnneal);
+                CalcCoverageCurve(system, lstBestTestSuite, rgBestCurve);
 
-        of.open(ss.str().c_str());
+                tcmsg << _T("Annealed mAETG: ") << lstBestTestSuite.size() << std::endl;
+            }
+        }
+
+        if (!bCacheHit && cache.IsOpen() && (nBestUnresolved == 0) &&
+            cache.Store(strCacheKey, system, lstBestTestSuite, testSuite.GetEngineName(), iRepetitions))
+            tcmsg << _T("Cached as the best known suite") << std::endl;
 
-        OutputTestSuite(of, lstBestTestSuite);
+        if (writer.IsOpen())
+        {
+            testSuite.SetSuiteWriter(nullptr);
+            writer.Close( );
+        }
+        else if (bBinary)
+        {
+            if (WriteBinarySuite(ss.str().c_str(), system, nT, lstBestTestSuite,
+                                 testSuite.GetEngineName(), iRepetitions) == false)
+                tcerr << _T("unable to write ") << ss.str() << std::endl;
+        }
+        else if (writer.Open(ss.str().c_str(), eFormat))
+        {
+            writer.WriteSuite(lstBestTestSuite);
+            writer.Close( );
+        }
+        else
+        {
+            tcerr << _T("unable to write ") << ss.str() << std::endl;
+        }
+
+        if (bCurve && (ss.str() != _T("-")))
+        {
+            if ((writer.Open((ss.str() + _T(".curve")).c_str(), eFormat) == false) ||
+                (writer.WriteCoverageCurve(rgBestCurve, 
+                                           system.CalcNumberOfRequiredConfigurations()) == false))
+                tcerr << _T("unable to write ") << ss.str() << _T(".curve") << std::endl;
 
-        of.close();
+            writer.Close( );
+        }
 
         TCHAR iAnyKey;
-        tcout << _T("press (c)ontinue or e(x)it ");
+        tcmsg << _T("press (c)ontinue or e(x)it ");
         tcin  >> iAnyKey;
 
         if (iAnyKey == 'x')
@@ -0,0 +1,174 @@
+/**
+ *  @file       BatchGenerator.cpp
+ *  @brief      CBatchGenerator class implementation
+ *  @author     Mark L. Short
+ *  @date       October 18, 2026
+ */
+
+#include "stdafx.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include "GenerationContext.h"
+
+#include "BatchGenerator.h"
+
+/**
+  @brief  The state of a model while its repetitions are running
+*/
+struct CBatchGenerator::BATCH_JOB
+{
+    typedef std::chrono::steady_clock CLOCK;
+
+    BATCH_RESULT        result;         ///< figures merged so far
+    std::mutex          mtx;            ///< guards result
+    std::atomic<DWORD>  nRemaining;     ///< repetitions not yet merged
+    size_t              nTotalRows;     ///< rows summed over the suites
+    CLOCK::time_point   tpStart;        ///< start of the first repetition
+};
+
+bool
+CBatchGenerator::Start(unsigned int nNumThreads, const BATCH_RESULT_FN& fnResult)
+{
+    m_fnResult = fnResult;
+
+    return m_Pool.Start(nNumThreads);
+}
+
+size_t
+CBatchGenerator::Submit(const BATCH_MODEL& model)
+{
+    std::shared_ptr<BATCH_JOB> pJob = std::make_shared<BATCH_JOB>();
+
+    m_rgModels.emplace_back(new BATCH_MODEL(model));
+
+    pJob->result.nModel       = m_rgModels.size() - 1;
+    pJob->result.pModel       = m_rgModels.back().get();
+    pJob->result.nBest        = 0;
+    pJob->result.nSeed        = 0;
+    pJob->result.nUnresolved  = 0;
+    pJob->result.nAverage     = 0;
+    pJob->result.nWorst       = 0;
+    pJob->result.nRepetitions = 0;
+    pJob->result.dSeconds     = 0.0;
+    pJob->result.dElapsed     = 0.0;
+    pJob->nRemaining          = 0;
+    pJob->nTotalRows          = 0;
+
+    m_Pool.Submit([this, pJob] { RunModel(pJob); });
+
+    return pJob->result.nModel;
+}
+
+void
+CBatchGenerator::Wait(void)
+{
+    m_Pool.Wait( );
+}
+
+void
+CBatchGenerator::RunModel(const std::shared_ptr<BATCH_JOB>& pJob)
+{
+    const BATCH_MODEL& model = *pJob->result.pModel;
+
+    std::unique_ptr<CGenerationContext> pContext(new CGenerationContext);
+
+    pJob->tpStart = BATCH_JOB::CLOCK::now();
+
+    if (!pContext->SetModel(model.rgNumLevels, model.nT) || !pContext->SetEngine(model.strEngine.c_str()))
+    {
+        pJob->result.strError = pContext->get_LastError( );
+        Finish(*pJob);
+        return;
+    }
+
+    // there is nothing to be gained from repeating a deterministic engine,
+    // nor an orthogonal array construction, which is already optimal
+    const CTestSuite& engine       = pContext->get_Engine( );
+    DWORD             nRepetitions = std::max<DWORD>(model.nRepetitions, 1);
+
+    if (engine.IsDeterministic() || engine.CanConstructTestSuite(pContext->get_System()))
+        nRepetitions = 1;
+
+    pJob->nRemaining = nRepetitions;
+
+    // the other repetitions go to this worker's own deque, for idle workers
+    // to steal, while this worker gets on with the first
+    for (DWORD i = 1; i < nRepetitions; i++)
+        m_Pool.Submit([this, pJob] { RunRepetition(pJob, nullptr); });
+
+    RunRepetition(pJob, std::move(pContext));
+}
+
+void
+CBatchGenerator::RunRepetition(const std::shared_ptr<BATCH_JOB>& pJob,
+                               std::unique_ptr<CGenerationContext> pContext)
+{
+    const BATCH_MODEL& model = *pJob->result.pModel;
+
+    if (pContext == nullptr)
+    {
+        pContext.reset(new CGenerationContext);
+
+        // the model was validated by RunModel
+        pContext->SetModel(model.rgNumLevels, model.nT);
+        pContext->SetEngine(model.strEngine.c_str());
+    }
+
+    bool   bResult = pContext->Generate(1, 0.0);
+    size_t nRows   = pContext->get_TestSuite().size( );
+
+    {
+        std::lock_guard<std::mutex> lock(pJob->mtx);
+
+        BATCH_RESULT& result = pJob->result;
+
+        if (bResult)
+        {
+            result.nRepetitions++;
+            result.dSeconds += pContext->get_Seconds( );
+            pJob->nTotalRows += nRows;
+
+            if ((result.nBest == 0) || (nRows < result.nBest))
+            {
+                result.nBest        = nRows;
+                result.nSeed        = pContext->get_System().get_Seed( );
+                result.nUnresolved  = pContext->get_NumUnresolved( );
+                result.lstTestSuite = pContext->get_TestSuite( );
+            }
+
+            if (nRows > result.nWorst)
+                result.nWorst = nRows;
+        }
+        else if (result.strError.empty())
+        {
+            result.strError = pContext->get_LastError( );
+        }
+    }
+
+    // the context and its scratch state go before the next repetition starts
+    pContext.reset();
+
+    if (--pJob->nRemaining == 0)
+        Finish(*pJob);
+}
+
+void
+CBatchGenerator::Finish(BATCH_JOB& job)
+{
+    BATCH_RESULT& result = job.result;
+
+    if (result.nRepetitions > 0)
+    {
+        result.nAverage = job.nTotalRows / result.nRepetitions;
+        result.strError.clear();
+    }
+
+    result.dElapsed = std::chrono::duration<double>(BATCH_JOB::CLOCK::now() - job.tpStart).count();
+
+    std::lock_guard<std::mutex> lock(m_mtxResult);
+
+    if (m_fnResult)
+        m_fnResult(result);
+}
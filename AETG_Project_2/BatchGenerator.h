@@ -0,0 +1,188 @@
+/**
+ *  @file       BatchGenerator.h
+ *  @brief      CBatchGenerator class interface
+ *
+ *  Provides type definitions for: BATCH_MODEL, BATCH_RESULT, CBatchGenerator
+ *
+ *  @author     Mark L. Short
+ *  @date       October 18, 2026
+ */
+#pragma once
+
+#if !defined(__BATCH_GENERATOR_H__)
+#define __BATCH_GENERATOR_H__
+
+#ifndef __COMMON_DEF_H__
+    #include "CommonDef.h"
+#endif
+
+#ifndef _FUNCTIONAL_
+    #include <functional>
+#endif
+
+#ifndef _LIST_
+    #include <list>
+#endif
+
+#ifndef _MEMORY_
+    #include <memory>
+#endif
+
+#ifndef _MUTEX_
+    #include <mutex>
+#endif
+
+#ifndef _STRING_
+    #include <string>
+#endif
+
+#ifndef _VECTOR_
+    #include <vector>
+#endif
+
+#ifndef __TEST_CASE_H__
+    #include "TestCase.h"
+#endif
+
+#ifndef __WORK_POOL_H__
+    #include "WorkPool.h"
+#endif
+
+// forward declaration
+class CGenerationContext;
+
+/**
+  @brief  One model configuration of a batch
+*/
+struct BATCH_MODEL
+{
+    std::vector<LEVEL_T>  rgNumLevels;      ///< number of levels, indexed by factor
+    WORD                  nT;               ///< interaction strength
+    std::string           strEngine;        ///< aetg, dda or ipog
+    DWORD                 nRepetitions;     ///< suites to generate, the smallest kept
+};
+
+/**
+  @brief  The outcome of one model configuration of a batch
+*/
+struct BATCH_RESULT
+{
+    size_t                nModel;           ///< index of the model, in order of submission
+    const BATCH_MODEL*    pModel;           ///< the model
+    std::list<CTestCase>  lstTestSuite;     ///< the smallest suite, as global levels
+    size_t                nBest;            ///< rows of the smallest suite
+    QWORD                 nSeed;            ///< random seed the smallest suite was generated with
+    size_t                nUnresolved;      ///< tuples the smallest suite may be missing
+    size_t                nAverage;         ///< average rows of the suites
+    size_t                nWorst;           ///< rows of the largest suite
+    DWORD                 nRepetitions;     ///< suites generated
+    double                dSeconds;         ///< generation time summed over the suites
+    double                dElapsed;         ///< wall clock time from first start to last end
+    std::string           strError;         ///< reason the model failed, empty on success
+};
+
+/// receives each result of a batch as soon as its model is done
+typedef std::function<void(const BATCH_RESULT& result)> BATCH_RESULT_FN;
+
+/**
+  @brief  Generates suites for many model configurations on one work pool
+
+  A batch typically mixes models whose costs differ by orders of magnitude,
+  so a fixed split of the models across threads leaves most of them idle
+  while the largest finishes.  Each model is instead a work item of a
+  CWorkPool, which on being run splits its repetitions into work items of
+  their own, each on a CGenerationContext of its own.  Workers done with the
+  cheap models steal the repetitions of the expensive ones, and every worker
+  is busy until the last repetition of the batch.
+
+  The repetitions of a model are its finest unit of work.  The candidates
+  of a single AETG row share the engine's scratch state and take
+  microseconds each, far less than scheduling them would cost.
+
+  Results are handed to the result callback as each model finishes, in
+  order of completion, one at a time.
+*/
+class CBatchGenerator
+{
+    struct BATCH_JOB;
+
+    std::vector<std::unique_ptr<BATCH_MODEL>>  m_rgModels;  ///< models submitted
+    CWorkPool             m_Pool;           ///< the workers
+    std::mutex            m_mtxResult;      ///< serializes the result callback
+    BATCH_RESULT_FN       m_fnResult;       ///< receives each result
+
+public:
+    /// Default Constructor
+    CBatchGenerator()
+        : m_rgModels(),
+          m_Pool(),
+          m_mtxResult(),
+          m_fnResult()
+    { };
+
+    /// Destructor
+    ~CBatchGenerator()
+    { m_Pool.Stop(); };
+
+    CBatchGenerator(const CBatchGenerator&)            = delete;
+    CBatchGenerator& operator=(const CBatchGenerator&) = delete;
+
+/**
+  @brief  Starts the workers
+
+  @param [in] nNumThreads    number of workers, or 0 for one per hardware thread
+  @param [in] fnResult       receives each result, on a worker thread
+
+  @retval true               on success
+  @retval false              if already started
+*/
+    bool   Start(unsigned int nNumThreads, const BATCH_RESULT_FN& fnResult);
+
+/**
+  @brief  Queues a model for generation
+
+  @param [in] model          the model configuration
+
+  @retval size_t             containing the index of the model
+*/
+    size_t Submit(const BATCH_MODEL& model);
+
+/**
+  @brief  Waits for every model submitted to finish
+*/
+    void   Wait(void);
+
+/**
+  @brief  Returns the work pool
+
+  @retval CWorkPool&         containing the pool
+*/
+    inline const CWorkPool& get_Pool(void) const noexcept
+    { return m_Pool; };
+
+private:
+/**
+  @brief  Sets up a model and splits it into repetitions
+
+  @param [in] pJob           the model's job
+*/
+    void   RunModel(const std::shared_ptr<BATCH_JOB>& pJob);
+
+/**
+  @brief  Generates one suite of a model and merges it into the result
+
+  @param [in] pJob           the model's job
+  @param [in] pContext       a context set up for the model, or nullptr
+*/
+    void   RunRepetition(const std::shared_ptr<BATCH_JOB>& pJob, 
+                         std::unique_ptr<CGenerationContext> pContext);
+
+/**
+  @brief  Hands a finished model's result to the result callback
+
+  @param [in] job            the model's job
+*/
+    void   Finish(BATCH_JOB& job);
+};
+
+#endif
@@ -0,0 +1,385 @@
+/**
+ *  @file       BinarySuite.cpp
+ *  @brief      Binary covering array format implementation
+ *  @author     Mark L. Short
+ *  @date       October 18, 2026
+ */
+
+#include "stdafx.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <type_traits>
+#include "ComponentSystem.h"
+
+#include "BinarySuite.h"
+
+/**
+  @brief  Returns the number of bits needed to encode nNumValues values
+
+  @param [in] nNumValues     number of distinct values
+
+  @retval BYTE               containing ceil(log2 nNumValues)
+*/
+static BYTE GetBitWidth(size_t nNumValues) noexcept
+{
+    BYTE nResult = 0;
+
+    while ((static_cast<size_t>(1) << nResult) < nNumValues)
+        nResult++;
+
+    return nResult;
+}
+
+/**
+  @brief  Stores a value as cbSize little endian bytes
+*/
+static void PutLittleEndian(BYTE* pData, QWORD qValue, size_t cbSize) noexcept
+{
+    for (size_t i = 0; i < cbSize; i++)
+        pData[i] = static_cast<BYTE>(qValue >> (8 * i));
+}
+
+/**
+  @brief  Loads a value from cbSize little endian bytes
+*/
+static QWORD GetLittleEndian(const BYTE* pData, size_t cbSize) noexcept
+{
+    QWORD qValue = 0;
+
+    for (size_t i = 0; i < cbSize; i++)
+        qValue |= static_cast<QWORD>(pData[i]) << (8 * i);
+
+    return qValue;
+}
+
+/// stores a field of a header or factor entry at its offset within the file
+#define PUT_FIELD(p, s, f)  PutLittleEndian((p) + offsetof(std::decay_t<decltype(s)>, f), (s).f, sizeof((s).f))
+
+/// loads a field of a header or factor entry from its offset within the file
+#define GET_FIELD(p, s, f)  ((s).f = static_cast<decltype((s).f)>( \
+                                GetLittleEndian((p) + offsetof(std::decay_t<decltype(s)>, f), sizeof((s).f))))
+
+/**
+  @brief  Encodes a header into its sizeof(BINARY_SUITE_HEADER) bytes
+*/
+static void EncodeHeader(const BINARY_SUITE_HEADER& hdr, BYTE* pData) noexcept
+{
+    PUT_FIELD(pData, hdr, dwMagic);
+    PUT_FIELD(pData, hdr, nVersion);
+    PUT_FIELD(pData, hdr, nT);
+    PUT_FIELD(pData, hdr, nNumFactors);
+    PUT_FIELD(pData, hdr, dwFlags);
+    PUT_FIELD(pData, hdr, nNumRows);
+    PUT_FIELD(pData, hdr, nSeed);
+    PUT_FIELD(pData, hdr, cbRow);
+    PUT_FIELD(pData, hdr, nRepetitions);
+    std::memcpy(pData + offsetof(BINARY_SUITE_HEADER, szEngine), hdr.szEngine, sizeof(hdr.szEngine));
+}
+
+/**
+  @brief  Decodes a header from its sizeof(BINARY_SUITE_HEADER) bytes
+*/
+static void DecodeHeader(const BYTE* pData, BINARY_SUITE_HEADER& hdr) noexcept
+{
+    GET_FIELD(pData, hdr, dwMagic);
+    GET_FIELD(pData, hdr, nVersion);
+    GET_FIELD(pData, hdr, nT);
+    GET_FIELD(pData, hdr, nNumFactors);
+    GET_FIELD(pData, hdr, dwFlags);
+    GET_FIELD(pData, hdr, nNumRows);
+    GET_FIELD(pData, hdr, nSeed);
+    GET_FIELD(pData, hdr, cbRow);
+    GET_FIELD(pData, hdr, nRepetitions);
+    std::memcpy(hdr.szEngine, pData + offsetof(BINARY_SUITE_HEADER, szEngine), sizeof(hdr.szEngine));
+}
+
+/**
+  @brief  Encodes a factor entry into its sizeof(BINARY_SUITE_FACTOR) bytes
+*/
+static void EncodeFactor(const BINARY_SUITE_FACTOR& factor, BYTE* pData) noexcept
+{
+    std::memset(pData, 0, sizeof(BINARY_SUITE_FACTOR));
+
+    PUT_FIELD(pData, factor, nMinLevel);
+    PUT_FIELD(pData, factor, nNumLevels);
+    PUT_FIELD(pData, factor, nBits);
+}
+
+/**
+  @brief  Decodes a factor entry from its sizeof(BINARY_SUITE_FACTOR) bytes
+*/
+static void DecodeFactor(const BYTE* pData, BINARY_SUITE_FACTOR& factor) noexcept
+{
+    GET_FIELD(pData, factor, nMinLevel);
+    GET_FIELD(pData, factor, nNumLevels);
+    GET_FIELD(pData, factor, nBits);
+}
+
+bool
+WriteBinarySuite(const TCHAR* szPath, const CComponentSystem& system, WORD nT,
+                 const std::list<CTestCase>& lstTestSuite, 
+                 const char* szEngine, DWORD nRepetitions)
+{
+    FACTOR_T             nNumFactors = system.get_NumFactors( );
+    std::vector<LEVEL_T> rgMinLevel (nNumFactors);
+    std::vector<LEVEL_T> rgNumLevels(nNumFactors);
+
+    for (FACTOR_T nCurFactor = 0; nCurFactor < nNumFactors; nCurFactor++)
+    {
+        rgMinLevel [nCurFactor] = system.GetMinLevel(nCurFactor);
+        rgNumLevels[nCurFactor] = system.GetMaxLevel(nCurFactor) - rgMinLevel[nCurFactor] + 1;
+    }
+
+    return WriteBinarySuite(szPath, rgMinLevel, rgNumLevels, nT, lstTestSuite, 
+                            system.get_Seed( ), szEngine, nRepetitions);
+}
+
+bool
+WriteBinarySuite(const TCHAR* szPath, const std::vector<LEVEL_T>& rgMinLevel, 
+                 const std::vector<LEVEL_T>& rgNumLevels, WORD nT,
+                 const std::list<CTestCase>& lstTestSuite, QWORD nSeed,
+                 const char* szEngine, DWORD nRepetitions)
+{
+    size_t nNumFactors = rgMinLevel.size( );
+    bool   bDontCare   = false;
+
+    for (auto& it : lstTestSuite)
+    {
+        if (it.GetNumValidFactors( ) < nNumFactors)
+        {
+            bDontCare = true;
+            break;
+        }
+    }
+
+    BINARY_SUITE_HEADER              hdr = { };
+    std::vector<BINARY_SUITE_FACTOR> rgFactors(nNumFactors);
+    size_t                           nRowBits = 0;
+
+    for (size_t nCurFactor = 0; nCurFactor < nNumFactors; nCurFactor++)
+    {
+        BINARY_SUITE_FACTOR& factor = rgFactors[nCurFactor];
+
+        factor.nMinLevel  = rgMinLevel [nCurFactor];
+        factor.nNumLevels = rgNumLevels[nCurFactor];
+        factor.nBits      = std::max<BYTE>(GetBitWidth(factor.nNumLevels + (bDontCare ? 1 : 0)), 1);
+
+        nRowBits += factor.nBits;
+    }
+
+    hdr.dwMagic      = BINARY_SUITE_MAGIC;
+    hdr.nVersion     = BINARY_SUITE_VERSION;
+    hdr.nT           = nT;
+    hdr.nNumFactors  = static_cast<DWORD>(nNumFactors);
+    hdr.dwFlags      = bDontCare ? BINARY_SUITE_DONT_CARE : 0;
+    hdr.nNumRows     = lstTestSuite.size( );
+    hdr.nSeed        = nSeed;
+    hdr.cbRow        = static_cast<DWORD>((nRowBits + 7) / 8);
+    hdr.nRepetitions = nRepetitions;
+    strncpy(hdr.szEngine, szEngine, sizeof(hdr.szEngine) - 1);
+
+    // the header and factor entries are encoded field by field, so the file
+    // is little endian whatever the host
+    std::vector<BYTE> rgPrefix(sizeof(BINARY_SUITE_HEADER) + nNumFactors * sizeof(BINARY_SUITE_FACTOR));
+
+    EncodeHeader(hdr, rgPrefix.data());
+
+    for (size_t nCurFactor = 0; nCurFactor < nNumFactors; nCurFactor++)
+        EncodeFactor(rgFactors[nCurFactor], 
+                     &rgPrefix[sizeof(BINARY_SUITE_HEADER) + nCurFactor * sizeof(BINARY_SUITE_FACTOR)]);
+
+    FILE* pFile = _tfopen(szPath, _T("wb"));
+
+    if (pFile == nullptr)
+        return false;
+
+    bool bResult = (fwrite(rgPrefix.data(), 1, rgPrefix.size(), pFile) == rgPrefix.size());
+
+    // rows are packed a buffer at a time
+    constexpr const size_t ROWS_PER_WRITE = 4096;
+
+    std::vector<BYTE> rgBuffer(ROWS_PER_WRITE * hdr.cbRow);
+    size_t            nBuffered = 0;
+
+    for (auto it = lstTestSuite.begin(); bResult && (it != lstTestSuite.end()); )
+    {
+        BYTE*  pRow = &rgBuffer[nBuffered * hdr.cbRow];
+        size_t nBit = 0;
+
+        std::memset(pRow, 0, hdr.cbRow);
+
+        for (size_t nCurFactor = 0; nCurFactor < nNumFactors; nCurFactor++)
+        {
+            const BINARY_SUITE_FACTOR& factor = rgFactors[nCurFactor];
+
+            LEVEL_T nLevel = (*it)[nCurFactor];
+            QWORD   qCode  = IsValidLevel(nLevel) ? (nLevel - factor.nMinLevel) : factor.nNumLevels;
+
+            for (BYTE b = 0; b < factor.nBits; b++, nBit++)
+            {
+                if (qCode & (static_cast<QWORD>(1) << b))
+                    pRow[nBit / 8] |= static_cast<BYTE>(1 << (nBit % 8));
+            }
+        }
+
+        ++it;
+        if ((++nBuffered == ROWS_PER_WRITE) || (it == lstTestSuite.end()))
+        {
+            bResult   = (fwrite(rgBuffer.data(), hdr.cbRow, nBuffered, pFile) == nBuffered);
+            nBuffered = 0;
+        }
+    }
+
+    return (fclose(pFile) == 0) && bResult;
+}
+
+size_t
+CTestCaseView::GetNumValidFactors(void) const noexcept
+{
+    size_t nResult = 0;
+    size_t nSize   = get_Size( );
+
+    for (size_t i = 0; i < nSize; i++)
+    {
+        if (IsValidLevel(operator[](i)))
+            nResult++;
+    }
+    return nResult;
+}
+
+void
+CTestCaseView::ToTestCase(CTestCase& TestCase) const
+{
+    size_t nSize = get_Size( );
+
+    TestCase.Init(nSize);
+
+    for (size_t i = 0; i < nSize; i++)
+        TestCase[i] = operator[](i);
+}
+
+bool
+CBinarySuiteReader::IsBinarySuite(const TCHAR* szPath)
+{
+    bool  bResult    = false;
+    BYTE  rgMagic[4] = { 0 };
+    FILE* pFile      = _tfopen(szPath, _T("rb"));
+
+    if (pFile)
+    {
+        bResult = (fread(rgMagic, sizeof(rgMagic), 1, pFile) == 1) && 
+                  (GetLittleEndian(rgMagic, sizeof(rgMagic)) == BINARY_SUITE_MAGIC);
+        fclose(pFile);
+    }
+
+    return bResult;
+}
+
+bool
+CBinarySuiteReader::Open(const TCHAR* szPath)
+{
+    Close( );
+
+    if (m_File.Open(szPath) == false)
+        return false;
+
+    const BYTE* pData  = static_cast<const BYTE*>(m_File.get_Data( ));
+    size_t      cbData = m_File.get_Size( );
+
+    if (cbData < sizeof(BINARY_SUITE_HEADER))
+    {
+        Close( );
+        return false;
+    }
+
+    BINARY_SUITE_HEADER hdr = { };
+
+    DecodeHeader(pData, hdr);
+
+    size_t cbFactors = static_cast<size_t>(hdr.nNumFactors) * sizeof(BINARY_SUITE_FACTOR);
+
+    if ((hdr.dwMagic  != BINARY_SUITE_MAGIC)   || 
+        (hdr.nVersion != BINARY_SUITE_VERSION) ||
+        (cbData < sizeof(BINARY_SUITE_HEADER) + cbFactors) ||
+        ((cbData - sizeof(BINARY_SUITE_HEADER) - cbFactors) / (hdr.cbRow ? hdr.cbRow : 1) 
+            < hdr.nNumRows))
+    {
+        Close( );
+        return false;
+    }
+
+    m_rgMinLevel.resize(hdr.nNumFactors);
+    m_rgNumLevels.resize(hdr.nNumFactors);
+    m_rgBitOffset.resize(hdr.nNumFactors);
+    m_rgBits.resize(hdr.nNumFactors);
+
+    size_t nBitOffset = 0;
+
+    for (DWORD nCurFactor = 0; nCurFactor < hdr.nNumFactors; nCurFactor++)
+    {
+        BINARY_SUITE_FACTOR factor = { };
+
+        DecodeFactor(pData + sizeof(BINARY_SUITE_HEADER) + nCurFactor * sizeof(BINARY_SUITE_FACTOR), factor);
+
+        // a cell is decoded from a single QWORD, so a width of 0 or beyond 
+        // what a level count could need is a damaged file
+        if ((factor.nBits == 0) || (factor.nBits > MAX_BINARY_SUITE_BITS))
+        {
+            Close( );
+            return false;
+        }
+
+        m_rgMinLevel [nCurFactor] = factor.nMinLevel;
+        m_rgNumLevels[nCurFactor] = factor.nNumLevels;
+        m_rgBitOffset[nCurFactor] = nBitOffset;
+        m_rgBits     [nCurFactor] = factor.nBits;
+
+        nBitOffset += factor.nBits;
+    }
+
+    if ((nBitOffset + 7) / 8 > hdr.cbRow)
+    {
+        Close( );
+        return false;
+    }
+
+    m_Header = hdr;
+    m_pRows  = pData + sizeof(BINARY_SUITE_HEADER) + cbFactors;
+
+    return true;
+}
+
+void
+CBinarySuiteReader::Close(void) noexcept
+{
+    m_File.Close( );
+
+    m_Header = BINARY_SUITE_HEADER();
+    m_pRows  = nullptr;
+
+    m_rgMinLevel.clear();
+    m_rgNumLevels.clear();
+    m_rgBitOffset.clear();
+    m_rgBits.clear();
+}
+
+LEVEL_T
+CBinarySuiteReader::GetLevel(size_t nRow, size_t nFactor) const noexcept
+{
+    size_t      nBit   = m_rgBitOffset[nFactor];
+    BYTE        nBits  = m_rgBits[nFactor];
+    const BYTE* pByte  = m_pRows + nRow * m_Header.cbRow + nBit / 8;
+    size_t      nShift = nBit % 8;
+    size_t      nBytes = (nShift + nBits + 7) / 8;
+    QWORD       qCode  = 0;
+
+    for (size_t i = 0; i < nBytes; i++)
+        qCode |= static_cast<QWORD>(pByte[i]) << (8 * i);
+
+    qCode = (qCode >> nShift) & ((static_cast<QWORD>(1) << nBits) - 1);
+
+    return (qCode < m_rgNumLevels[nFactor]) ? 
+           static_cast<LEVEL_T>(m_rgMinLevel[nFactor] + qCode) : LEVEL_INVALID;
+}
@@ -0,0 +1,279 @@
+/**
+ *  @file       BinarySuite.h
+ *  @brief      Binary covering array format and its memory mapped reader
+ *
+ *  Provides type definitions for: BINARY_SUITE_HEADER, BINARY_SUITE_FACTOR,
+ *  CTestCaseView, CBinarySuiteReader
+ *
+ *  @author     Mark L. Short
+ *  @date       October 18, 2026
+ */
+#pragma once
+
+#if !defined(__BINARY_SUITE_H__)
+#define __BINARY_SUITE_H__
+
+#ifndef __COMMON_DEF_H__
+    #include "CommonDef.h"
+#endif
+
+#ifndef _LIST_
+    #include <list>
+#endif
+
+#ifndef _VECTOR_
+    #include <vector>
+#endif
+
+#ifndef __TEST_CASE_H__
+    #include "TestCase.h"
+#endif
+
+#ifndef __MAPPED_FILE_H__
+    #include "MappedFile.h"
+#endif
+
+// forward declarations
+class CComponentSystem;
+class CBinarySuiteReader;
+
+/// file signature, "AETB" when read as bytes
+constexpr const DWORD BINARY_SUITE_MAGIC     = 0x42544541;
+
+/// current version of the binary layout
+constexpr const WORD  BINARY_SUITE_VERSION   = 1;
+
+/// set when cells may hold a don't-care, encoded as the factor's level count
+constexpr const DWORD BINARY_SUITE_DONT_CARE = 0x00000001;
+
+/// widest cell, a level count of LEVEL_T plus the don't-care
+constexpr const BYTE  MAX_BINARY_SUITE_BITS  = 8 * sizeof(LEVEL_T) + 1;
+
+/**
+  @brief  Fixed size header at the start of a binary suite file
+
+  All fields are little endian.  The header is followed by nNumFactors 
+  BINARY_SUITE_FACTOR entries and then nNumRows rows of cbRow bytes each.  
+  Within a row, each factor's zero based level occupies nBits bits, packed
+  least significant bit first in factor order.
+*/
+struct BINARY_SUITE_HEADER
+{
+    DWORD  dwMagic;        ///< BINARY_SUITE_MAGIC
+    WORD   nVersion;       ///< BINARY_SUITE_VERSION
+    WORD   nT;             ///< interaction strength the suite was generated for
+    DWORD  nNumFactors;    ///< number of factors, k
+    DWORD  dwFlags;        ///< combination of BINARY_SUITE_xxx flags
+    QWORD  nNumRows;       ///< number of rows
+    QWORD  nSeed;          ///< random seed the suite was generated with
+    DWORD  cbRow;          ///< bytes per packed row
+    DWORD  nRepetitions;   ///< number of generation repetitions
+    char   szEngine[8];    ///< generation engine name, zero terminated
+};
+
+static_assert(sizeof(BINARY_SUITE_HEADER) == 48, "unexpected binary suite header size");
+
+/**
+  @brief  Per-factor entry of a binary suite file
+*/
+struct BINARY_SUITE_FACTOR
+{
+    WORD   nMinLevel;      ///< global id of the factor's first level
+    WORD   nNumLevels;     ///< number of levels, v
+    BYTE   nBits;          ///< bits per cell, ceil(log2 v), one more if needed for don't-care,
+                           ///< and at least 1
+    BYTE   rgReserved[3];  ///< zero
+};
+
+static_assert(sizeof(BINARY_SUITE_FACTOR) == 8, "unexpected binary suite factor size");
+
+/**
+  @brief  Writes a suite in the binary format
+
+  @param [in] szPath         destination path
+  @param [in] system         CComponentSystem the suite was generated for
+  @param [in] nT             interaction strength
+  @param [in] lstTestSuite   the test cases
+  @param [in] szEngine       generation engine name, up to 8 characters
+  @param [in] nRepetitions   number of generation repetitions
+
+  @retval true               on success
+  @retval false              on error
+*/
+bool WriteBinarySuite(const TCHAR* szPath, const CComponentSystem& system, WORD nT,
+                      const std::list<CTestCase>& lstTestSuite, 
+                      const char* szEngine, DWORD nRepetitions);
+
+/**
+  @brief  Writes a suite in the binary format, from explicit level ranges
+
+  @param [in] szPath         destination path
+  @param [in] rgMinLevel     minimum level, indexed by factor
+  @param [in] rgNumLevels    number of levels, indexed by factor
+  @param [in] nT             interaction strength
+  @param [in] lstTestSuite   the test cases
+  @param [in] nSeed          random seed the suite was generated with
+  @param [in] szEngine       generation engine name, up to 8 characters
+  @param [in] nRepetitions   number of generation repetitions
+
+  @retval true               on success
+  @retval false              on error
+*/
+bool WriteBinarySuite(const TCHAR* szPath, const std::vector<LEVEL_T>& rgMinLevel, 
+                      const std::vector<LEVEL_T>& rgNumLevels, WORD nT,
+                      const std::list<CTestCase>& lstTestSuite, QWORD nSeed,
+                      const char* szEngine, DWORD nRepetitions);
+
+/**
+  @brief  A zero-copy view of a single row of a CBinarySuiteReader
+
+  Offers the read-only accessors of CTestCase, decoding each cell from the 
+  mapped file on demand.
+*/
+class CTestCaseView
+{
+    const CBinarySuiteReader* m_pReader;  ///< owning reader
+    size_t                    m_nRow;     ///< row index
+
+public:
+    /// Constructor
+    CTestCaseView(const CBinarySuiteReader& reader, size_t nRow) noexcept
+        : m_pReader(&reader),
+          m_nRow(nRow)
+    { };
+
+/**
+  @brief  Returns the global level of a factor, or LEVEL_INVALID for a 
+          don't-care cell
+*/
+    inline LEVEL_T operator[](size_t nFactor) const noexcept;
+
+/**
+  @brief  Returns the number of factors in the row
+*/
+    inline size_t  get_Size(void) const noexcept;
+
+/**
+  @brief  Returns the number of cells holding a valid level
+*/
+    size_t         GetNumValidFactors(void) const noexcept;
+
+/**
+  @brief  Copies the row into a CTestCase
+
+  @param [out] TestCase      the destination CTestCase object
+*/
+    void           ToTestCase(CTestCase& TestCase) const;
+};
+
+/**
+  @brief  A memory mapped reader of binary suite files
+
+  The file is mapped rather than read, so any row of an arbitrarily large 
+  suite can be accessed in constant time without loading the rest of it.
+*/
+class CBinarySuiteReader
+{
+    CMappedFile                  m_File;         ///< the mapped suite file
+    BINARY_SUITE_HEADER          m_Header;       ///< header, decoded from the mapping
+    const BYTE*                  m_pRows;        ///< first packed row, within the mapping, or 
+                                                 ///< nullptr when closed
+    std::vector<LEVEL_T>         m_rgMinLevel;   ///< minimum level, indexed by factor
+    std::vector<LEVEL_T>         m_rgNumLevels;  ///< number of levels, indexed by factor
+    std::vector<size_t>          m_rgBitOffset;  ///< first bit of each factor within a row
+    std::vector<BYTE>            m_rgBits;       ///< bits per cell, indexed by factor
+
+public:
+    /// Default Constructor
+    CBinarySuiteReader() noexcept
+        : m_File(),
+          m_Header(),
+          m_pRows(nullptr),
+          m_rgMinLevel(),
+          m_rgNumLevels(),
+          m_rgBitOffset(),
+          m_rgBits()
+    { };
+
+/**
+  @brief  Maps and validates a binary suite file
+
+  @param [in] szPath         path of the file
+
+  @retval true               on success
+  @retval false              if the file could not be mapped or is not a 
+                             valid binary suite
+*/
+    bool    Open(const TCHAR* szPath);
+
+/**
+  @brief  Unmaps the file
+*/
+    void    Close(void) noexcept;
+
+/**
+  @brief  Tests whether a file starts with the binary suite signature
+
+  @param [in] szPath         path of the file
+
+  @retval true               if the file appears to be a binary suite
+  @retval false              otherwise
+*/
+    static bool IsBinarySuite(const TCHAR* szPath);
+
+/**
+  @brief  Decodes a single cell
+
+  @param [in] nRow           row index, [0 .. get_NumRows() - 1]
+  @param [in] nFactor        factor index, [0 .. get_NumFactors() - 1]
+
+  @retval LEVEL_T            containing the global level, or LEVEL_INVALID 
+                             for a don't-care cell
+*/
+    LEVEL_T GetLevel(size_t nRow, size_t nFactor) const noexcept;
+
+/**
+  @brief  Returns a zero-copy view of a row
+
+  @param [in] nRow           row index, [0 .. get_NumRows() - 1]
+
+  @retval CTestCaseView      referring to the row
+*/
+    inline CTestCaseView GetRow(size_t nRow) const noexcept
+    { return CTestCaseView(*this, nRow); };
+
+// Primitive data accessors
+/// Returns the number of rows
+    inline size_t   get_NumRows(void) const noexcept
+    { return m_pRows ? static_cast<size_t>(m_Header.nNumRows) : 0; };
+
+/// Returns the number of factors
+    inline FACTOR_T get_NumFactors(void) const noexcept
+    { return static_cast<FACTOR_T>(m_rgBits.size()); };
+
+/// Returns the interaction strength the suite was generated for
+    inline WORD     get_T(void) const noexcept
+    { return m_pRows ? m_Header.nT : 0; };
+
+/// Returns the random seed the suite was generated with
+    inline QWORD    get_Seed(void) const noexcept
+    { return m_pRows ? m_Header.nSeed : 0; };
+
+/// Returns the minimum level of a factor
+    inline LEVEL_T  GetMinLevel(size_t nFactor) const noexcept
+    { return m_rgMinLevel[nFactor]; };
+
+/// Returns the number of levels of a factor
+    inline LEVEL_T  GetNumLevels(size_t nFactor) const noexcept
+    { return m_rgNumLevels[nFactor]; };
+};
+
+inline LEVEL_T
+CTestCaseView::operator[](size_t nFactor) const noexcept
+{ return m_pReader->GetLevel(m_nRow, nFactor); }
+
+inline size_t
+CTestCaseView::get_Size(void) const noexcept
+{ return m_pReader->get_NumFactors( ); }
+
+#endif
@@ -0,0 +1,348 @@
+/**
+ *  @file       Checkpoint.cpp
+ *  @brief      Checkpoints of long running generations
+ *  @author     Mark L. Short
+ *  @date       October 18, 2026
+ */
+
+#include "stdafx.h"
+
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+
+#include "Checkpoint.h"
+
+namespace fs = std::filesystem;
+
+/// identifies a checkpoint file, at its start and again at its end
+constexpr const QWORD  CHECKPOINT_MAGIC       = 0x31504B4347544541ull;   // "AETGCKP1"
+
+/// suffix of a checkpoint being written
+constexpr const TCHAR* CHECKPOINT_PARTIAL_EXT = _T(".partial");
+
+/**
+  @brief  Sequential writes of a checkpoint file, remembering the first failure
+*/
+struct CHECKPOINT_OUT
+{
+    FILE*  pFile;       ///< the file
+    bool   bResult;     ///< false once a write has failed
+
+    void Bytes(const void* pData, size_t cbData)
+    {
+        if (bResult && (cbData > 0))
+            bResult = (fwrite(pData, 1, cbData, pFile) == cbData);
+    }
+
+    void Word(QWORD qWord)
+    { Bytes(&qWord, sizeof(qWord)); }
+
+    void Real(double dValue)
+    {
+        QWORD qWord = 0;
+        memcpy(&qWord, &dValue, sizeof(qWord));
+        Word(qWord);
+    }
+
+    void String(const std::string& str)
+    {
+        Word(str.size());
+        Bytes(str.data(), str.size());
+    }
+
+    void Sizes(const std::vector<size_t>& rgSizes)
+    {
+        Word(rgSizes.size());
+        for (size_t n : rgSizes)
+            Word(n);
+    }
+
+    void Words(const std::vector<QWORD>& rgWords)
+    {
+        Word(rgWords.size());
+        Bytes(rgWords.data(), rgWords.size() * sizeof(QWORD));
+    }
+
+    void Rows(const std::list<CTestCase>& lstRows)
+    {
+        Word(lstRows.size());
+        for (const auto& it : lstRows)
+        {
+            Word(it.get_Size());
+            for (size_t f = 0; f < it.get_Size(); f++)
+                Bytes(&it[f], sizeof(LEVEL_T));
+        }
+    }
+};
+
+/**
+  @brief  Sequential reads of a checkpoint file, remembering the first failure
+
+  Every count is checked against the bytes remaining, so that a damaged file
+  can't call for more memory than its own size.
+*/
+struct CHECKPOINT_IN
+{
+    FILE*  pFile;       ///< the file
+    QWORD  cbRemaining; ///< bytes not yet read
+    bool   bResult;     ///< false once a read has failed
+
+    void Bytes(void* pData, size_t cbData)
+    {
+        if (bResult && (cbData > 0))
+        {
+            bResult = (cbData <= cbRemaining) && (fread(pData, 1, cbData, pFile) == cbData);
+            cbRemaining -= bResult ? cbData : 0;
+        }
+    }
+
+    QWORD Word(void)
+    {
+        QWORD qWord = 0;
+        Bytes(&qWord, sizeof(qWord));
+        return qWord;
+    }
+
+    double Real(void)
+    {
+        QWORD  qWord  = Word( );
+        double dValue = 0.0;
+        memcpy(&dValue, &qWord, sizeof(dValue));
+        return dValue;
+    }
+
+    size_t Count(size_t cbElement)
+    {
+        QWORD nCount = Word( );
+
+        if (bResult && (nCount > cbRemaining / cbElement))
+            bResult = false;
+
+        return bResult ? static_cast<size_t>(nCount) : 0;
+    }
+
+    void String(std::string& str)
+    {
+        str.resize(Count(1));
+        Bytes(&str[0], str.size());
+    }
+
+    void Sizes(std::vector<size_t>& rgSizes)
+    {
+        rgSizes.resize(Count(sizeof(QWORD)));
+        for (auto& it : rgSizes)
+            it = static_cast<size_t>(Word());
+    }
+
+    void Words(std::vector<QWORD>& rgWords)
+    {
+        rgWords.resize(Count(sizeof(QWORD)));
+        Bytes(rgWords.data(), rgWords.size() * sizeof(QWORD));
+    }
+
+    void Rows(std::list<CTestCase>& lstRows)
+    {
+        lstRows.clear( );
+
+        for (size_t nNumRows = Count(sizeof(QWORD)); bResult && (nNumRows > 0); nNumRows--)
+        {
+            CTestCase TestCase;
+            TestCase.Init(Count(sizeof(LEVEL_T)));
+
+            for (size_t f = 0; f < TestCase.get_Size(); f++)
+                Bytes(&TestCase[f], sizeof(LEVEL_T));
+
+            lstRows.push_back(TestCase);
+        }
+    }
+};
+
+bool WriteCheckpoint(const TCHAR* szPath, const CHECKPOINT& checkpoint)
+{
+    std::error_code ec;
+
+    fs::path pathPartial = szPath;
+    pathPartial += CHECKPOINT_PARTIAL_EXT;
+
+    FILE* pFile = _tfopen(pathPartial.c_str(), _T("wb"));
+
+    if (pFile == nullptr)
+        return false;
+
+    CHECKPOINT_OUT out = { pFile, true };
+
+    out.Word  (CHECKPOINT_MAGIC);
+    out.String(checkpoint.strKey);
+    out.Word  (checkpoint.nRepetitions);
+    out.Word  (checkpoint.nCompleted);
+    out.Word  (checkpoint.nBest);
+    out.Word  (checkpoint.nWorst);
+    out.Word  (checkpoint.nTotal);
+    out.Real  (checkpoint.dSeconds);
+    out.Rows  (checkpoint.lstBestTestSuite);
+    out.Sizes (checkpoint.rgBestCurve);
+    out.Word  (checkpoint.nBestUnresolved);
+    out.String(checkpoint.strRandomState);
+    out.Word  (checkpoint.bInProgress ? 1 : 0);
+
+    if (checkpoint.bInProgress)
+    {
+        const GENERATION_STATE& state = checkpoint.State;
+
+        out.Real (checkpoint.dCurSeconds);
+        out.Rows (state.lstTestSuite);
+        out.Sizes(state.rgCoverageCurve);
+        out.Sizes(state.rgLevelCount);
+        out.Sizes(state.rgNumUncovered);
+        out.Word (state.nNumUnresolved);
+        out.Word (state.rgRuns.size());
+
+        for (const auto& it : state.rgRuns)
+            out.Words(it);
+    }
+
+    out.Word(CHECKPOINT_MAGIC);
+
+    bool bResult = (fclose(pFile) == 0) && out.bResult;
+
+    if (bResult)
+        fs::rename(pathPartial, szPath, ec);
+
+    if (!bResult || ec)
+    {
+        fs::remove(pathPartial, ec);
+        return false;
+    }
+
+    return true;
+}
+
+bool ReadCheckpoint(const TCHAR* szPath, CHECKPOINT& checkpoint)
+{
+    std::error_code ec;
+
+    uintmax_t cbFile = fs::file_size(szPath, ec);
+
+    if (ec)
+        return false;
+
+    FILE* pFile = _tfopen(szPath, _T("rb"));
+
+    if (pFile == nullptr)
+        return false;
+
+    CHECKPOINT_IN in = { pFile, static_cast<QWORD>(cbFile), true };
+
+    bool bResult = (in.Word() == CHECKPOINT_MAGIC);
+
+    if (bResult)
+    {
+        in.String(checkpoint.strKey);
+        checkpoint.nRepetitions = static_cast<DWORD>(in.Word());
+        checkpoint.nCompleted   = static_cast<DWORD>(in.Word());
+        checkpoint.nBest        = static_cast<size_t>(in.Word());
+        checkpoint.nWorst       = static_cast<size_t>(in.Word());
+        checkpoint.nTotal       = static_cast<size_t>(in.Word());
+        checkpoint.dSeconds     = in.Real( );
+        in.Rows  (checkpoint.lstBestTestSuite);
+        in.Sizes (checkpoint.rgBestCurve);
+        checkpoint.nBestUnresolved = static_cast<size_t>(in.Word());
+        in.String(checkpoint.strRandomState);
+        checkpoint.bInProgress  = (in.Word() != 0);
+        checkpoint.dCurSeconds  = 0.0;
+        checkpoint.State        = GENERATION_STATE();
+
+        if (checkpoint.bInProgress)
+        {
+            GENERATION_STATE& state = checkpoint.State;
+
+            checkpoint.dCurSeconds = in.Real( );
+            in.Rows (state.lstTestSuite);
+            in.Sizes(state.rgCoverageCurve);
+            in.Sizes(state.rgLevelCount);
+            in.Sizes(state.rgNumUncovered);
+            state.nNumUnresolved = static_cast<size_t>(in.Word());
+            state.rgRuns.resize(in.Count(sizeof(QWORD)));
+
+            for (auto& it : state.rgRuns)
+                in.Words(it);
+        }
+
+        bResult = (in.Word() == CHECKPOINT_MAGIC) && in.bResult && (in.cbRemaining == 0);
+    }
+
+    fclose(pFile);
+
+    return bResult;
+}
+
+bool
+CCheckpointWriter::Start(const TCHAR* szPath)
+{
+    if (IsStarted())
+        return false;
+
+    m_strPath = szPath;
+    m_bStop   = false;
+    m_thread  = std::thread(&CCheckpointWriter::Run, this);
+
+    return true;
+}
+
+void
+CCheckpointWriter::Post(std::unique_ptr<CHECKPOINT> pCheckpoint)
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mtx);
+        m_pPending = std::move(pCheckpoint);
+    }
+    m_cv.notify_one( );
+}
+
+void
+CCheckpointWriter::Stop(bool bDiscard)
+{
+    if (IsStarted() == false)
+        return;
+
+    {
+        std::lock_guard<std::mutex> lock(m_mtx);
+
+        if (bDiscard)
+            m_pPending.reset( );
+
+        m_bStop = true;
+    }
+    m_cv.notify_one( );
+    m_thread.join( );
+
+    if (bDiscard)
+    {
+        std::error_code ec;
+        fs::remove(m_strPath, ec);
+    }
+}
+
+void
+CCheckpointWriter::Run(void)
+{
+    for (;;)
+    {
+        std::unique_ptr<CHECKPOINT> pCheckpoint;
+
+        {
+            std::unique_lock<std::mutex> lock(m_mtx);
+            m_cv.wait(lock, [this] { return m_bStop || m_pPending; });
+
+            if (m_pPending == nullptr)
+                break;
+
+            pCheckpoint = std::move(m_pPending);
+        }
+
+        // a failed write leaves the previous checkpoint, and generation
+        // carries on regardless
+        WriteCheckpoint(m_strPath.c_str(), *pCheckpoint);
+    }
+}
@@ -0,0 +1,179 @@
+/**
+ *  @file       Checkpoint.h
+ *  @brief      Checkpoints of long running generations
+ *
+ *  Provides type definitions for: CHECKPOINT, CCheckpointWriter
+ *
+ *  @author     Mark L. Short
+ *  @date       October 18, 2026
+ */
+#pragma once
+
+#if !defined(__CHECKPOINT_H__)
+#define __CHECKPOINT_H__
+
+#ifndef __COMMON_DEF_H__
+    #include "CommonDef.h"
+#endif
+
+#ifndef _CONDITION_VARIABLE_
+    #include <condition_variable>
+#endif
+
+#ifndef _LIST_
+    #include <list>
+#endif
+
+#ifndef _MEMORY_
+    #include <memory>
+#endif
+
+#ifndef _MUTEX_
+    #include <mutex>
+#endif
+
+#ifndef _STRING_
+    #include <string>
+#endif
+
+#ifndef _THREAD_
+    #include <thread>
+#endif
+
+#ifndef _VECTOR_
+    #include <vector>
+#endif
+
+#ifndef __TEST_SUITE_H__
+    #include "TestSuite.h"
+#endif
+
+/**
+  @brief  The progress of a run of repetitions, from which it can be resumed
+
+  A checkpoint taken between repetitions holds the figures of those completed
+  and the best suite among them.  One taken part way through a repetition
+  also holds the state of its generation.  Either way, the random engine's
+  state is that of the point the checkpoint was taken at, so that a resumed
+  run draws the same numbers as the original would have.
+*/
+struct CHECKPOINT
+{
+    std::string           strKey;           ///< identifies the model, engine and options
+    DWORD                 nRepetitions;     ///< repetitions of the run
+    DWORD                 nCompleted;       ///< repetitions completed
+    size_t                nBest;            ///< rows of the smallest suite, 0 if none
+    size_t                nWorst;           ///< rows of the largest suite
+    size_t                nTotal;           ///< rows summed over the completed repetitions
+    double                dSeconds;         ///< generation time summed over them
+    std::list<CTestCase>  lstBestTestSuite; ///< the smallest suite
+    std::vector<size_t>   rgBestCurve;      ///< its coverage curve
+    size_t                nBestUnresolved;  ///< its unresolved tuples
+    std::string           strRandomState;   ///< state of the system's random engine
+    bool                  bInProgress;      ///< true if State holds the repetition in progress
+    double                dCurSeconds;      ///< generation time of that repetition so far
+    GENERATION_STATE      State;            ///< the generation of that repetition
+};
+
+/**
+  @brief  Writes a checkpoint to a file
+
+  The checkpoint is written in full under a temporary name, then renamed over
+  the file in a single step, so that the file always holds a whole checkpoint.
+
+  @param [in] szPath         path of the file
+  @param [in] checkpoint     the checkpoint
+
+  @retval true               on success
+  @retval false              on error, the file being left as it was
+*/
+bool WriteCheckpoint(const TCHAR* szPath, const CHECKPOINT& checkpoint);
+
+/**
+  @brief  Reads a checkpoint written by WriteCheckpoint
+
+  @param [in]  szPath        path of the file
+  @param [out] checkpoint    the checkpoint
+
+  @retval true               on success
+  @retval false              if the file is missing, malformed or truncated
+*/
+bool ReadCheckpoint(const TCHAR* szPath, CHECKPOINT& checkpoint);
+
+/**
+  @brief  Writes checkpoints to a file on a thread of its own
+
+  The generating thread only captures a checkpoint and posts it; the writer
+  thread then writes it out while generation carries on.  Should a
+  checkpoint be posted before the previous one has been written, the
+  previous one is dropped in its favor.
+*/
+class CCheckpointWriter
+{
+    std::basic_string<TCHAR>     m_strPath;   ///< path of the checkpoint file
+    std::thread                  m_thread;    ///< the writer thread
+    std::mutex                   m_mtx;       ///< guards m_pPending and m_bStop
+    std::condition_variable      m_cv;        ///< signals a posted checkpoint or a stop
+    std::unique_ptr<CHECKPOINT>  m_pPending;  ///< the checkpoint to be written next
+    bool                         m_bStop;     ///< set to stop the writer thread
+
+public:
+    /// Default Constructor
+    CCheckpointWriter() noexcept
+        : m_strPath(),
+          m_thread(),
+          m_mtx(),
+          m_cv(),
+          m_pPending(),
+          m_bStop(false)
+    { };
+
+    /// Destructor, writes any pending checkpoint
+    ~CCheckpointWriter()
+    { Stop(false); };
+
+    CCheckpointWriter(const CCheckpointWriter&)            = delete;
+    CCheckpointWriter& operator=(const CCheckpointWriter&) = delete;
+
+/**
+  @brief  Starts the writer thread
+
+  @param [in] szPath         path of the checkpoint file
+
+  @retval true               on success
+  @retval false              if the writer is already started
+*/
+    bool   Start(const TCHAR* szPath);
+
+/**
+  @brief  Hands a checkpoint to the writer thread
+
+  @param [in] pCheckpoint    the checkpoint
+*/
+    void   Post(std::unique_ptr<CHECKPOINT> pCheckpoint);
+
+/**
+  @brief  Stops the writer thread once any pending checkpoint is written
+
+  @param [in] bDiscard       true to drop any pending checkpoint and delete
+                             the file, the run being complete
+*/
+    void   Stop(bool bDiscard);
+
+// Primitive data accessors
+/**
+  @brief  Indicates whether the writer thread is running
+
+  @retval bool               true if started
+*/
+    inline bool   IsStarted(void) const noexcept
+    { return m_thread.joinable(); };
+
+private:
+/**
+  @brief  Body of the writer thread
+*/
+    void   Run(void);
+};
+
+#endif
@@ -16,6 +16,7 @@
 typedef unsigned __int8  BYTE;   ///< 8-bit unsigned type
 typedef unsigned __int16 WORD;   ///< 16-bit unsigned type
 typedef unsigned __int32 DWORD;  ///< 32-bit unsigned type
+typedef unsigned __int64 QWORD;  ///< 64-bit unsigned type
 
 typedef WORD           FACTOR_T; ///< factor value type
 typedef WORD           LEVEL_T;  ///< level value type
@@ -9,33 +9,56 @@
 
 #include <random>
 #include <algorithm>
+#include <sstream>
 #include "MathUtility.h"
 
 #include "ComponentSystem.h"
 
-std::random_device g_rd;       ///< used to generate a 32-bit seed
-std::mt19937       g_mt;       ///< the Mersenne Twister engine
-
 
 bool
 CComponentSystem::Init(FACTOR_T nNumFactors, LEVEL_T nNumLevels)
+{ 
+    return Init(std::vector<LEVEL_T>(nNumFactors, nNumLevels));
+};
+
+bool
+CComponentSystem::Init(const std::vector<LEVEL_T>& rgNumLevels)
 { 
     bool bResult = false;
 
-    g_mt.seed(g_rd()); // Initialize the Mersenne Twister engine
+    SetSeed(std::random_device()()); // Initialize the Mersenne Twister engine
+
+    m_Constraints.Clear();
+    m_rgRelations.clear();
+    m_nStrength = DEFAULT_T_WAY;
+
+    // the global levels must stay below LEVEL_INVALID
+    size_t nTotalLevels = 0;
+    for (auto nNumLevels : rgNumLevels)
+        nTotalLevels += nNumLevels;
 
-    if (( nNumFactors > 0 ) && ( nNumLevels > 0 ))
+    if (( rgNumLevels.size() > 0 ) && ( rgNumLevels.size() < FACTOR_INVALID ) && 
+        ( nTotalLevels < LEVEL_INVALID ) &&
+        ( std::find(rgNumLevels.begin(), rgNumLevels.end(), 0) == rgNumLevels.end() ))
     {
-        m_nNumFactors = nNumFactors;
-        m_nNumLevels  = nNumLevels;
+        m_nNumFactors = static_cast<FACTOR_T>(rgNumLevels.size());
+        m_nNumLevels  = *std::max_element(rgNumLevels.begin(), rgNumLevels.end());
         m_rgFactors.resize(m_nNumFactors); 
+        m_rgLevelFactor.resize(nTotalLevels);
 
-        for (int nCurFactor = 0; nCurFactor < nNumFactors; nCurFactor++)
+        LEVEL_T nMinLevel = 0;
+
+        for (FACTOR_T nCurFactor = 0; nCurFactor < m_nNumFactors; nCurFactor++)
         {
-            LEVEL_T nMinLevel = static_cast<LEVEL_T>(nCurFactor * nNumLevels);
-            LEVEL_T nMaxLevel = nMinLevel + nNumLevels - 1;
+            LEVEL_T nMaxLevel = nMinLevel + rgNumLevels[nCurFactor] - 1;
 
             SetLevelRange(nCurFactor, nMinLevel, nMaxLevel);
+
+            // a direct lookup keeps GetFactor constant time
+            std::fill(m_rgLevelFactor.begin() + nMinLevel, 
+                      m_rgLevelFactor.begin() + nMaxLevel + 1, nCurFactor);
+
+            nMinLevel = nMaxLevel + 1;
         }
         bResult = true;
     }
@@ -76,6 +99,17 @@ CComponentSystem::GetMaxLevel(FACTOR_T nFactor) const noexcept
     return nResult;
 };
 
+LEVEL_T 
+CComponentSystem::GetNumLevels(FACTOR_T nFactor) const noexcept
+{
+    LEVEL_T nResult = 0;
+
+    if (nFactor < m_nNumFactors)
+        nResult = m_rgFactors[nFactor].get_MaxLevel( ) - m_rgFactors[nFactor].get_MinLevel( ) + 1;
+
+    return nResult;
+};
+
 LEVEL_T 
 CComponentSystem::GetMaxSystemLevel(void) const noexcept
 {
@@ -99,13 +133,13 @@ CComponentSystem::GetRandomLevel(FACTOR_T nFactor) const
         {
             std::uniform_int_distribution<LEVEL_T>      dist(m_rgFactors[nFactor].get_MinLevel(),
                                                              m_rgFactors[nFactor].get_MaxLevel());
-            nResult = dist(g_mt);
+            nResult = dist(m_mt);
         }
         else
         {
             std::uniform_int_distribution<unsigned int> dist(m_rgFactors[nFactor].get_MinLevel(),
                                                              m_rgFactors[nFactor].get_MaxLevel());
-            nResult = dist(g_mt);
+            nResult = dist(m_mt);
         }
     }
 
@@ -123,12 +157,12 @@ CComponentSystem::GetRandomFactor(void) const
         if (std::is_integral<LEVEL_T>::value && std::is_unsigned<LEVEL_T>::value)
         {
             std::uniform_int_distribution<LEVEL_T>          dist(0, m_nNumFactors - 1);
-            nResult = dist(g_mt);
+            nResult = dist(m_mt);
         }
         else
         {
             std::uniform_int_distribution<unsigned int>     dist(0, m_nNumFactors - 1);
-            nResult = dist(g_mt);
+            nResult = dist(m_mt);
         }
     }
 
@@ -140,19 +174,8 @@ CComponentSystem::GetFactor(LEVEL_T nLevel) const noexcept
 {
     FACTOR_T nResult = FACTOR_INVALID;
 
-    if (m_nNumFactors > 0)
-    {
-        int iCtr = 0;
-        for (auto it = m_rgFactors.begin(); (it != m_rgFactors.end()) && 
-                                    (IsValidFactor(nResult) == false); ++it)
-        {
-            if ( it->IsInRange(nLevel) )
-            {
-                nResult = static_cast<FACTOR_T>(iCtr);
-            }
-            iCtr++;
-        }
-    }
+    if (nLevel < m_rgLevelFactor.size())
+        nResult = m_rgLevelFactor[nLevel];
 
     return nResult;
 }
@@ -170,7 +193,7 @@ CComponentSystem::GetShuffledFactors(std::vector<FACTOR_T>& vShuffledFactors) co
             vShuffledFactors[i] = i;
 
         // in-place shuffle the array using the Mersenne Twister engine
-        std::shuffle(vShuffledFactors.begin(), vShuffledFactors.end(), g_mt);
+        std::shuffle(vShuffledFactors.begin(), vShuffledFactors.end(), m_mt);
 
         nResult = vShuffledFactors.size();
     }
@@ -179,27 +202,178 @@ CComponentSystem::GetShuffledFactors(std::vector<FACTOR_T>& vShuffledFactors) co
 }
 
 size_t
-CComponentSystem::CalcNumberOfVariableCombinations(WORD nT) const
+CComponentSystem::GetRandomIndex(size_t nCount) const
 {
     size_t nResult = 0;
- 
-    ///  @todo following uses 20020 bytes of stack space
-    N_Choose_R<50> nChooseR;
 
-    nResult = nChooseR(m_nNumFactors, nT);
+    if (nCount > 1)
+    {
+        std::uniform_int_distribution<size_t> dist(0, nCount - 1);
+        nResult = dist(m_mt);
+    }
 
     return nResult;
 }
 
+void
+CComponentSystem::SetSeed(DWORD nSeed)
+{
+    m_nSeed = nSeed;
+    m_mt.seed(m_nSeed);
+}
+
+std::string
+CComponentSystem::GetRandomState(void) const
+{
+    std::ostringstream ss;
+
+    ss << m_mt;
+
+    return ss.str( );
+}
+
+bool
+CComponentSystem::SetRandomState(const std::string& strState)
+{
+    std::istringstream ss(strState);
+    std::mt19937       mt;
+
+    if (!(ss >> mt))
+        return false;
+
+    m_mt = mt;
+    return true;
+}
+
+bool
+CComponentSystem::AddForbiddenTuple(const std::vector<LEVEL_T>& rgLevels)
+{
+    bool bResult = false;
+
+    if ((rgLevels.empty() == false) && (rgLevels.size() <= m_nNumFactors))
+    {
+        std::vector<std::pair<FACTOR_T, LEVEL_T>> rgEntries;
+
+        for (auto nLevel : rgLevels)
+            rgEntries.emplace_back(GetFactor(nLevel), nLevel);
+
+        std::sort(rgEntries.begin(), rgEntries.end());
+
+        bResult = true;
+        for (size_t i = 0; (i < rgEntries.size()) && bResult; i++)
+        {
+            bResult = IsValidFactor(rgEntries[i].first) && 
+                      ((i == 0) || (rgEntries[i].first != rgEntries[i - 1].first));
+        }
+
+        if (bResult)
+        {
+            std::vector<FACTOR_T> rgFactors;
+            std::vector<LEVEL_T>  rgSorted;
+
+            for (auto& it : rgEntries)
+            {
+                rgFactors.push_back(it.first);
+                rgSorted.push_back(it.second);
+            }
+
+            m_Constraints.Add(rgFactors.data(), rgSorted.data(), rgEntries.size());
+            m_Constraints.Compile(m_nNumFactors, GetMaxSystemLevel());
+        }
+    }
+
+    return bResult;
+}
+
+bool
+CComponentSystem::SetStrength(WORD nT) noexcept
+{
+    bool bResult = false;
+
+    if ((nT > 0) && (nT <= m_nNumFactors))
+    {
+        m_nStrength = nT;
+        bResult     = true;
+    }
+
+    return bResult;
+}
+
+bool
+CComponentSystem::AddRelation(const std::vector<FACTOR_T>& rgFactors, WORD nT)
+{
+    STRENGTH_RELATION relation = { nT, rgFactors };
+
+    std::sort(relation.rgFactors.begin(), relation.rgFactors.end());
+
+    bool bResult = (nT > m_nStrength) && (nT <= relation.rgFactors.size()) &&
+                   (std::adjacent_find(relation.rgFactors.begin(), 
+                                       relation.rgFactors.end()) == relation.rgFactors.end()) &&
+                   (relation.rgFactors.back() < m_nNumFactors);
+
+    if (bResult)
+        m_rgRelations.push_back(relation);
+
+    return bResult;
+}
+
 size_t
-CComponentSystem::CalcNumberOfTWayConfigurations(WORD nT) const
+CComponentSystem::CalcNumberOfVariableCombinations(WORD nT) const
 {
     size_t nResult = 0;
 
-    nResult = static_cast<size_t>(pow(m_nNumLevels, nT) * 
-                                  CalcNumberOfVariableCombinations(nT));
+    nResult = N_Choose_T(m_nNumFactors, nT);
 
     return nResult;
 }
 
+/**
+  @brief  Returns the number of t-way configurations of a set of factors
+
+  @param [in] system         the component system
+  @param [in] rgFactors      the factors
+  @param [in] nT             the T-way value
+
+  @retval size_t             containing the number of configurations
+*/
+static size_t CalcConfigurations(const CComponentSystem& system, 
+                                 const std::vector<FACTOR_T>& rgFactors, WORD nT)
+{
+    // rgSums[j] accumulates the configurations of j factors among those 
+    // visited so far, i.e. the elementary symmetric sums of the level counts
+    std::vector<size_t> rgSums(nT + 1, 0);
+
+    rgSums[0] = 1;
+
+    for (auto nCurFactor : rgFactors)
+    {
+        size_t nNumLevels = system.GetNumLevels(nCurFactor);
+
+        for (WORD j = nT; j > 0; j--)
+            rgSums[j] += rgSums[j - 1] * nNumLevels;
+    }
+
+    return (nT > 0) ? rgSums[nT] : 0;
+}
 
+size_t
+CComponentSystem::CalcNumberOfTWayConfigurations(WORD nT) const
+{
+    std::vector<FACTOR_T> rgFactors(m_nNumFactors);
+
+    for (FACTOR_T nCurFactor = 0; nCurFactor < m_nNumFactors; nCurFactor++)
+        rgFactors[nCurFactor] = nCurFactor;
+
+    return CalcConfigurations(*this, rgFactors, nT);
+}
+
+size_t
+CComponentSystem::CalcNumberOfRequiredConfigurations(void) const
+{
+    size_t nResult = CalcNumberOfTWayConfigurations(m_nStrength);
+
+    for (auto& it : m_rgRelations)
+        nResult += CalcConfigurations(*this, it.rgFactors, it.nT);
+
+    return nResult;
+}
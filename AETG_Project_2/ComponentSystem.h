@@ -2,7 +2,8 @@
  *  @file       ComponentSystem.h
  *  @brief      CComponentSystem class interface
  *
- *  Provides type definitions for: TRange, TFactor, CComponentSystem
+ *  Provides type definitions for: TRange, TFactor, STRENGTH_RELATION, 
+ *  CComponentSystem
  *
  *  @author     Mark L. Short
  *  @date       February 9, 2015
@@ -25,6 +26,33 @@
     #include <list>
 #endif
 
+#ifndef _RANDOM_
+    #include <random>
+#endif
+
+#ifndef _STRING_
+    #include <string>
+#endif
+
+#ifndef __CONSTRAINT_SET_H__
+    #include "ConstraintSet.h"
+#endif
+
+/// default interaction strength t of a system
+constexpr const WORD DEFAULT_T_WAY = 3;
+
+/**
+  @brief  A sub-relation of a variable-strength system
+
+  The factors of the relation are to be covered at a strength above the 
+  system's base strength.
+*/
+struct STRENGTH_RELATION
+{
+    WORD                   nT;          ///< interaction strength of the relation
+    std::vector<FACTOR_T>  rgFactors;   ///< factors of the relation, ascending
+};
+
 /**
   @brief a primitive range implementation
 
@@ -180,19 +208,34 @@ public:
 
   http://csrc.nist.gov/groups/SNS/acts/coverage_measure.html
 
+  Each system owns the random engine its generation draws on, so generations 
+  against separate systems may run concurrently, though a single system serves 
+  one generation at a time.
 */
 class CComponentSystem
 {
     FACTOR_T                        m_nNumFactors; ///<  number of factors
-    LEVEL_T                         m_nNumLevels;  ///<  number of levels configured per factor
+    LEVEL_T                         m_nNumLevels;  ///<  greatest number of levels of any factor
     std::vector<TFactor<LEVEL_T>>   m_rgFactors;   ///<  array of TFactors
+    std::vector<FACTOR_T>           m_rgLevelFactor; ///<  owning factor, indexed by global level
+    DWORD                           m_nSeed;       ///<  seed of the Mersenne Twister engine
+    mutable std::mt19937            m_mt;          ///<  the system's own Mersenne Twister engine
+    CConstraintSet                  m_Constraints; ///<  compiled forbidden tuples
+    WORD                            m_nStrength;   ///<  base interaction strength t
+    std::vector<STRENGTH_RELATION>  m_rgRelations; ///<  sub-relations of a higher strength
 
 public:
     /// Default Constructor
     CComponentSystem() noexcept
         :m_nNumFactors(0),
          m_nNumLevels(0),
-         m_rgFactors()
+         m_rgFactors(),
+         m_rgLevelFactor(),
+         m_nSeed(0),
+         m_mt(),
+         m_Constraints(),
+         m_nStrength(DEFAULT_T_WAY),
+         m_rgRelations()
     { };
 
     /// Destructor
@@ -211,9 +254,26 @@ public:
 */
     bool     Init         (FACTOR_T nFactors, LEVEL_T nLevels);
 
+/**
+  @brief  class initializer for a mixed-level system
+
+  Factor f is given rgNumLevels[f] levels, the global levels of consecutive
+  factors being numbered on from one another.
+
+  @param [in] rgNumLevels    the number of levels, indexed by factor
+
+  @retval true               on success and the system was successfully 
+                             initialized
+  @retval false              on error or invalid parameter values
+*/
+    bool     Init         (const std::vector<LEVEL_T>& rgNumLevels);
+
 /**
   @brief  Sets the level range for a particular factor
 
+  Level ranges are expected to be contiguous and ascending by factor, as 
+  assigned by Init.
+
   @param [in] nFactor        target factor
   @param [in] nMinLevel      minimum level value for this factor
   @param [in] nMaxLevel      maximum level value for this factor
@@ -246,6 +306,16 @@ public:
 */
     LEVEL_T  GetMaxLevel      (FACTOR_T nFactor) const noexcept;
 
+/**
+  @brief  Returns the number of levels of a particular factor
+
+  @param [in] nFactor        target factor
+
+  @retval LEVEL_T            on success containing the factor's level count
+  @retval 0                  on error
+*/
+    LEVEL_T  GetNumLevels     (FACTOR_T nFactor) const noexcept;
+
 /**
   @brief  Returns the overall maximum inclusive level value assigned to any
           factor
@@ -303,6 +373,92 @@ public:
 */
     size_t     GetShuffledFactors(std::vector<FACTOR_T>& vShuffledFactors) const;
 
+/**
+  @brief Returns a random index in the range [0 .. nCount - 1]
+
+  Used to break ties between equally good choices, using the Mersenne Twister
+  engine.
+
+  @param [in] nCount         number of choices
+
+  @retval size_t             containing a random index
+  @retval 0                  if nCount is 0
+*/
+    size_t     GetRandomIndex(size_t nCount) const;
+
+/**
+  @brief Re-seeds the Mersenne Twister engine
+
+  Init seeds the engine from std::random_device, so that generation differs
+  from run to run; a fixed seed set after Init makes it repeatable.
+
+  @param [in] nSeed          the seed
+*/
+    void       SetSeed(DWORD nSeed);
+
+/**
+  @brief Retrieves the exact state of the Mersenne Twister engine
+
+  @retval std::string        containing the state, for SetRandomState
+*/
+    std::string GetRandomState(void) const;
+
+/**
+  @brief Restores a state of the Mersenne Twister engine, from which it 
+         draws the same numbers as it did when the state was retrieved
+
+  @param [in] strState       a state retrieved by GetRandomState
+
+  @retval true               on success
+  @retval false              if the state is malformed, leaving the engine 
+                             unchanged
+*/
+    bool       SetRandomState(const std::string& strState);
+
+/**
+  @brief  Forbids a combination of levels from appearing in any test case
+
+  The forbidden tuple may be of any arity, but each of its levels must belong
+  to a different factor.  Constraints are cleared by Init.
+
+  @param [in] rgLevels       the global levels of the forbidden tuple
+
+  @retval true               on success
+  @retval false              if a level is invalid or two levels share a 
+                             factor
+*/
+    bool     AddForbiddenTuple(const std::vector<LEVEL_T>& rgLevels);
+
+/**
+  @brief  Sets the base interaction strength t of the system
+
+  Every combination of t factors is to be covered.  The strength is reset to
+  DEFAULT_T_WAY by Init, and should be set before any sub-relation is added.
+
+  @param [in] nT             the base strength, [1..k]
+
+  @retval true               on success
+  @retval false              if nT is out of range
+*/
+    bool     SetStrength(WORD nT) noexcept;
+
+/**
+  @brief  Adds a sub-relation of a higher strength than the base strength
+
+  A variable-strength system covers every combination of nT factors among 
+  rgFactors, on top of the base strength coverage of all factors.  
+  Sub-relations are cleared by Init.
+
+  @param [in] rgFactors      the factors of the relation
+  @param [in] nT             the strength of the relation, above the base
+                             strength and no more than the number of factors
+
+  @retval true               on success
+  @retval false              if a factor is invalid or repeated, or nT is out
+                             of range
+*/
+    bool     AddRelation(const std::vector<FACTOR_T>& rgFactors, WORD nT);
+
 /**
   @brief  Returns the number of T-way system variable combinations 
 
@@ -326,12 +482,24 @@ public:
 /**
   @brief  Returns the number of T-way variable-value configurations
 
+  The sum over every combination of nT factors of the product of their 
+  level counts, which for a fixed-level system reduces to v^t * C(k,t).
+
   @param [in] nT             the T-way value
 
   @retval size_t             containing the number of configurations
 */
     size_t   CalcNumberOfTWayConfigurations(WORD nT) const;
 
+/**
+  @brief  Returns the number of variable-value configurations to be covered
+
+  The configurations of the base strength plus those of every sub-relation.
+
+  @retval size_t             containing the number of configurations
+*/
+    size_t   CalcNumberOfRequiredConfigurations(void) const;
+
 // Primitive data accessors
 /**
   @brief  Returns the number of factors currently configured
@@ -341,6 +509,47 @@ public:
 */
     constexpr FACTOR_T get_NumFactors(void) const noexcept
         { return m_nNumFactors; };
+
+/**
+  @brief  Returns the seed the Mersenne Twister engine was last 
+          initialized with
+
+  @retval DWORD              containing the seed
+*/
+    constexpr DWORD    get_Seed(void) const noexcept
+        { return m_nSeed; };
+
+/**
+  @brief  Returns the base interaction strength t of the system
+
+  @retval WORD               containing the strength
+*/
+    constexpr WORD     get_Strength(void) const noexcept
+        { return m_nStrength; };
+
+/**
+  @brief  Returns the sub-relations of a variable-strength system
+
+  @retval const std::vector<STRENGTH_RELATION>&  containing the sub-relations
+*/
+    inline const std::vector<STRENGTH_RELATION>& get_Relations(void) const noexcept
+        { return m_rgRelations; };
+
+/**
+  @brief  Returns the compiled forbidden tuples of the system
+
+  @retval const CConstraintSet&  containing the constraints
+*/
+    inline const CConstraintSet& get_Constraints(void) const noexcept
+        { return m_Constraints; };
+
+/**
+  @brief  Indicates whether any forbidden tuples have been added
+
+  @retval bool               true if the system is constrained
+*/
+    inline bool        HasConstraints(void) const noexcept
+        { return !m_Constraints.IsEmpty(); };
 };
 
 #endif
@@ -0,0 +1,209 @@
+/**
+ *  @file       ConstraintSet.cpp
+ *  @brief      CConstraintSet class implementation
+ *  @author     Mark L. Short
+ *  @date       October 18, 2026
+ */
+
+#include "stdafx.h"
+
+#include <climits>
+#include "TestCase.h"
+
+#include "ConstraintSet.h"
+
+/// number of forbidden tuples held in each mask word
+constexpr const size_t BITS_PER_WORD = sizeof(QWORD) * CHAR_BIT;
+
+void
+CConstraintSet::Clear(void) noexcept
+{
+    m_nNumFactors = 0;
+    m_nNumWords   = 0;
+    m_rgOffsets.assign(1, 0);
+    m_rgFactors.clear();
+    m_rgLevels.clear();
+    m_rgLevelMasks.clear();
+    m_rgFactorMasks.clear();
+}
+
+bool
+CConstraintSet::Add(const FACTOR_T* rgFactors, const LEVEL_T* rgLevels, size_t nArity)
+{
+    bool bResult = false;
+
+    if (nArity > 0)
+    {
+        m_rgFactors.insert(m_rgFactors.end(), rgFactors, rgFactors + nArity);
+        m_rgLevels.insert (m_rgLevels.end(),  rgLevels,  rgLevels  + nArity);
+        m_rgOffsets.push_back(m_rgLevels.size());
+
+        bResult = true;
+    }
+
+    return bResult;
+}
+
+void
+CConstraintSet::Compile(FACTOR_T nNumFactors, LEVEL_T nMaxSystemLevel)
+{
+    size_t nNumTuples = get_NumTuples( );
+
+    m_nNumFactors = nNumFactors;
+    m_nNumWords   = (nNumTuples + BITS_PER_WORD - 1) / BITS_PER_WORD;
+
+    m_rgLevelMasks.assign ((static_cast<size_t>(nMaxSystemLevel) + 1) * m_nNumWords, 0);
+    m_rgFactorMasks.assign(static_cast<size_t>(nNumFactors) * m_nNumWords, 0);
+
+    for (size_t nTuple = 0; nTuple < nNumTuples; nTuple++)
+    {
+        QWORD  qBit  = static_cast<QWORD>(1) << (nTuple % BITS_PER_WORD);
+        size_t nWord = nTuple / BITS_PER_WORD;
+
+        for (size_t n = m_rgOffsets[nTuple]; n < m_rgOffsets[nTuple + 1]; n++)
+        {
+            m_rgLevelMasks [m_rgLevels[n]  * m_nNumWords + nWord] |= qBit;
+            m_rgFactorMasks[m_rgFactors[n] * m_nNumWords + nWord] |= qBit;
+        }
+    }
+}
+
+void
+CConstraintSet::GetBlockingMask(const CTestCase& TestCase, FACTOR_T nFactor, 
+                                std::vector<QWORD>& rgMask) const
+{
+    rgMask.assign(m_nNumWords, 0);
+
+    // a forbidden tuple is ruled out by any of its other factors being 
+    // unassigned, or assigned a different level
+    for (FACTOR_T f = 0; f < m_nNumFactors; f++)
+    {
+        if (f == nFactor)
+            continue;
+
+        const QWORD* pFactorMask = m_rgFactorMasks.data() + f * m_nNumWords;
+        LEVEL_T      nLevel      = (f < TestCase.get_Size()) ? TestCase[f] : LEVEL_INVALID;
+
+        if (IsValidLevel(nLevel))
+        {
+            const QWORD* pLevelMask = m_rgLevelMasks.data() + nLevel * m_nNumWords;
+
+            for (size_t w = 0; w < m_nNumWords; w++)
+                rgMask[w] |= pFactorMask[w] & ~pLevelMask[w];
+        }
+        else
+        {
+            for (size_t w = 0; w < m_nNumWords; w++)
+                rgMask[w] |= pFactorMask[w];
+        }
+    }
+}
+
+bool
+CConstraintSet::IsFeasible(const std::vector<QWORD>& rgMask, LEVEL_T nLevel) const noexcept
+{
+    const QWORD* pLevelMask = m_rgLevelMasks.data() + nLevel * m_nNumWords;
+
+    for (size_t w = 0; w < m_nNumWords; w++)
+    {
+        if (pLevelMask[w] & ~rgMask[w])
+            return false;
+    }
+
+    return true;
+}
+
+bool
+CConstraintSet::IsFeasible(const CTestCase& TestCase, FACTOR_T nFactor, LEVEL_T nLevel) const
+{
+    if (IsEmpty( ))
+        return true;
+
+    std::vector<QWORD> rgMask;
+
+    GetBlockingMask(TestCase, nFactor, rgMask);
+
+    return IsFeasible(rgMask, nLevel);
+}
+
+bool
+CConstraintSet::CanRelease(const CTestCase& TestCase, FACTOR_T nFactor, 
+                           LEVEL_T nMinLevel, LEVEL_T nNumLevels) const
+{
+    if (IsEmpty( ))
+        return true;
+
+    std::vector<QWORD> rgMask(m_nNumWords, 0);
+
+    // unlike GetBlockingMask, an unassigned factor blocks nothing, as it may
+    // yet take the level of the forbidden tuple
+    for (FACTOR_T f = 0; f < m_nNumFactors; f++)
+    {
+        LEVEL_T nLevel = (f < TestCase.get_Size()) ? TestCase[f] : LEVEL_INVALID;
+
+        if ((f == nFactor) || (IsValidLevel(nLevel) == false))
+            continue;
+
+        const QWORD* pFactorMask = m_rgFactorMasks.data() + f * m_nNumWords;
+        const QWORD* pLevelMask  = m_rgLevelMasks.data()  + nLevel * m_nNumWords;
+
+        for (size_t w = 0; w < m_nNumWords; w++)
+            rgMask[w] |= pFactorMask[w] & ~pLevelMask[w];
+    }
+
+    for (LEVEL_T n = 0; n < nNumLevels; n++)
+    {
+        if (IsFeasible(rgMask, nMinLevel + n) == false)
+            return false;
+    }
+
+    return true;
+}
+
+bool
+CConstraintSet::IsForbidden(const CTestCase& TestCase) const
+{
+    if (IsEmpty( ))
+        return false;
+
+    std::vector<QWORD> rgMask;
+
+    GetBlockingMask(TestCase, FACTOR_INVALID, rgMask);
+
+    // any forbidden tuple left unblocked is wholly present
+    size_t nNumTuples = get_NumTuples( );
+
+    for (size_t w = 0; w < m_nNumWords; w++)
+    {
+        QWORD qValid = ((w + 1) * BITS_PER_WORD <= nNumTuples) 
+                           ? ~static_cast<QWORD>(0) 
+                           : (static_cast<QWORD>(1) << (nNumTuples % BITS_PER_WORD)) - 1;
+
+        if (~rgMask[w] & qValid)
+            return true;
+    }
+
+    return false;
+}
+
+size_t
+CConstraintSet::ReleaseForbidden(CTestCase& TestCase) const
+{
+    size_t nResult = 0;
+
+    for (size_t nTuple = 0; nTuple < get_NumTuples( ); nTuple++)
+    {
+        bool bPresent = true;
+
+        for (size_t n = m_rgOffsets[nTuple]; (n < m_rgOffsets[nTuple + 1]) && bPresent; n++)
+            bPresent = (m_rgFactors[n] < TestCase.get_Size()) && (TestCase[m_rgFactors[n]] == m_rgLevels[n]);
+
+        if (bPresent)
+        {
+            TestCase[m_rgFactors[m_rgOffsets[nTuple + 1] - 1]] = LEVEL_INVALID;
+            nResult++;
+        }
+    }
+
+    return nResult;
+}
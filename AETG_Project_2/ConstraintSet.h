@@ -0,0 +1,217 @@
+/**
+ *  @file       ConstraintSet.h
+ *  @brief      CConstraintSet class interface
+ *
+ *  Provides type definitions for: CConstraintSet
+ *
+ *  @author     Mark L. Short
+ *  @date       October 18, 2026
+ */
+#pragma once
+
+#if !defined(__CONSTRAINT_SET_H__)
+#define __CONSTRAINT_SET_H__
+
+#ifndef __COMMON_DEF_H__
+    #include "CommonDef.h"
+#endif
+
+#ifndef _VECTOR_
+    #include <vector>
+#endif
+
+// forward declarations
+class CTestCase;
+
+/**
+  @brief  A set of forbidden tuples, compiled into per level bitmasks
+
+  A forbidden tuple is any number of levels of distinct factors which may not
+  all appear in the same test case.  Once compiled, every global level holds a
+  bitmask of the forbidden tuples it takes part in, and every factor a bitmask
+  of the forbidden tuples involving it.
+
+  For a test case under construction, the forbidden tuples which can no 
+  longer be completed (because another of their factors is unassigned or holds
+  a different level) are gathered into a blocking mask once per factor.  A 
+  level of that factor is then feasible exactly when its own mask has no bits
+  outside the blocking mask, a word-AND per 64 forbidden tuples rather than a 
+  walk over the rules.
+*/
+class CConstraintSet
+{
+    FACTOR_T              m_nNumFactors;      ///< number of system factors compiled for
+    size_t                m_nNumWords;        ///< number of mask words per level or factor
+    std::vector<size_t>   m_rgOffsets;        ///< first entry of each forbidden tuple, plus the end
+    std::vector<FACTOR_T> m_rgFactors;        ///< factor of each entry, ascending within a tuple
+    std::vector<LEVEL_T>  m_rgLevels;         ///< global level of each entry
+    std::vector<QWORD>    m_rgLevelMasks;     ///< forbidden tuples containing each global level
+    std::vector<QWORD>    m_rgFactorMasks;    ///< forbidden tuples involving each factor
+
+public:
+    /// Default Constructor
+    CConstraintSet() noexcept
+        : m_nNumFactors(0),
+          m_nNumWords(0),
+          m_rgOffsets(1, 0),
+          m_rgFactors(),
+          m_rgLevels(),
+          m_rgLevelMasks(),
+          m_rgFactorMasks()
+    { };
+
+    /// Destructor
+    ~CConstraintSet() = default;
+
+/**
+  @brief  Removes all forbidden tuples
+*/
+    void   Clear(void) noexcept;
+
+/**
+  @brief  Adds a forbidden tuple
+
+  The set must be compiled again before it is next used.
+
+  @param [in] rgFactors      distinct factors of the tuple, in ascending order
+  @param [in] rgLevels       global level of each of the factors
+  @param [in] nArity         number of factors in the tuple
+
+  @retval true               on success
+  @retval false              if the tuple is empty
+*/
+    bool   Add(const FACTOR_T* rgFactors, const LEVEL_T* rgLevels, size_t nArity);
+
+/**
+  @brief  Builds the level and factor bitmasks
+
+  @param [in] nNumFactors      number of system factors
+  @param [in] nMaxSystemLevel  maximum system level of any factor
+*/
+    void   Compile(FACTOR_T nNumFactors, LEVEL_T nMaxSystemLevel);
+
+/**
+  @brief  Gathers the forbidden tuples which a test case has already ruled out
+
+  @param [in]  TestCase      a [partial] test case
+  @param [in]  nFactor       the factor about to be assigned, which is left out;
+                             FACTOR_INVALID to consider every factor
+  @param [out] rgMask        the blocking mask
+
+  @sa IsFeasible
+*/
+    void   GetBlockingMask(const CTestCase& TestCase, FACTOR_T nFactor, 
+                           std::vector<QWORD>& rgMask) const;
+
+/**
+  @brief  Tests a level against a blocking mask
+
+  @param [in] rgMask         blocking mask of the level's factor
+  @param [in] nLevel         candidate global level
+
+  @retval true               if the level completes no forbidden tuple
+  @retval false              if it does
+*/
+    bool   IsFeasible(const std::vector<QWORD>& rgMask, LEVEL_T nLevel) const noexcept;
+
+/**
+  @brief  Tests whether a level may be assigned to a [partial] test case
+
+  @param [in] TestCase       a [partial] test case
+  @param [in] nFactor        the factor being assigned
+  @param [in] nLevel         candidate global level
+
+  @retval true               if the level completes no forbidden tuple
+  @retval false              if it does
+*/
+    bool   IsFeasible(const CTestCase& TestCase, FACTOR_T nFactor, LEVEL_T nLevel) const;
+
+/**
+  @brief  Tests whether a cell may be left a don't-care
+
+  A don't-care may be given any level of its factor, as may the other
+  don't-cares of the test case, so only the assigned cells rule out a
+  forbidden tuple here.
+
+  @param [in] TestCase       a [partial] test case
+  @param [in] nFactor        the factor of the cell
+  @param [in] nMinLevel      the factor's first global level
+  @param [in] nNumLevels     the factor's number of levels
+
+  @retval true               if no level of the factor completes a forbidden
+                             tuple, whatever the other don't-cares are given
+  @retval false              otherwise
+*/
+    bool   CanRelease(const CTestCase& TestCase, FACTOR_T nFactor, 
+                      LEVEL_T nMinLevel, LEVEL_T nNumLevels) const;
+
+/**
+  @brief  Tests whether a [partial] test case contains a forbidden tuple
+
+  @param [in] TestCase       target CTestCase object
+
+  @retval true               if every level of some forbidden tuple is present
+  @retval false              otherwise
+*/
+    bool   IsForbidden(const CTestCase& TestCase) const;
+
+/**
+  @brief  Makes a test case valid by releasing cells of its forbidden tuples
+
+  The highest factor of each forbidden tuple present is made a don't-care.
+
+  @param [in,out] TestCase   target CTestCase object
+
+  @retval size_t             containing the number of cells released
+*/
+    size_t ReleaseForbidden(CTestCase& TestCase) const;
+
+// Primitive data accessors
+/**
+  @brief  Returns the number of forbidden tuples
+
+  @retval size_t             containing the number of forbidden tuples
+*/
+    inline size_t get_NumTuples(void) const noexcept
+    { return m_rgOffsets.size() - 1; };
+
+/**
+  @brief  Indicates whether there are no forbidden tuples
+
+  @retval bool               true if the set is empty
+*/
+    inline bool   IsEmpty(void) const noexcept
+    { return m_rgLevels.empty(); };
+
+/**
+  @brief  Returns the number of factors of a forbidden tuple
+
+  @param [in] nTuple         index of the forbidden tuple
+
+  @retval size_t             containing the arity
+*/
+    inline size_t GetArity(size_t nTuple) const noexcept
+    { return m_rgOffsets[nTuple + 1] - m_rgOffsets[nTuple]; };
+
+/**
+  @brief  Returns the factors of a forbidden tuple, in ascending order
+
+  @param [in] nTuple         index of the forbidden tuple
+
+  @retval const FACTOR_T*    pointing to GetArity(nTuple) factors
+*/
+    inline const FACTOR_T* GetFactors(size_t nTuple) const noexcept
+    { return &m_rgFactors[m_rgOffsets[nTuple]]; };
+
+/**
+  @brief  Returns the levels of a forbidden tuple
+
+  @param [in] nTuple         index of the forbidden tuple
+
+  @retval const LEVEL_T*     pointing to GetArity(nTuple) global levels
+*/
+    inline const LEVEL_T*  GetLevels(size_t nTuple) const noexcept
+    { return &m_rgLevels[m_rgOffsets[nTuple]]; };
+};
+
+#endif
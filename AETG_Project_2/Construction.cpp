@@ -0,0 +1,305 @@
+/**
+ *  @file       Construction.cpp
+ *  @brief      Direct covering array constructions
+ *  @author     Mark L. Short
+ *  @date       October 18, 2026
+ */
+
+#include "stdafx.h"
+
+#include <algorithm>
+
+#include "ComponentSystem.h"
+#include "GaloisField.h"
+
+#include "Construction.h"
+
+bool
+CanConstructOrthogonalArray(const CComponentSystem& system)
+{
+    FACTOR_T nNumFactors = system.get_NumFactors( );
+    WORD     nT          = system.get_Strength( );
+
+    if ((nNumFactors == 0) || system.HasConstraints( ) || !system.get_Relations( ).empty( ))
+        return false;
+
+    LEVEL_T nNumLevels = system.GetNumLevels(0);
+
+    for (FACTOR_T nCurFactor = 1; nCurFactor < nNumFactors; nCurFactor++)
+    {
+        if (system.GetNumLevels(nCurFactor) != nNumLevels)
+            return false;
+    }
+
+    WORD nPrime  = 0;
+    WORD nDegree = 0;
+
+    return (nNumLevels <= MAX_FIELD_ORDER) &&
+           CGaloisField::IsPrimePower(nNumLevels, nPrime, nDegree) &&
+           (nT >= 2) && (nT <= nNumLevels) && (nT <= nNumFactors) &&
+           (nNumFactors <= static_cast<size_t>(nNumLevels) + 1);
+}
+
+bool
+ConstructBushArray(WORD nT, LEVEL_T nQ, FACTOR_T nK, COVERING_ARRAY& Array)
+{
+    CGaloisField field;
+
+    if ((nT < 2) || (nT > nQ) || (nK < nT) || (nK > static_cast<size_t>(nQ) + 1) || 
+        (nQ > MAX_FIELD_ORDER) || !field.Init(nQ))
+        return false;
+
+    size_t nNumRows = 1;
+    for (WORD i = 0; i < nT; i++)
+        nNumRows *= nQ;
+
+    Array.nT = nT;
+    Array.nV = nQ;
+    Array.nK = nK;
+    Array.rgCells.resize(nNumRows * nK);
+
+    std::vector<WORD> rgCoeffs(nT);
+
+    for (size_t nRow = 0; nRow < nNumRows; nRow++)
+    {
+        // the row's polynomial a0 + a1 x + ... + a(t-1) x^(t-1)
+        for (WORD i = 0, n = 0; i < nT; i++)
+            rgCoeffs[i] = static_cast<WORD>((nRow / (i ? (n *= nQ) : (n = 1))) % nQ);
+
+        for (FACTOR_T nCol = 0; nCol < nK; nCol++)
+        {
+            WORD nValue = rgCoeffs[nT - 1];
+
+            // Horner's rule at the field element numbered by the column, the
+            // last column of a full array taking the leading coefficient
+            if (nCol < nQ)
+            {
+                for (WORD i = nT - 1; i > 0; i--)
+                    nValue = field.Add(field.Mul(nValue, nCol), rgCoeffs[i - 1]);
+            }
+
+            Array.rgCells[nRow * nK + nCol] = nValue;
+        }
+    }
+
+    return true;
+}
+
+/**
+  @brief  Maps the symbols of a covering array onto the levels of a system
+
+  @param [in]  system        CComponentSystem object, containing the inputs
+  @param [in]  Array         the covering array, of no more columns than the
+                             system has factors
+  @param [out] rgRows        the test cases
+
+  @retval size_t             containing the number of test cases
+*/
+static size_t
+MapCoveringArray(const CComponentSystem& system, const COVERING_ARRAY& Array, 
+                 std::vector<CTestCase>& rgRows)
+{
+    size_t nNumRows = Array.get_NumRows( );
+
+    rgRows.resize(nNumRows);
+
+    for (size_t nRow = 0; nRow < nNumRows; nRow++)
+    {
+        CTestCase& TestCase = rgRows[nRow];
+        TestCase.Init(system.get_NumFactors( ));
+
+        for (FACTOR_T nCol = 0; nCol < Array.nK; nCol++)
+        {
+            TestCase[nCol] = system.GetMinLevel(nCol) + 
+                             (Array.GetCell(nRow, nCol) % system.GetNumLevels(nCol));
+        }
+    }
+
+    return nNumRows;
+}
+
+size_t
+ConstructOrthogonalArray(const CComponentSystem& system, std::vector<CTestCase>& rgRows)
+{
+    COVERING_ARRAY Array;
+
+    rgRows.clear( );
+
+    if (!CanConstructOrthogonalArray(system) || 
+        !ConstructBushArray(system.get_Strength( ), system.GetNumLevels(0), 
+                            system.get_NumFactors( ), Array))
+        return 0;
+
+    return MapCoveringArray(system, Array, rgRows);
+}
+
+FACTOR_T
+CRecursiveConstruction::GetConstructibleColumns(WORD nT, LEVEL_T nV, FACTOR_T nK)
+{
+    WORD nPrime  = 0;
+    WORD nDegree = 0;
+
+    if ((nT <= 3) || (nK <= nT + 1))
+        return nK;
+
+    // beyond the compositions only the base cases remain
+    if ((nT <= nV) && (nV <= MAX_FIELD_ORDER) && CGaloisField::IsPrimePower(nV, nPrime, nDegree))
+        return static_cast<FACTOR_T>(std::min<size_t>(nK, static_cast<size_t>(nV) + 1));
+
+    return nT + 1;
+}
+
+const COVERING_ARRAY*
+CRecursiveConstruction::Construct(WORD nT, LEVEL_T nV, FACTOR_T nK)
+{
+    QWORD nKey = (static_cast<QWORD>(nT) << 32) | (static_cast<QWORD>(nV) << 16) | nK;
+
+    auto itFound = m_mapCache.find(nKey);
+    if (itFound != m_mapCache.end())
+        return &itFound->second;
+
+    if ((nT < 2) || (nV < 1) || (nK < 1) || (GetConstructibleColumns(nT, nV, nK) < nK))
+        return nullptr;
+
+    COVERING_ARRAY Array;
+
+    Array.nT = nT;
+    Array.nV = nV;
+    Array.nK = nK;
+
+    if (nK <= nT)
+    {
+        // every combination of levels
+        size_t nNumRows = 1;
+        for (FACTOR_T nCol = 0; nCol < nK; nCol++)
+            nNumRows *= nV;
+
+        Array.rgCells.resize(nNumRows * nK);
+
+        for (size_t nRow = 0; nRow < nNumRows; nRow++)
+        {
+            size_t n = nRow;
+            for (FACTOR_T nCol = 0; nCol < nK; nCol++, n /= nV)
+                Array.rgCells[nRow * nK + nCol] = static_cast<LEVEL_T>(n % nV);
+        }
+    }
+    else if (ConstructBushArray(nT, nV, nK, Array))
+    {
+        // nothing further to be done
+    }
+    else if (nK == nT + 1)
+    {
+        // the last column makes each row's symbols sum to zero modulo v, so 
+        // any t columns determine the row
+        const COVERING_ARRAY* pFull = Construct(nT, nV, nT);
+
+        Array.rgCells.resize(pFull->get_NumRows( ) * nK);
+
+        for (size_t nRow = 0; nRow < pFull->get_NumRows( ); nRow++)
+        {
+            size_t nSum = 0;
+            for (FACTOR_T nCol = 0; nCol < nT; nCol++)
+            {
+                Array.rgCells[nRow * nK + nCol] = pFull->GetCell(nRow, nCol);
+                nSum += pFull->GetCell(nRow, nCol);
+            }
+            Array.rgCells[nRow * nK + nT] = static_cast<LEVEL_T>((nV - nSum % nV) % nV);
+        }
+    }
+    else if (nT == 2)
+    {
+        // column (i, j) takes column i of the first array and column j of the
+        // second, so two columns differ in at least one of the two arrays
+        FACTOR_T nK1 = 1;
+        while (nK1 * nK1 < nK)
+            nK1++;
+
+        FACTOR_T nK2 = (nK + nK1 - 1) / nK1;
+
+        const COVERING_ARRAY* pFirst  = Construct(2, nV, nK1);
+        const COVERING_ARRAY* pSecond = Construct(2, nV, nK2);
+
+        if ((pFirst == nullptr) || (pSecond == nullptr))
+            return nullptr;
+
+        for (size_t nRow = 0; nRow < pFirst->get_NumRows( ); nRow++)
+        {
+            for (FACTOR_T nCol = 0; nCol < nK; nCol++)
+                Array.rgCells.push_back(pFirst->GetCell(nRow, nCol / nK2));
+        }
+
+        for (size_t nRow = 0; nRow < pSecond->get_NumRows( ); nRow++)
+        {
+            for (FACTOR_T nCol = 0; nCol < nK; nCol++)
+                Array.rgCells.push_back(pSecond->GetCell(nRow, nCol % nK2));
+        }
+    }
+    else
+    {
+        // both halves repeat the 3-way array, which covers every tuple but 
+        // those holding a column and its copy with different symbols.  These
+        // come from the 2-way array, its copy shifted by each symbol in turn.
+        FACTOR_T nHalf = (nK + 1) / 2;
+
+        const COVERING_ARRAY* pT3 = Construct(3, nV, nHalf);
+        const COVERING_ARRAY* pT2 = Construct(2, nV, nHalf);
+
+        if ((pT3 == nullptr) || (pT2 == nullptr))
+            return nullptr;
+
+        for (size_t nRow = 0; nRow < pT3->get_NumRows( ); nRow++)
+        {
+            for (FACTOR_T nCol = 0; nCol < nK; nCol++)
+                Array.rgCells.push_back(pT3->GetCell(nRow, nCol % nHalf));
+        }
+
+        for (LEVEL_T nShift = 1; nShift < nV; nShift++)
+        {
+            for (size_t nRow = 0; nRow < pT2->get_NumRows( ); nRow++)
+            {
+                for (FACTOR_T nCol = 0; nCol < nK; nCol++)
+                {
+                    LEVEL_T nSymbol = pT2->GetCell(nRow, nCol % nHalf);
+
+                    Array.rgCells.push_back((nCol < nHalf) ? nSymbol : (nSymbol + nShift) % nV);
+                }
+            }
+        }
+    }
+
+    return &(m_mapCache[nKey] = std::move(Array));
+}
+
+size_t
+CRecursiveConstruction::Construct(const CComponentSystem& system, std::vector<CTestCase>& rgRows)
+{
+    FACTOR_T nNumFactors = system.get_NumFactors( );
+    LEVEL_T  nMaxLevels  = 0;
+
+    rgRows.clear( );
+
+    for (FACTOR_T nCurFactor = 0; nCurFactor < nNumFactors; nCurFactor++)
+        nMaxLevels = std::max(nMaxLevels, system.GetNumLevels(nCurFactor));
+
+    WORD     nT       = system.get_Strength( );
+    FACTOR_T nColumns = GetConstructibleColumns(nT, nMaxLevels, nNumFactors);
+
+    const COVERING_ARRAY* pArray = Construct(nT, nMaxLevels, nColumns);
+
+    if (pArray == nullptr)
+        return 0;
+
+    return MapCoveringArray(system, *pArray, rgRows);
+}
+
+bool
+CRecursiveConstruction::IsComplete(const CComponentSystem& system)
+{
+    FACTOR_T nNumFactors = system.get_NumFactors( );
+    LEVEL_T  nMaxLevels  = 0;
+
+    for (FACTOR_T nCurFactor = 0; nCurFactor < nNumFactors; nCurFactor++)
+        nMaxLevels = std::max(nMaxLevels, system.GetNumLevels(nCurFactor));
+
+    return GetConstructibleColumns(system.get_Strength( ), nMaxLevels, nNumFactors) == nNumFactors;
+}
@@ -0,0 +1,188 @@
+/**
+ *  @file       Construction.h
+ *  @brief      Direct covering array constructions
+ *
+ *  Some systems admit an optimal covering array which can be written down
+ *  directly rather than searched for.  The test suite generation engines
+ *  consult these constructions before falling back to greedy search.
+ *
+ *  @author     Mark L. Short
+ *  @date       October 18, 2026
+ */
+#pragma once
+
+#if !defined(__CONSTRUCTION_H__)
+#define __CONSTRUCTION_H__
+
+#ifndef __COMMON_DEF_H__
+    #include "CommonDef.h"
+#endif
+
+#ifndef _VECTOR_
+    #include <vector>
+#endif
+
+#ifndef _MAP_
+    #include <map>
+#endif
+
+#ifndef __TEST_CASE_H__
+    #include "TestCase.h"
+#endif
+
+// forward declaration
+class CComponentSystem;
+
+/**
+  @brief  A covering array CA(N; t, k, v) over the symbols [0 .. v-1]
+*/
+struct COVERING_ARRAY
+{
+    WORD                 nT;        ///< strength t
+    LEVEL_T              nV;        ///< number of symbols v
+    FACTOR_T             nK;        ///< number of columns k
+    std::vector<LEVEL_T> rgCells;   ///< N x k cells, stored row by row
+
+    /// Returns the number of rows N
+    inline size_t get_NumRows(void) const noexcept
+    { return (nK > 0) ? rgCells.size() / nK : 0; };
+
+    /// Returns the symbol of a given row and column
+    inline LEVEL_T GetCell(size_t nRow, FACTOR_T nCol) const noexcept
+    { return rgCells[nRow * nK + nCol]; };
+};
+
+/**
+  @brief  Builds a covering array by Bush's construction
+
+  @param [in]  nT            strength t, [2 .. q]
+  @param [in]  nQ            number of symbols q, a prime power
+  @param [in]  nK            number of columns k, [t .. q + 1]
+  @param [out] Array         the orthogonal array OA(q^t; t, k, q)
+
+  @retval true               on success
+  @retval false              if the construction does not apply
+*/
+bool   ConstructBushArray(WORD nT, LEVEL_T nQ, FACTOR_T nK, COVERING_ARRAY& Array);
+
+/**
+  @brief  Composes large covering arrays from smaller ones
+
+  Arrays are built over v symbols, every array the recursion produces being 
+  cached, so that the small arrays shared by different sizes, and the arrays
+  of repeated runs, are built only once.  The base cases are:
+
+   - the full factorial array, for k <= t
+   - Bush's orthogonal array, for a prime power v, t <= v and k <= v + 1
+   - the zero-sum orthogonal array OA(v^t; t, t + 1, v)
+
+  Larger arrays are composed by:
+
+   - t = 2, the product of CA(N1; 2, k1, v) and CA(N2; 2, k2, v), a 
+     CA(N1 + N2; 2, k1 k2, v)
+   - t = 3, Roux-type doubling of CA(N3; 3, k, v) and CA(N2; 2, k, v), a 
+     CA(N3 + (v - 1) N2; 3, 2k, v)
+
+  deleting surplus columns as required.  Above strength 3 the largest base 
+  case is taken, leaving the remaining columns to be extended by search.
+*/
+class CRecursiveConstruction
+{
+    std::map<QWORD, COVERING_ARRAY> m_mapCache;  ///< arrays built so far, keyed by (t, v, k)
+
+public:
+    /// Default Constructor
+    CRecursiveConstruction( )
+        : m_mapCache()
+    { };
+
+/**
+  @brief  Returns the number of columns which can be constructed directly
+
+  @param [in] nT             strength t
+  @param [in] nV             number of symbols v
+  @param [in] nK             number of columns k wanted
+
+  @retval FACTOR_T           containing the number of columns, at most nK
+*/
+    static FACTOR_T GetConstructibleColumns(WORD nT, LEVEL_T nV, FACTOR_T nK);
+
+/**
+  @brief  Returns a covering array CA(N; t, k, v), building it if need be
+
+  @param [in] nT             strength t, [2 .. MAX_T_WAY]
+  @param [in] nV             number of symbols v
+  @param [in] nK             number of columns k, no more than 
+                             GetConstructibleColumns(nT, nV, nK)
+
+  @retval const COVERING_ARRAY*  pointing to the cached array
+  @retval nullptr                if no construction applies
+*/
+    const COVERING_ARRAY* Construct(WORD nT, LEVEL_T nV, FACTOR_T nK);
+
+/**
+  @brief  Constructs the test cases of a system's base strength
+
+  The array is built over as many symbols as the largest factor has levels,
+  each symbol mapping to the level of the same index, or for a factor with 
+  fewer levels to that index modulo its number of levels, which preserves 
+  coverage.  Factors beyond GetConstructibleColumns are left as don't-care 
+  levels.
+
+  @param [in]  system        CComponentSystem object, containing the inputs
+  @param [out] rgRows        the test cases
+
+  @retval size_t             containing the number of test cases
+  @retval 0                  if no construction applies
+*/
+    size_t Construct(const CComponentSystem& system, std::vector<CTestCase>& rgRows);
+
+/**
+  @brief  Indicates whether Construct covers every factor of a system
+
+  @param [in] system         CComponentSystem object, containing the inputs
+
+  @retval true               if no factor is left to be extended by search
+  @retval false              otherwise
+*/
+    static bool IsComplete(const CComponentSystem& system);
+
+/**
+  @brief  Discards the cached arrays
+*/
+    inline void Clear(void) noexcept
+    { m_mapCache.clear(); };
+};
+
+/**
+  @brief  Tests whether an orthogonal array can be constructed for a system
+
+  Bush's construction applies to an unconstrained system of k factors, each
+  of q levels with q a prime power, at a strength t no greater than q,
+  provided k <= q + 1.  Variable-strength systems are not covered.
+
+  @param [in] system         CComponentSystem object, containing the inputs
+
+  @retval true               if ConstructOrthogonalArray applies
+  @retval false              otherwise
+*/
+bool   CanConstructOrthogonalArray(const CComponentSystem& system);
+
+/**
+  @brief  Constructs an orthogonal array OA(q^t, k, q, t) by Bush's method
+
+  Each row is a polynomial over GF(q) of degree below t, the row's level for
+  factor j < q being the polynomial evaluated at the j-th field element and
+  for factor q its leading coefficient.  Since a polynomial of degree below t
+  is fixed by its values at any t points, every t-way tuple is covered
+  exactly once, and the q^t rows are optimal.
+
+  @param [in]  system        CComponentSystem object, containing the inputs
+  @param [out] rgRows        the test cases
+
+  @retval size_t             containing the number of test cases
+  @retval 0                  if the construction does not apply
+*/
+size_t ConstructOrthogonalArray(const CComponentSystem& system, std::vector<CTestCase>& rgRows);
+
+#endif
@@ -0,0 +1,238 @@
+/**
+ *  @file       CoverageCount.cpp
+ *  @brief      CCoverageCount class implementation
+ *  @author     Mark L. Short
+ *  @date       October 18, 2026
+ */
+
+#include "stdafx.h"
+
+#include <algorithm>
+#include "ComponentSystem.h"
+#include "MathUtility.h"
+#include "TestCase.h"
+
+#include "CoverageCount.h"
+
+bool
+CCoverageCount::Init(const CComponentSystem& system, WORD nT)
+{
+    bool bResult = CTupleSpace::Init(system, nT);
+
+    if (bResult)
+        InitLayout( );
+
+    return bResult;
+}
+
+bool
+CCoverageCount::Init(const std::vector<LEVEL_T>& rgMinLevel, 
+                     const std::vector<LEVEL_T>& rgNumLevels, WORD nT)
+{
+    bool bResult = CTupleSpace::Init(rgMinLevel, rgNumLevels, nT);
+
+    if (bResult)
+        InitLayout( );
+
+    return bResult;
+}
+
+void
+CCoverageCount::InitLayout(void)
+{
+    m_rgOffsets.resize(m_nNumCombinations + 1);
+
+    FACTOR_T rgColumns[MAX_T_WAY];
+    ResetColumns(rgColumns, m_nT);
+
+    size_t nOffset = 0;
+    size_t nRank   = 0;
+    do
+    {
+        m_rgOffsets[nRank++] = nOffset;
+        nOffset += GetBlockSize(rgColumns);
+    } while (NextCombination(rgColumns, m_nT, m_nNumFactors));
+
+    m_rgOffsets[nRank] = nOffset;
+
+    m_rgCounts.assign(nOffset, 0);
+    m_nNumCovered = 0;
+}
+
+size_t
+CCoverageCount::Add(const CTestCase& TestCase)
+{
+    size_t nResult = 0;
+
+    if (TestCase.get_Size() >= m_nNumFactors)
+    {
+        FACTOR_T rgColumns[MAX_T_WAY];
+        ResetColumns(rgColumns, m_nT);
+
+        size_t nRank = 0;
+        do
+        {
+            size_t nIndex = 0;
+            if (GetTupleIndex(rgColumns, TestCase, nIndex))
+            {
+                WORD& nCount = m_rgCounts[m_rgOffsets[nRank] + nIndex];
+
+                if (nCount == 0)
+                    nResult++;
+
+                if (nCount < COUNT_MAX)
+                    nCount++;
+            }
+            nRank++;
+        } while (NextCombination(rgColumns, m_nT, m_nNumFactors));
+
+        m_nNumCovered += nResult;
+    }
+
+    return nResult;
+}
+
+size_t
+CCoverageCount::Remove(const CTestCase& TestCase)
+{
+    size_t nResult = 0;
+
+    if (TestCase.get_Size() >= m_nNumFactors)
+    {
+        FACTOR_T rgColumns[MAX_T_WAY];
+        ResetColumns(rgColumns, m_nT);
+
+        size_t nRank = 0;
+        do
+        {
+            size_t nIndex = 0;
+            if (GetTupleIndex(rgColumns, TestCase, nIndex))
+            {
+                WORD& nCount = m_rgCounts[m_rgOffsets[nRank] + nIndex];
+
+                // a saturated count no longer reflects the true multiplicity
+                if ((nCount > 0) && (nCount < COUNT_MAX))
+                {
+                    if (--nCount == 0)
+                        nResult++;
+                }
+            }
+            nRank++;
+        } while (NextCombination(rgColumns, m_nT, m_nNumFactors));
+
+        m_nNumCovered -= nResult;
+    }
+
+    return nResult;
+}
+
+size_t
+CCoverageCount::CountUncovered(const CTestCase& TestCase) const
+{
+    size_t nResult = 0;
+
+    if (TestCase.get_Size() >= m_nNumFactors)
+    {
+        FACTOR_T rgColumns[MAX_T_WAY];
+        ResetColumns(rgColumns, m_nT);
+
+        size_t nRank = 0;
+        do
+        {
+            size_t nIndex = 0;
+            if (GetTupleIndex(rgColumns, TestCase, nIndex) && 
+                (m_rgCounts[m_rgOffsets[nRank] + nIndex] == 0))
+                nResult++;
+
+            nRank++;
+        } while (NextCombination(rgColumns, m_nT, m_nNumFactors));
+    }
+
+    return nResult;
+}
+
+bool
+CCoverageCount::IsRedundant(const CTestCase& TestCase, size_t* pNumCritical) const
+{
+    size_t nNumCritical = 0;
+
+    if (TestCase.get_Size() >= m_nNumFactors)
+    {
+        FACTOR_T rgColumns[MAX_T_WAY];
+        ResetColumns(rgColumns, m_nT);
+
+        size_t nRank = 0;
+        do
+        {
+            size_t nIndex = 0;
+            if (GetTupleIndex(rgColumns, TestCase, nIndex))
+            {
+                WORD nCount = m_rgCounts[m_rgOffsets[nRank] + nIndex];
+
+                if (nCount <= 1)
+                    return false;
+
+                if (nCount == 2)
+                    nNumCritical++;
+            }
+            nRank++;
+        } while (NextCombination(rgColumns, m_nT, m_nNumFactors));
+    }
+
+    if (pNumCritical)
+        *pNumCritical = nNumCritical;
+
+    return true;
+}
+
+bool
+CCoverageCount::GetTuplePos(const FACTOR_T* rgColumns, const CTestCase& TestCase, 
+                            size_t& nPos) const noexcept
+{
+    size_t nIndex  = 0;
+    bool   bResult = GetTupleIndex(rgColumns, TestCase, nIndex);
+
+    if (bResult)
+        nPos = m_rgOffsets[GetRank(rgColumns)] + nIndex;
+
+    return bResult;
+}
+
+void
+CCoverageCount::GetTuple(size_t nPos, FACTOR_T* rgColumns, LEVEL_T* rgLevels) const
+{
+    // the owning column combination is the last one starting at or before nPos
+    size_t nRank = std::upper_bound(m_rgOffsets.begin(), m_rgOffsets.end(), nPos) - 
+                   m_rgOffsets.begin() - 1;
+
+    UnrankCombination(nRank, rgColumns, m_nT, m_nNumFactors);
+    GetTupleLevels(rgColumns, nPos - m_rgOffsets[nRank], rgLevels);
+}
+
+WORD
+CCoverageCount::Increment(size_t nPos) noexcept
+{
+    WORD& nCount = m_rgCounts[nPos];
+
+    if (nCount == 0)
+        m_nNumCovered++;
+
+    if (nCount < COUNT_MAX)
+        nCount++;
+
+    return nCount;
+}
+
+WORD
+CCoverageCount::Decrement(size_t nPos) noexcept
+{
+    WORD& nCount = m_rgCounts[nPos];
+
+    if ((nCount > 0) && (nCount < COUNT_MAX))
+    {
+        if (--nCount == 0)
+            m_nNumCovered--;
+    }
+
+    return nCount;
+}
@@ -0,0 +1,201 @@
+/**
+ *  @file       CoverageCount.h
+ *  @brief      CCoverageCount class interface
+ *
+ *  Provides type definitions for: CCoverageCount
+ *
+ *  @author     Mark L. Short
+ *  @date       October 18, 2026
+ */
+#pragma once
+
+#if !defined(__COVERAGE_COUNT_H__)
+#define __COVERAGE_COUNT_H__
+
+#ifndef __COMMON_DEF_H__
+    #include "CommonDef.h"
+#endif
+
+#ifndef _VECTOR_
+    #include <vector>
+#endif
+
+#ifndef __TUPLE_SPACE_H__
+    #include "TupleSpace.h"
+#endif
+
+/**
+  @brief  A dense per-tuple coverage multiplicity count
+
+  Where CCoverageMap records whether a tuple has been covered, CCoverageCount
+  records how many test cases of a suite cover it.  Tuples are laid out in the
+  same rank and mixed radix order as the bitmap, without word alignment.
+
+  Counts saturate at COUNT_MAX; a saturated count is never decremented, so it 
+  errs on the side of reporting a tuple as covered more than once.
+*/
+class CCoverageCount : public CTupleSpace
+{
+    size_t                m_nNumCovered;      ///< number of tuples with a non-zero count
+    std::vector<size_t>   m_rgOffsets;        ///< first count of each column combination, by rank
+    std::vector<WORD>     m_rgCounts;         ///< the per-tuple coverage multiplicity
+
+public:
+    /// saturation value of a tuple count
+    static constexpr const WORD COUNT_MAX = 0xFFFF;
+
+    /// Default Constructor
+    CCoverageCount() noexcept
+        : CTupleSpace(),
+          m_nNumCovered(0),
+          m_rgOffsets(),
+          m_rgCounts()
+    { };
+
+    /// Destructor
+    ~CCoverageCount() = default;
+
+/**
+  @brief  class initializer
+
+  Calculates the count layout for the given system and allocates storage for
+  it.  All counts are initially zero.
+
+  @param [in] system         target CComponentSystem
+  @param [in] nT             the T-way value, [1..MAX_T_WAY]
+
+  @retval true               on success
+  @retval false              on error or invalid parameter values
+*/
+    bool   Init(const CComponentSystem& system, WORD nT);
+
+/**
+  @brief  class initializer, from explicit level ranges
+
+  @param [in] rgMinLevel     minimum level, indexed by factor
+  @param [in] rgNumLevels    number of levels, indexed by factor
+  @param [in] nT             the T-way value, [1..MAX_T_WAY]
+
+  @retval true               on success
+  @retval false              on error or invalid parameter values
+*/
+    bool   Init(const std::vector<LEVEL_T>& rgMinLevel, 
+                const std::vector<LEVEL_T>& rgNumLevels, WORD nT);
+
+/**
+  @brief  Increments the count of every tuple of a test case
+
+  @param [in] TestCase       target CTestCase object
+
+  @retval size_t             number of tuples whose count went from 0 to 1
+*/
+    size_t Add(const CTestCase& TestCase);
+
+/**
+  @brief  Decrements the count of every tuple of a test case
+
+  The test case is expected to have been previously added.
+
+  @param [in] TestCase       target CTestCase object
+
+  @retval size_t             number of tuples whose count went from 1 to 0
+*/
+    size_t Remove(const CTestCase& TestCase);
+
+/**
+  @brief  Counts the tuples of a test case not yet covered by any other
+
+  @param [in] TestCase       target CTestCase object
+
+  @retval size_t             number of the test case's tuples with a zero count
+*/
+    size_t CountUncovered(const CTestCase& TestCase) const;
+
+/**
+  @brief  Tests whether every tuple of a test case is also covered elsewhere
+
+  @param [in]  TestCase      target CTestCase object, previously added
+  @param [out] pNumCritical  optional, receives the number of the test case's
+                             tuples covered exactly twice, which would become
+                             uniquely covered were the test case removed
+
+  @retval true               if removing the test case would lose no coverage
+  @retval false              if the test case uniquely covers some tuple
+*/
+    bool   IsRedundant(const CTestCase& TestCase, size_t* pNumCritical = nullptr) const;
+
+/**
+  @brief  Locates the count of a test case tuple
+
+  @param [in]  rgColumns     sorted column combination of get_T() factors
+  @param [in]  TestCase      target CTestCase object
+  @param [out] nPos          position of the tuple's count
+
+  @retval true               on success
+  @retval false              if any of the columns has no valid level assigned
+*/
+    bool   GetTuplePos(const FACTOR_T* rgColumns, const CTestCase& TestCase, 
+                       size_t& nPos) const noexcept;
+
+/**
+  @brief  Converts a count position back into its tuple
+
+  @param [in]  nPos          position of the tuple's count
+  @param [out] rgColumns     the tuple's column combination
+  @param [out] rgLevels      the tuple's level for each of the columns
+*/
+    void   GetTuple(size_t nPos, FACTOR_T* rgColumns, LEVEL_T* rgLevels) const;
+
+/**
+  @brief  Returns the coverage multiplicity at a given position
+
+  @param [in] nPos           position of the tuple's count
+
+  @retval WORD               containing the number of covering test cases
+*/
+    inline WORD   GetCount(size_t nPos) const noexcept
+    { return m_rgCounts[nPos]; };
+
+/**
+  @brief  Increments the coverage multiplicity at a given position
+
+  @param [in] nPos           position of the tuple's count
+
+  @retval WORD               containing the updated count
+*/
+    WORD   Increment(size_t nPos) noexcept;
+
+/**
+  @brief  Decrements the coverage multiplicity at a given position
+
+  @param [in] nPos           position of the tuple's count
+
+  @retval WORD               containing the updated count
+*/
+    WORD   Decrement(size_t nPos) noexcept;
+
+// Primitive data accessors
+/**
+  @brief  Returns the number of tuples covered at least once
+
+  @retval size_t             containing the number of covered tuples
+*/
+    inline size_t get_NumCovered(void) const noexcept
+    { return m_nNumCovered; };
+
+/**
+  @brief  Returns the total number of t-way tuples
+
+  @retval size_t             containing the number of tuples
+*/
+    inline size_t get_NumTuples(void) const noexcept
+    { return m_rgCounts.size(); };
+
+private:
+/**
+  @brief  Lays out the counts of an initialized tuple space, all zero
+*/
+    void   InitLayout(void);
+};
+
+#endif
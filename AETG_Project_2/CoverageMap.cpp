@@ -0,0 +1,834 @@
+/**
+ *  @file       CoverageMap.cpp
+ *  @brief      CCoverageMap class implementation
+ *  @author     Mark L. Short
+ *  @date       October 18, 2026
+ */
+
+#include "stdafx.h"
+
+#include <algorithm>
+#include <bitset>
+#include <climits>
+#include "ComponentSystem.h"
+#include "MathUtility.h"
+#include "ParallelUtility.h"
+#include "TestCase.h"
+
+#include "CoverageMap.h"
+
+/// number of bits stored in each bitmap word
+constexpr const size_t BITS_PER_WORD     = sizeof(QWORD) * CHAR_BIT;
+
+/// minimum number of column combinations worth handing to a fill thread
+constexpr const size_t COMBINATION_GRAIN = 4096;
+
+/// largest size of a spilled shard, in words
+constexpr const size_t MAX_SHARD_WORDS   = (64 << 20) / sizeof(QWORD);
+
+/// number of shards a spilled bitmap is cut into, unless they would grow 
+/// beyond MAX_SHARD_WORDS or below the allocation granularity
+constexpr const size_t NUM_SHARDS        = 64;
+
+/// kinds of run of an encoded bitmap, held in the top bits of a run's header
+constexpr const QWORD  RUN_ZEROS         = 0;
+constexpr const QWORD  RUN_ONES          = 1;
+constexpr const QWORD  RUN_LITERAL       = 2;
+
+/// position of the kind within a run's header, the word count lying below it
+constexpr const WORD   RUN_KIND_SHIFT    = 62;
+constexpr const QWORD  RUN_COUNT_MASK    = (static_cast<QWORD>(1) << RUN_KIND_SHIFT) - 1;
+
+/**
+  @brief  Counts the set bits in a range of a bitmap
+
+  @param [in] pWords         start of the bitmap
+  @param [in] nFirst         first bit position of the range
+  @param [in] nCount         number of bits in the range
+
+  @retval size_t             containing the number of set bits
+*/
+static size_t CountBits(const QWORD* pWords, size_t nFirst, size_t nCount) noexcept
+{
+    size_t nResult = 0;
+
+    while (nCount > 0)
+    {
+        size_t nBit   = nFirst % BITS_PER_WORD;
+        size_t nSpan  = std::min(nCount, BITS_PER_WORD - nBit);
+        QWORD  qWord  = pWords[nFirst / BITS_PER_WORD] >> nBit;
+
+        if (nSpan < BITS_PER_WORD)
+            qWord &= (static_cast<QWORD>(1) << nSpan) - 1;
+
+        nResult += std::bitset<BITS_PER_WORD>(qWord).count( );
+
+        nFirst  += nSpan;
+        nCount  -= nSpan;
+    }
+
+    return nResult;
+}
+
+CCoverageMap::CCoverageMap(const CCoverageMap& rhs)
+    : CTupleSpace(rhs),
+      m_nNumUncovered(rhs.m_nNumUncovered),
+      m_nNumWords(rhs.m_nNumWords),
+      m_rgOffsets(rhs.m_rgOffsets),
+      m_rgBits(rhs.m_rgBits),
+      m_pBits((rhs.m_pBits == rhs.m_rgBits.data()) ? m_rgBits.data() : rhs.m_pBits),
+      m_rgShards(rhs.m_rgShards),
+      m_nShardShift(rhs.m_nShardShift),
+      m_pShardFile(),
+      m_cbSpillThreshold(rhs.m_cbSpillThreshold),
+      m_strSpillDir(rhs.m_strSpillDir)
+{
+    // the released shards of a spilled bitmap are fully covered
+    if (rhs.m_pShardFile)
+    {
+        m_rgBits.assign(m_nNumWords, 0);
+        m_pBits = m_rgBits.data( );
+
+        for (const auto& it : rhs.m_rgShards)
+        {
+            if (it.pWords)
+                std::copy(it.pWords, it.pWords + it.nNumWords, m_pBits + it.nFirstWord);
+        }
+    }
+
+    UseSingleShard(m_nNumUncovered);
+}
+
+CCoverageMap&
+CCoverageMap::operator=(const CCoverageMap& rhs)
+{
+    if (this != &rhs)
+        *this = CCoverageMap(rhs);
+
+    return *this;
+}
+
+bool
+CCoverageMap::Init(const CComponentSystem& system, WORD nT, bool bAllocate)
+{
+    bool bResult = CTupleSpace::Init(system, nT);
+
+    if (bResult)
+        InitLayout(bAllocate);
+
+    return bResult;
+}
+
+bool
+CCoverageMap::Init(const std::vector<LEVEL_T>& rgMinLevel, 
+                   const std::vector<LEVEL_T>& rgNumLevels, WORD nT)
+{
+    bool bResult = CTupleSpace::Init(rgMinLevel, rgNumLevels, nT);
+
+    if (bResult)
+        InitLayout(true);
+
+    return bResult;
+}
+
+void
+CCoverageMap::InitLayout(bool bAllocate)
+{
+    m_rgOffsets.resize(m_nNumCombinations + 1);
+
+    FACTOR_T rgColumns[MAX_T_WAY];
+    ResetColumns(rgColumns, m_nT);
+
+    // lay out one word aligned block per column combination, in rank order
+    size_t nOffset    = 0;
+    size_t nRank      = 0;
+    size_t nNumTuples = 0;
+    do
+    {
+        size_t nBlockSize = GetBlockSize(rgColumns);
+
+        m_rgOffsets[nRank++] = nOffset;
+        nOffset    += (nBlockSize + BITS_PER_WORD - 1) / BITS_PER_WORD;
+        nNumTuples += nBlockSize;
+    } while (NextCombination(rgColumns, m_nT, m_nNumFactors));
+
+    m_rgOffsets[nRank] = nOffset;
+    m_nNumWords        = nOffset;
+    m_nNumUncovered    = 0;
+
+    m_pShardFile.reset( );
+    std::vector<QWORD>().swap(m_rgBits);
+    m_pBits = nullptr;
+    m_rgShards.assign(1, SHARD{ nullptr, 0, nOffset, nNumTuples, 0 });
+
+    if (bAllocate)
+    {
+        // an unknown memory size never spills
+        QWORD cbThreshold = m_cbSpillThreshold ? m_cbSpillThreshold : (GetPhysicalMemorySize() / 2);
+
+        if ((cbThreshold > 0) && (nOffset * sizeof(QWORD) > cbThreshold) && Spill())
+            return;
+
+        m_rgBits.assign(nOffset, 0);
+        m_pBits = m_rgBits.data( );
+    }
+
+    UseSingleShard(0);
+}
+
+bool
+CCoverageMap::Spill(void)
+{
+    // a power of two number of combinations per shard locates a rank's 
+    // shard with a shift
+    size_t nWordsPerRank = std::max<size_t>((m_nNumWords + m_nNumCombinations - 1) / m_nNumCombinations, 1);
+    size_t nShardWords   = std::max(CShardFile::GetAllocationGranularity() / sizeof(QWORD),
+                                    std::min(MAX_SHARD_WORDS, m_nNumWords / NUM_SHARDS));
+
+    m_nShardShift = 0;
+    while ((static_cast<size_t>(2) << m_nShardShift) * nWordsPerRank <= nShardWords)
+        m_nShardShift++;
+
+    size_t nNumShards = ((m_nNumCombinations - 1) >> m_nShardShift) + 1;
+
+    m_rgShards.assign(nNumShards, SHARD{ nullptr, 0, 0, 0, 0 });
+
+    FACTOR_T rgColumns[MAX_T_WAY];
+    ResetColumns(rgColumns, m_nT);
+
+    size_t nRank = 0;
+    do
+    {
+        m_rgShards[nRank >> m_nShardShift].nNumTuples += GetBlockSize(rgColumns);
+        nRank++;
+    } while (NextCombination(rgColumns, m_nT, m_nNumFactors));
+
+    std::vector<size_t> rgShardSize(nNumShards);
+
+    for (size_t nShard = 0; nShard < nNumShards; nShard++)
+    {
+        size_t nFirst = 0;
+        size_t nLast  = 0;
+        GetShardRanks(nShard, nFirst, nLast);
+
+        m_rgShards[nShard].nFirstWord = m_rgOffsets[nFirst];
+        m_rgShards[nShard].nNumWords  = m_rgOffsets[nLast] - m_rgOffsets[nFirst];
+        rgShardSize[nShard]           = m_rgShards[nShard].nNumWords * sizeof(QWORD);
+    }
+
+    // the shards stay unmapped, as released, until the next Fill
+    std::unique_ptr<CShardFile> pShardFile(new CShardFile);
+
+    if (pShardFile->Create(m_strSpillDir.empty() ? nullptr : m_strSpillDir.c_str(), rgShardSize) == false)
+        return false;
+
+    m_pShardFile = std::move(pShardFile);
+
+    return true;
+}
+
+void
+CCoverageMap::SetSpill(const TCHAR* szDirectory, QWORD cbThreshold)
+{
+    m_strSpillDir      = szDirectory ? szDirectory : _T("");
+    m_cbSpillThreshold = cbThreshold;
+}
+
+void
+CCoverageMap::GetShardRanks(size_t nShard, size_t& nFirst, size_t& nLast) const noexcept
+{
+    nFirst = nShard << m_nShardShift;
+    nLast  = ((m_nNumCombinations - nFirst) >> m_nShardShift) ? (nFirst + (static_cast<size_t>(1) << m_nShardShift))
+                                                              : m_nNumCombinations;
+}
+
+void
+CCoverageMap::CoverShard(size_t nShard, size_t nCovered) noexcept
+{
+    SHARD& shard = m_rgShards[nShard];
+
+    shard.nNumUncovered -= nCovered;
+
+    if ((shard.nNumUncovered == 0) && (nCovered > 0) && m_pShardFile)
+    {
+        m_pShardFile->Release(nShard);
+        shard.pWords = nullptr;
+    }
+}
+
+void
+CCoverageMap::UseSingleShard(size_t nNumUncovered) noexcept
+{
+    size_t nNumTuples = 0;
+
+    for (const auto& it : m_rgShards)
+        nNumTuples += it.nNumTuples;
+
+    m_rgShards.resize(1);
+    m_rgShards[0]  = SHARD{ m_pBits, 0, m_nNumWords, nNumTuples, nNumUncovered };
+    m_nShardShift  = sizeof(size_t) * CHAR_BIT - 1;
+}
+
+bool
+CCoverageMap::Attach(QWORD* pBits, size_t nNumWords, size_t nNumUncovered) noexcept
+{
+    if ((pBits == nullptr) || (nNumWords != m_nNumWords))
+        return false;
+
+    m_pShardFile.reset( );
+    std::vector<QWORD>().swap(m_rgBits);
+
+    m_pBits         = pBits;
+    m_nNumUncovered = nNumUncovered;
+
+    UseSingleShard(nNumUncovered);
+
+    return true;
+}
+
+void
+CCoverageMap::Detach(void)
+{
+    if (m_pShardFile)
+        return;
+
+    if ((m_pBits == nullptr) || (m_pBits != m_rgBits.data()))
+    {
+        m_rgBits.assign(m_nNumWords, 0);
+        m_pBits         = m_rgBits.data( );
+        m_nNumUncovered = 0;
+
+        UseSingleShard(0);
+    }
+}
+
+size_t
+CCoverageMap::Fill(std::vector<size_t>& rgLevelCount)
+{
+    // a spilled bitmap that can no longer be mapped is brought into memory
+    if (m_pShardFile)
+    {
+        for (size_t nShard = 0; nShard < m_rgShards.size(); nShard++)
+        {
+            m_rgShards[nShard].pWords = static_cast<QWORD*>(m_pShardFile->Map(nShard));
+
+            if (m_rgShards[nShard].pWords == nullptr)
+            {
+                m_pShardFile.reset( );
+                m_rgBits.assign(m_nNumWords, 0);
+                m_pBits = m_rgBits.data( );
+
+                UseSingleShard(0);
+                break;
+            }
+        }
+    }
+
+    unsigned int nNumThreads = GetNumWorkerThreads( );
+
+    // per-thread tallies, reduced once all threads have completed
+    std::vector<std::vector<size_t>> rgFactorCount(nNumThreads, 
+                                                   std::vector<size_t>(m_nNumFactors, 0));
+    std::vector<size_t>              rgUncovered  (nNumThreads, 0);
+
+    ParallelForRange(0, m_nNumCombinations, COMBINATION_GRAIN, 
+        [&](size_t nFirst, size_t nLast, unsigned int nPartition)
+        {
+            FACTOR_T rgColumns[MAX_T_WAY];
+            UnrankCombination(nFirst, rgColumns, m_nT, m_nNumFactors);
+
+            std::vector<size_t>& rgCount = rgFactorCount[nPartition];
+
+            for (size_t nRank = nFirst; nRank < nLast; nRank++)
+            {
+                size_t nBlockSize = GetBlockSize(rgColumns);
+                QWORD* pWords     = GetBlock(nRank);
+                size_t nFullWords = nBlockSize / BITS_PER_WORD;
+                size_t nRemainder = nBlockSize % BITS_PER_WORD;
+
+                std::fill(pWords, pWords + nFullWords, ~static_cast<QWORD>(0));
+                if (nRemainder)
+                    pWords[nFullWords] = (static_cast<QWORD>(1) << nRemainder) - 1;
+
+                // each level of a column occurs once for every combination 
+                // of levels of the remaining columns
+                for (WORD i = 0; i < m_nT; i++)
+                    rgCount[rgColumns[i]] += nBlockSize / m_rgNumLevels[rgColumns[i]];
+
+                rgUncovered[nPartition] += nBlockSize;
+
+                NextCombination(rgColumns, m_nT, m_nNumFactors);
+            }
+        });
+
+    LEVEL_T nMaxLevel = 0;
+    for (FACTOR_T nCurFactor = 0; nCurFactor < m_nNumFactors; nCurFactor++)
+        nMaxLevel = std::max<LEVEL_T>(nMaxLevel, m_rgMinLevel[nCurFactor] + 
+                                                 m_rgNumLevels[nCurFactor] - 1);
+
+    rgLevelCount.assign(nMaxLevel + 1, 0);
+    m_nNumUncovered = 0;
+
+    for (unsigned int i = 0; i < nNumThreads; i++)
+    {
+        for (FACTOR_T nCurFactor = 0; nCurFactor < m_nNumFactors; nCurFactor++)
+        {
+            size_t nCount = rgFactorCount[i][nCurFactor];
+            if (nCount)
+            {
+                for (LEVEL_T n = 0; n < m_rgNumLevels[nCurFactor]; n++)
+                    rgLevelCount[m_rgMinLevel[nCurFactor] + n] += nCount;
+            }
+        }
+        m_nNumUncovered += rgUncovered[i];
+    }
+
+    for (auto& it : m_rgShards)
+        it.nNumUncovered = it.nNumTuples;
+
+    return m_nNumUncovered;
+}
+
+void
+CCoverageMap::EncodeRuns(std::vector<QWORD>& rgRuns) const
+{
+    size_t nHeader = 0;     // position of the current run's header
+
+    rgRuns.clear( );
+
+    auto Append = [&](QWORD qWord)
+    {
+        QWORD nKind = (qWord == 0)                       ? RUN_ZEROS :
+                      (qWord == ~static_cast<QWORD>(0))  ? RUN_ONES  : RUN_LITERAL;
+
+        if (rgRuns.empty() || ((rgRuns[nHeader] >> RUN_KIND_SHIFT) != nKind))
+        {
+            nHeader = rgRuns.size( );
+            rgRuns.push_back(nKind << RUN_KIND_SHIFT);
+        }
+
+        rgRuns[nHeader]++;
+
+        if (nKind == RUN_LITERAL)
+            rgRuns.push_back(qWord);
+    };
+
+    // a released shard is fully covered
+    for (const auto& shard : m_rgShards)
+    {
+        for (size_t w = 0; w < shard.nNumWords; w++)
+            Append(shard.pWords ? shard.pWords[w] : 0);
+    }
+}
+
+bool
+CCoverageMap::DecodeRuns(const std::vector<QWORD>& rgRuns, size_t nNumUncovered)
+{
+    for (const auto& shard : m_rgShards)
+    {
+        if ((shard.pWords == nullptr) && (shard.nNumWords > 0))
+            return false;
+    }
+
+    size_t nShard = 0;
+    size_t nWord  = 0;      // position within the shard
+    size_t nTotal = 0;
+
+    for (auto& shard : m_rgShards)
+        shard.nNumUncovered = 0;
+
+    for (size_t i = 0; i < rgRuns.size(); i++)
+    {
+        QWORD  nKind  = rgRuns[i] >> RUN_KIND_SHIFT;
+        size_t nCount = static_cast<size_t>(rgRuns[i] & RUN_COUNT_MASK);
+
+        if ((nKind > RUN_LITERAL) || ((nKind == RUN_LITERAL) && (nCount > rgRuns.size() - i - 1)))
+            return false;
+
+        for ( ; nCount > 0; nCount--)
+        {
+            while ((nShard < m_rgShards.size()) && (nWord == m_rgShards[nShard].nNumWords))
+            {
+                nShard++;
+                nWord = 0;
+            }
+
+            if (nShard == m_rgShards.size())
+                return false;
+
+            QWORD qWord = (nKind == RUN_ZEROS) ? 0 :
+                          (nKind == RUN_ONES)  ? ~static_cast<QWORD>(0) : rgRuns[++i];
+            size_t nBits = std::bitset<BITS_PER_WORD>(qWord).count( );
+
+            m_rgShards[nShard].pWords[nWord++]  = qWord;
+            m_rgShards[nShard].nNumUncovered   += nBits;
+            nTotal                             += nBits;
+        }
+    }
+
+    // every word must have been restored
+    for ( ; nShard < m_rgShards.size(); nShard++, nWord = 0)
+    {
+        if (nWord < m_rgShards[nShard].nNumWords)
+            return false;
+    }
+
+    if (nTotal != nNumUncovered)
+        return false;
+
+    m_nNumUncovered = nTotal;
+
+    for (size_t n = 0; n < m_rgShards.size(); n++)
+    {
+        if ((m_rgShards[n].nNumUncovered == 0) && m_pShardFile)
+        {
+            m_pShardFile->Release(n);
+            m_rgShards[n].pWords = nullptr;
+        }
+    }
+
+    return true;
+}
+
+size_t
+CCoverageMap::CountUncovered(const CTestCase& TestCase) const
+{
+    size_t nResult = 0;
+
+    if ((m_nNumUncovered > 0) && (TestCase.get_Size() >= m_nNumFactors))
+    {
+        FACTOR_T rgColumns[MAX_T_WAY];
+
+        for (size_t nShard = 0; nShard < m_rgShards.size(); nShard++)
+        {
+            // a fully covered shard holds nothing, and may not be mapped
+            if (m_rgShards[nShard].nNumUncovered == 0)
+                continue;
+
+            size_t nRank = 0;
+            size_t nLast = 0;
+            GetShardRanks(nShard, nRank, nLast);
+            UnrankCombination(nRank, rgColumns, m_nT, m_nNumFactors);
+
+            for ( ; nRank < nLast; nRank++)
+            {
+                size_t nIndex = 0;
+                if (GetTupleIndex(rgColumns, TestCase, nIndex))
+                {
+                    const QWORD* pWords = GetBlock(nRank);
+
+                    if (pWords[nIndex / BITS_PER_WORD] & (static_cast<QWORD>(1) << (nIndex % BITS_PER_WORD)))
+                        nResult++;
+                }
+                NextCombination(rgColumns, m_nT, m_nNumFactors);
+            }
+        }
+    }
+
+    return nResult;
+}
+
+size_t
+CCoverageMap::Cover(const CTestCase& TestCase, std::vector<size_t>& rgLevelCount)
+{
+    size_t nResult = 0;
+
+    if ((m_nNumUncovered > 0) && (TestCase.get_Size() >= m_nNumFactors))
+    {
+        FACTOR_T rgColumns[MAX_T_WAY];
+
+        for (size_t nShard = 0; nShard < m_rgShards.size(); nShard++)
+        {
+            if (m_rgShards[nShard].nNumUncovered == 0)
+                continue;
+
+            size_t nRank    = 0;
+            size_t nLast    = 0;
+            size_t nCovered = 0;
+            GetShardRanks(nShard, nRank, nLast);
+            UnrankCombination(nRank, rgColumns, m_nT, m_nNumFactors);
+
+            for ( ; nRank < nLast; nRank++)
+            {
+                size_t nIndex = 0;
+                if (GetTupleIndex(rgColumns, TestCase, nIndex))
+                {
+                    QWORD* pWord = GetBlock(nRank) + nIndex / BITS_PER_WORD;
+                    QWORD  qMask = static_cast<QWORD>(1) << (nIndex % BITS_PER_WORD);
+
+                    if (*pWord & qMask)
+                    {
+                        *pWord &= ~qMask;
+
+                        for (WORD i = 0; i < m_nT; i++)
+                            rgLevelCount[TestCase[rgColumns[i]]] --;
+
+                        nCovered++;
+                    }
+                }
+                NextCombination(rgColumns, m_nT, m_nNumFactors);
+            }
+
+            CoverShard(nShard, nCovered);
+            nResult += nCovered;
+        }
+
+        m_nNumUncovered -= nResult;
+    }
+
+    return nResult;
+}
+
+size_t
+CCoverageMap::CountConsistent(const FACTOR_T* rgColumns, const CTestCase& TestCase) const
+{
+    size_t  nResult = 0;
+    size_t  nRank   = GetRank(rgColumns);
+
+    if (GetShard(nRank).nNumUncovered == 0)
+        return 0;
+
+    LEVEL_T rgFirst[MAX_T_WAY];
+    LEVEL_T rgLast [MAX_T_WAY];
+    LEVEL_T rgCur  [MAX_T_WAY];
+
+    for (WORD i = 0; i < m_nT; i++)
+    {
+        FACTOR_T nCurFactor = rgColumns[i];
+        LEVEL_T  nLevel     = TestCase[nCurFactor];
+
+        if (IsValidLevel(nLevel))
+        {
+            rgFirst[i] = nLevel - m_rgMinLevel[nCurFactor];
+            rgLast [i] = rgFirst[i];
+        }
+        else
+        {
+            rgFirst[i] = 0;
+            rgLast [i] = m_rgNumLevels[nCurFactor] - 1;
+        }
+        rgCur[i] = rgFirst[i];
+    }
+
+    const QWORD* pWords = GetBlock(nRank);
+    WORD         nLast  = m_nT - 1;
+    size_t       nSpan  = rgLast[nLast] - rgFirst[nLast] + 1;
+
+    // the levels of the last column are contiguous within the block, so the
+    // odometer only needs to turn over the leading columns
+    for (;;)
+    {
+        size_t nIndex = 0;
+        for (WORD i = 0; i < nLast; i++)
+            nIndex = nIndex * m_rgNumLevels[rgColumns[i]] + rgCur[i];
+
+        nIndex = nIndex * m_rgNumLevels[rgColumns[nLast]] + rgFirst[nLast];
+
+        nResult += CountBits(pWords, nIndex, nSpan);
+
+        int i = static_cast<int>(nLast) - 1;
+        for ( ; i >= 0; i--)
+        {
+            if (rgCur[i] < rgLast[i])
+            {
+                rgCur[i]++;
+                break;
+            }
+            rgCur[i] = rgFirst[i];
+        }
+        if (i < 0)
+            break;
+    }
+
+    return nResult;
+}
+
+double
+CCoverageMap::CalcLevelDensity(FACTOR_T nFactor, const CTestCase& TestCase) const
+{
+    double   dResult = 0.0;
+    WORD     nOthers = m_nT - 1;
+
+    FACTOR_T rgOthers [MAX_T_WAY];
+    FACTOR_T rgColumns[MAX_T_WAY];
+
+    // visit every combination of the remaining factors, drawn from the 
+    // [0 .. m_nNumFactors - 2] sequence with nFactor removed from it
+    ResetColumns(rgOthers, nOthers);
+
+    do
+    {
+        size_t nOpen = 1;
+        WORD   j     = 0;
+        bool   bDone = false;
+
+        for (WORD i = 0; i < nOthers; i++)
+        {
+            FACTOR_T nCurFactor = (rgOthers[i] < nFactor) ? rgOthers[i] : rgOthers[i] + 1;
+
+            if (!bDone && (nCurFactor > nFactor))
+            {
+                rgColumns[j++] = nFactor;
+                bDone          = true;
+            }
+            rgColumns[j++] = nCurFactor;
+
+            if (IsValidLevel(TestCase[nCurFactor]) == false)
+                nOpen *= m_rgNumLevels[nCurFactor];
+        }
+        if (!bDone)
+            rgColumns[j] = nFactor;
+
+        dResult += static_cast<double>(CountConsistent(rgColumns, TestCase)) / nOpen;
+
+    } while ((nOthers > 0) && NextCombination(rgOthers, nOthers, m_nNumFactors - 1));
+
+    return dResult;
+}
+
+bool
+CCoverageMap::IsUncovered(const FACTOR_T* rgColumns, const LEVEL_T* rgLevels) const noexcept
+{
+    size_t nRank  = GetRank(rgColumns);
+
+    if (GetShard(nRank).nNumUncovered == 0)
+        return false;
+
+    size_t nIndex = GetTupleIndex(rgColumns, rgLevels);
+
+    return (GetBlock(nRank)[nIndex / BITS_PER_WORD] & 
+            (static_cast<QWORD>(1) << (nIndex % BITS_PER_WORD))) != 0;
+}
+
+bool
+CCoverageMap::CoverTuple(const FACTOR_T* rgColumns, const LEVEL_T* rgLevels, 
+                         std::vector<size_t>& rgLevelCount) noexcept
+{
+    bool   bResult = false;
+    size_t nRank   = GetRank(rgColumns);
+
+    if (GetShard(nRank).nNumUncovered == 0)
+        return false;
+
+    size_t nIndex  = GetTupleIndex(rgColumns, rgLevels);
+    QWORD* pWord   = GetBlock(nRank) + nIndex / BITS_PER_WORD;
+    QWORD  qMask   = static_cast<QWORD>(1) << (nIndex % BITS_PER_WORD);
+
+    if (*pWord & qMask)
+    {
+        *pWord &= ~qMask;
+
+        for (WORD i = 0; i < m_nT; i++)
+            rgLevelCount[rgLevels[i]] --;
+
+        m_nNumUncovered--;
+        CoverShard(nRank >> m_nShardShift, 1);
+        bResult = true;
+    }
+
+    return bResult;
+}
+
+bool
+CCoverageMap::CountLastColumnLevels(const FACTOR_T* rgColumns, const CTestCase& TestCase,
+                                    std::vector<size_t>& rgCounts) const
+{
+    WORD   nLast  = m_nT - 1;
+    size_t nIndex = 0;
+
+    for (WORD i = 0; i < nLast; i++)
+    {
+        LEVEL_T nLevel = TestCase[rgColumns[i]];
+
+        if (IsValidLevel(nLevel) == false)
+            return false;
+
+        nIndex = nIndex * m_rgNumLevels[rgColumns[i]] + (nLevel - m_rgMinLevel[rgColumns[i]]);
+    }
+
+    size_t nRank = GetRank(rgColumns);
+
+    if (GetShard(nRank).nNumUncovered == 0)
+        return true;
+
+    LEVEL_T      nNumLevels = m_rgNumLevels[rgColumns[nLast]];
+    const QWORD* pWords     = GetBlock(nRank);
+
+    // the levels of the last column occupy a contiguous run of bits
+    nIndex *= nNumLevels;
+    for (LEVEL_T n = 0; n < nNumLevels; n++, nIndex++)
+    {
+        if (pWords[nIndex / BITS_PER_WORD] & (static_cast<QWORD>(1) << (nIndex % BITS_PER_WORD)))
+            rgCounts[n]++;
+    }
+
+    return true;
+}
+
+size_t
+CCoverageMap::GetUncoveredTuples(const FACTOR_T* rgColumns, std::vector<LEVEL_T>& rgTuples) const
+{
+    size_t nResult = 0;
+    size_t nRank   = GetRank(rgColumns);
+
+    if (GetShard(nRank).nNumUncovered == 0)
+        return 0;
+
+    const QWORD* pWords = GetBlock(nRank);
+
+    for (size_t w = 0; w < m_rgOffsets[nRank + 1] - m_rgOffsets[nRank]; w++)
+    {
+        QWORD qWord = pWords[w];
+
+        for (size_t nBit = 0; qWord != 0; nBit++, qWord >>= 1)
+        {
+            if (qWord & 1)
+            {
+                LEVEL_T rgLevels[MAX_T_WAY];
+                GetTupleLevels(rgColumns, w * BITS_PER_WORD + nBit, rgLevels);
+
+                rgTuples.insert(rgTuples.end(), rgLevels, rgLevels + m_nT);
+                nResult++;
+            }
+        }
+    }
+
+    return nResult;
+}
+
+bool
+CCoverageMap::FindFirstUncovered(FACTOR_T* rgColumns, LEVEL_T* rgLevels) const
+{
+    bool bResult = false;
+
+    for (const auto& shard : m_rgShards)
+    {
+        if (shard.nNumUncovered == 0)
+            continue;
+
+        const QWORD* pBegin = shard.pWords;
+        const QWORD* pEnd   = pBegin + shard.nNumWords;
+        const QWORD* it     = std::find_if(pBegin, pEnd, [](QWORD q) { return q != 0; });
+
+        if (it != pEnd)
+        {
+            size_t nWord = shard.nFirstWord + (it - pBegin);
+            size_t nBit  = 0;
+
+            while ((*it & (static_cast<QWORD>(1) << nBit)) == 0)
+                nBit++;
+
+            // the owning block is the last one starting at or before the word
+            size_t nRank = std::upper_bound(m_rgOffsets.begin(), m_rgOffsets.end(), nWord) - 
+                           m_rgOffsets.begin() - 1;
+
+            UnrankCombination(nRank, rgColumns, m_nT, m_nNumFactors);
+            GetTupleLevels(rgColumns, (nWord - m_rgOffsets[nRank]) * BITS_PER_WORD + nBit, rgLevels);
+
+            bResult = true;
+            break;
+        }
+    }
+
+    return bResult;
+}
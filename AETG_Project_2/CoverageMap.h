@@ -0,0 +1,447 @@
+/**
+ *  @file       CoverageMap.h
+ *  @brief      CCoverageMap class interface
+ *
+ *  Provides type definitions for: CCoverageMap
+ *
+ *  @author     Mark L. Short
+ *  @date       October 18, 2026
+ */
+#pragma once
+
+#if !defined(__COVERAGE_MAP_H__)
+#define __COVERAGE_MAP_H__
+
+#ifndef __COMMON_DEF_H__
+    #include "CommonDef.h"
+#endif
+
+#ifndef _MEMORY_
+    #include <memory>
+#endif
+
+#ifndef _STRING_
+    #include <string>
+#endif
+
+#ifndef _VECTOR_
+    #include <vector>
+#endif
+
+#ifndef __SHARD_FILE_H__
+    #include "ShardFile.h"
+#endif
+
+#ifndef __TUPLE_SPACE_H__
+    #include "TupleSpace.h"
+#endif
+
+/**
+  @brief  A dense bitmap of uncovered t-way tuples
+
+  Every t-way variable-value configuration of the component system is assigned
+  a single bit.  Column combinations are laid out in lexicographic rank order,
+  each one owning a block of words large enough to hold the product of its 
+  factors' level counts.  Within a block, a tuple's bit position is the mixed 
+  radix value of its local (zero based) levels.
+
+  Keeping each block word aligned means two column combinations never share a 
+  word, so ranges of combinations can be filled or updated from separate 
+  threads without any synchronization.  A set bit denotes an uncovered tuple.
+
+  The bitmap is normally owned by the map, but may instead be attached to 
+  words held elsewhere, such as a copy-on-write view of a shared baseline, 
+  for as long as the words remain valid.
+
+  A bitmap too large for memory is spilled to a temporary file instead, cut 
+  into shards of consecutive column combination ranks, each mapped as a view
+  of its own.  Every shard keeps a count of its uncovered tuples; the passes
+  over the bitmap visit the shards in rank order, skipping those fully 
+  covered, which are unmapped and so leave the working set, until the next 
+  Fill maps them again.
+*/
+class CCoverageMap : public CTupleSpace
+{
+    /// a run of column combinations whose blocks are stored together
+    struct SHARD
+    {
+        QWORD*   pWords;          ///< the words of the shard, or nullptr if released
+        size_t   nFirstWord;      ///< bitmap position of the first word
+        size_t   nNumWords;       ///< number of words
+        size_t   nNumTuples;      ///< number of tuples of the shard's combinations
+        size_t   nNumUncovered;   ///< number of those that are uncovered
+    };
+
+    size_t                m_nNumUncovered;    ///< current count of uncovered tuples
+    size_t                m_nNumWords;        ///< size of the bitmap, in words
+    std::vector<size_t>   m_rgOffsets;        ///< first word of each column combination, by rank
+    std::vector<QWORD>    m_rgBits;           ///< storage of an owned bitmap
+    QWORD*                m_pBits;            ///< the uncovered tuple bitmap, owned or attached, 
+                                              ///< nullptr if spilled
+    std::vector<SHARD>    m_rgShards;         ///< the shards, a single one unless spilled
+    WORD                  m_nShardShift;      ///< log2 of the combinations per shard
+    std::unique_ptr<CShardFile> m_pShardFile; ///< file holding a spilled bitmap
+    QWORD                 m_cbSpillThreshold; ///< size beyond which a bitmap is spilled, 
+                                              ///< 0 for half of the physical memory
+    std::basic_string<TCHAR> m_strSpillDir;   ///< directory of spilled bitmaps, empty 
+                                              ///< for the temporary directory
+
+public:
+    /// Default Constructor
+    CCoverageMap() noexcept
+        : CTupleSpace(),
+          m_nNumUncovered(0),
+          m_nNumWords(0),
+          m_rgOffsets(),
+          m_rgBits(),
+          m_pBits(nullptr),
+          m_rgShards(),
+          m_nShardShift(0),
+          m_pShardFile(),
+          m_cbSpillThreshold(0),
+          m_strSpillDir()
+    { };
+
+    /// Destructor
+    ~CCoverageMap() = default;
+
+    /// Copy Constructor, an owned or spilled bitmap being copied into memory 
+    /// and an attached one shared
+    CCoverageMap(const CCoverageMap& rhs);
+
+    /// Move Constructor
+    CCoverageMap(CCoverageMap&& rhs) noexcept = default;
+
+    /// Copy Assignment, an owned or spilled bitmap being copied into memory 
+    /// and an attached one shared
+    CCoverageMap& operator=(const CCoverageMap& rhs);
+
+    /// Move Assignment
+    CCoverageMap& operator=(CCoverageMap&& rhs) noexcept = default;
+
+/**
+  @brief  class initializer
+
+  Calculates the bitmap layout for the given system and allocates storage for
+  it, spilling it to a file if larger than the spill threshold.  All tuples 
+  are initially marked as covered.
+
+  @param [in] system         target CComponentSystem
+  @param [in] nT             the T-way value, [1..MAX_T_WAY]
+  @param [in] bAllocate      false to leave the map without storage, for 
+                             Attach to supply
+
+  @retval true               on success
+  @retval false              on error or invalid parameter values
+*/
+    bool   Init(const CComponentSystem& system, WORD nT, bool bAllocate = true);
+
+/**
+  @brief  class initializer, from explicit level ranges
+
+  @param [in] rgMinLevel     minimum level, indexed by factor
+  @param [in] rgNumLevels    number of levels, indexed by factor
+  @param [in] nT             the T-way value, [1..MAX_T_WAY]
+
+  @retval true               on success
+  @retval false              on error or invalid parameter values
+*/
+    bool   Init(const std::vector<LEVEL_T>& rgMinLevel, 
+                const std::vector<LEVEL_T>& rgNumLevels, WORD nT);
+
+/**
+  @brief  Sets where and beyond which size bitmaps are spilled to a file
+
+  Takes effect from the next Init.
+
+  @param [in] szDirectory    directory of the file, or nullptr for the 
+                             temporary directory
+  @param [in] cbThreshold    size of the bitmap beyond which it is spilled, 
+                             in bytes, or 0 for half of the physical memory
+*/
+    void   SetSpill(const TCHAR* szDirectory, QWORD cbThreshold);
+
+/**
+  @brief  Uses words held elsewhere as the bitmap, in place of any owned 
+          storage
+
+  The words must be laid out by a map of the same system and strength, and 
+  remain valid while attached; they are read and written in place.  A 
+  spilled bitmap is discarded.
+
+  @param [in] pBits          the words
+  @param [in] nNumWords      number of words, which must match get_NumWords()
+  @param [in] nNumUncovered  number of set bits in the words
+
+  @retval true               on success
+  @retval false              if the size does not match the layout
+*/
+    bool   Attach(QWORD* pBits, size_t nNumWords, size_t nNumUncovered) noexcept;
+
+/**
+  @brief  Returns to an owned bitmap, all tuples covered, should the map be 
+          attached or without storage; a spilled bitmap is kept
+*/
+    void   Detach(void);
+
+/**
+  @brief  Marks every t-way tuple as uncovered
+
+  The fill is partitioned by column combination rank across threads.  Since 
+  the contents of each block are known in closed form, no tuples are 
+  enumerated; each thread tallies the per-factor level occurrences for its own 
+  range of combinations, which are then reduced into rgLevelCount.
+
+  @param [out] rgLevelCount  uncovered tuple count, indexed by level
+
+  @retval size_t             containing the number of uncovered tuples
+*/
+    size_t Fill(std::vector<size_t>& rgLevelCount);
+
+/**
+  @brief  Encodes the bitmap as runs of words
+
+  Each run starts with a header word holding its kind in the top two bits and
+  its number of words below them: a run of all zero words, a run of all one 
+  words, or a run of literal words, which follow the header.  Since the 
+  blocks are filled whole and covered largely in rank order, a bitmap 
+  encodes to a small fraction of its size early and late in a generation, 
+  and to little more than its size in between.
+
+  @param [out] rgRuns        the encoded bitmap
+*/
+    void   EncodeRuns(std::vector<QWORD>& rgRuns) const;
+
+/**
+  @brief  Restores the bitmap from runs encoded by EncodeRuns
+
+  The map must hold storage of its own, as it does after Fill.
+
+  @param [in] rgRuns         the encoded bitmap, of a map of the same layout
+  @param [in] nNumUncovered  number of uncovered tuples of the encoded bitmap
+
+  @retval true               on success
+  @retval false              if the runs do not fit the layout, or do not hold
+                             nNumUncovered tuples, leaving the bitmap undefined
+*/
+    bool   DecodeRuns(const std::vector<QWORD>& rgRuns, size_t nNumUncovered);
+
+/**
+  @brief  Calculates the number of uncovered tuples contained in a test case
+
+  Only column combinations whose factors have all been assigned valid levels
+  are considered, so this may be used on partial test cases.
+
+  @param [in] TestCase       target CTestCase object
+
+  @retval size_t             number of uncovered tuples in the test case
+*/
+    size_t CountUncovered(const CTestCase& TestCase) const;
+
+/**
+  @brief  Marks all tuples of a test case as covered
+
+  @param [in]     TestCase      target CTestCase object
+  @param [in,out] rgLevelCount  uncovered tuple count, indexed by level, 
+                                decremented for each newly covered tuple
+
+  @retval size_t             number of tuples that were newly covered
+*/
+    size_t Cover(const CTestCase& TestCase, std::vector<size_t>& rgLevelCount);
+
+/**
+  @brief  Calculates the number of uncovered tuples of a column combination
+          that are consistent with a [partial] test case
+
+  Columns without a valid level assigned in the test case act as wildcards, 
+  matching any of their factor's levels.
+
+  @param [in] rgColumns      sorted column combination of get_T() factors
+  @param [in] TestCase       target CTestCase object
+
+  @retval size_t             number of consistent uncovered tuples
+*/
+    size_t CountConsistent(const FACTOR_T* rgColumns, const CTestCase& TestCase) const;
+
+/**
+  @brief  Calculates the local density of a factor's assigned level
+
+  For every column combination containing nFactor, the number of consistent
+  uncovered tuples is weighted by the reciprocal of the number of level 
+  combinations still open in its unassigned columns, as described by Bryce and
+  Colbourn.  The density is the sum of these weights.
+
+  @param [in] nFactor        target factor, which must have a valid level 
+                             assigned in the test case
+  @param [in] TestCase       target CTestCase object
+
+  @retval double             containing the local density
+*/
+    double CalcLevelDensity(FACTOR_T nFactor, const CTestCase& TestCase) const;
+
+/**
+  @brief  Tests whether a single tuple is uncovered
+
+  @param [in] rgColumns      sorted column combination of get_T() factors
+  @param [in] rgLevels       the tuple's level for each of the columns
+
+  @retval true               if the tuple is uncovered
+  @retval false              if the tuple has been covered
+*/
+    bool   IsUncovered(const FACTOR_T* rgColumns, const LEVEL_T* rgLevels) const noexcept;
+
+/**
+  @brief  Marks a single tuple as covered
+
+  @param [in]     rgColumns     sorted column combination of get_T() factors
+  @param [in]     rgLevels      the tuple's level for each of the columns
+  @param [in,out] rgLevelCount  uncovered tuple count, indexed by level
+
+  @retval true               if the tuple was newly covered
+  @retval false              if the tuple had already been covered
+*/
+    bool   CoverTuple(const FACTOR_T* rgColumns, const LEVEL_T* rgLevels, 
+                      std::vector<size_t>& rgLevelCount) noexcept;
+
+/**
+  @brief  Tallies the uncovered tuples of a column combination by the level of
+          its last column
+
+  The leading columns take their levels from the test case, whereas every 
+  level of the last column is considered, regardless of what has been assigned
+  to it.  This is the building block for extending a test case by one factor.
+
+  @param [in]     rgColumns  sorted column combination of get_T() factors
+  @param [in]     TestCase   target CTestCase object
+  @param [in,out] rgCounts   counts to be incremented, indexed by the zero 
+                             based level of the last column
+
+  @retval true               on success
+  @retval false              if any leading column has no valid level assigned
+*/
+    bool   CountLastColumnLevels(const FACTOR_T* rgColumns, const CTestCase& TestCase,
+                                 std::vector<size_t>& rgCounts) const;
+
+/**
+  @brief  Retrieves all of the uncovered tuples of a column combination
+
+  @param [in]     rgColumns  sorted column combination of get_T() factors
+  @param [in,out] rgTuples   destination, to which get_T() levels are appended
+                             for each uncovered tuple
+
+  @retval size_t             containing the number of tuples appended
+*/
+    size_t GetUncoveredTuples(const FACTOR_T* rgColumns, std::vector<LEVEL_T>& rgTuples) const;
+
+/**
+  @brief  Locates the uncovered tuple of the lowest rank
+
+  @param [out] rgColumns     column combination of the uncovered tuple
+  @param [out] rgLevels      the tuple's level for each of the columns
+
+  @retval true               on success
+  @retval false              if there are no uncovered tuples
+*/
+    bool   FindFirstUncovered(FACTOR_T* rgColumns, LEVEL_T* rgLevels) const;
+
+// Primitive data accessors
+/**
+  @brief  Returns the number of uncovered tuples
+
+  @retval size_t             containing the current number of uncovered tuples
+*/
+    inline size_t get_NumUncovered(void) const noexcept
+    { return m_nNumUncovered; };
+
+/**
+  @brief  Returns the size of the bitmap
+
+  @retval size_t             containing the number of words
+*/
+    inline size_t get_NumWords(void) const noexcept
+    { return m_nNumWords; };
+
+/**
+  @brief  Returns the bitmap
+
+  @retval const QWORD*       pointing to the first of get_NumWords() words, 
+                             or nullptr if spilled
+*/
+    inline const QWORD* get_Bits(void) const noexcept
+    { return m_pBits; };
+
+/**
+  @brief  Indicates whether the bitmap is spilled to a file
+
+  @retval bool               true if spilled
+*/
+    inline bool   IsSpilled(void) const noexcept
+    { return (m_pShardFile != nullptr); };
+
+private:
+/**
+  @brief  Locates the block of a column combination
+
+  @param [in] nRank          rank of the column combination, whose shard must
+                             be mapped
+
+  @retval QWORD*             pointing to the first word of the block
+*/
+    inline QWORD* GetBlock(size_t nRank) const noexcept
+    { 
+        const SHARD& shard = m_rgShards[nRank >> m_nShardShift];
+        return shard.pWords + (m_rgOffsets[nRank] - shard.nFirstWord); 
+    };
+
+/**
+  @brief  Returns the shard of a column combination
+
+  @param [in] nRank          rank of the column combination
+
+  @retval const SHARD&       the shard
+*/
+    inline const SHARD& GetShard(size_t nRank) const noexcept
+    { return m_rgShards[nRank >> m_nShardShift]; };
+
+/**
+  @brief  Returns the first rank of a shard and the rank following its last
+
+  @param [in]  nShard        the shard
+  @param [out] nFirst        first rank of the shard
+  @param [out] nLast         rank following the last of the shard
+*/
+    void   GetShardRanks(size_t nShard, size_t& nFirst, size_t& nLast) const noexcept;
+
+/**
+  @brief  Records newly covered tuples of a shard, releasing a spilled shard
+          once it is fully covered
+
+  @param [in] nShard         the shard
+  @param [in] nCovered       number of tuples newly covered
+*/
+    void   CoverShard(size_t nShard, size_t nCovered) noexcept;
+
+/**
+  @brief  Sets up a single shard over a contiguous bitmap
+
+  @param [in] nNumUncovered  number of uncovered tuples of the bitmap
+*/
+    void   UseSingleShard(size_t nNumUncovered) noexcept;
+
+/**
+  @brief  Spills the laid out bitmap to a file of shards, all covered
+
+  @retval true               on success
+  @retval false              if the file could not be created or mapped
+*/
+    bool   Spill(void);
+
+/**
+  @brief  Lays out the bitmap of an initialized tuple space, all covered
+
+  @param [in] bAllocate      false to leave the map without storage
+*/
+    void   InitLayout(bool bAllocate);
+};
+
+#endif
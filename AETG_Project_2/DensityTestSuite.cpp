@@ -0,0 +1,114 @@
+/**
+ *  @file       DensityTestSuite.cpp
+ *  @brief      CDensityTestSuite class implementation
+ *  @author     Mark L. Short
+ *  @date       October 18, 2026
+ */
+
+#include "stdafx.h"
+
+#include <algorithm>
+#include "ComponentSystem.h"
+
+#include "DensityTestSuite.h"
+
+FACTOR_T
+CDensityTestSuite::UpdateFactorDensity(const CComponentSystem& system)
+{
+    FACTOR_T nResult      = FACTOR_INVALID;
+    double   dBestDensity = 0.0;
+
+    m_rgFactorDensity.assign(m_nNumFactors, 0.0);
+
+    for (FACTOR_T nCurFactor = 0; nCurFactor < m_nNumFactors; nCurFactor++)
+    {
+        LEVEL_T nMinFactorLevel = system.GetMinLevel(nCurFactor);
+        LEVEL_T nMaxFactorLevel = system.GetMaxLevel(nCurFactor);
+        size_t  nCount          = 0;
+
+        for (int n = nMinFactorLevel; n <= nMaxFactorLevel; n++)
+            nCount += m_rgLevelCount[n];
+
+        m_rgFactorDensity[nCurFactor] = static_cast<double>(nCount) / 
+                                        (nMaxFactorLevel - nMinFactorLevel + 1);
+
+        if (m_rgFactorDensity[nCurFactor] > dBestDensity)
+        {
+            dBestDensity = m_rgFactorDensity[nCurFactor];
+            nResult      = nCurFactor;
+        }
+    }
+
+    return nResult;
+}
+
+size_t
+CDensityTestSuite::GenerateTestCase(const CComponentSystem& system, CTestCase& TestCase)
+{
+    size_t nResult = 0;
+
+    TestCase.Init(m_nNumFactors);
+
+    if (UpdateFactorDensity(system) != FACTOR_INVALID)
+    {
+        //  1. The level appearing in the greatest number of uncovered tuples is
+        //     fixed first, the lowest level winning any ties.
+        LEVEL_T  nBestLevel = static_cast<LEVEL_T>(std::max_element(m_rgLevelCount.begin(), 
+                                                                    m_rgLevelCount.end()) - 
+                                                   m_rgLevelCount.begin());
+        FACTOR_T nCurFactor = system.GetFactor(nBestLevel);
+
+        TestCase[nCurFactor] = nBestLevel;
+
+        //  2. The remaining factors are assigned in decreasing order of factor
+        //     density, the stable sort keeping the order deterministic.
+        m_rgFactorOrder.resize(m_nNumFactors);
+        for (FACTOR_T i = 0; i < m_nNumFactors; i++)
+            m_rgFactorOrder[i] = i;
+
+        std::stable_sort(m_rgFactorOrder.begin(), m_rgFactorOrder.end(),
+                         [this](FACTOR_T a, FACTOR_T b) 
+                         { return m_rgFactorDensity[a] > m_rgFactorDensity[b]; });
+
+        //  3. Each factor takes the level of greatest local density, given the
+        //     levels already assigned.
+        for (auto nFactor : m_rgFactorOrder)
+        {
+            if (IsValidLevel(TestCase[nFactor]))
+                continue;
+
+            LEVEL_T nMinFactorLevel = system.GetMinLevel(nFactor);
+            LEVEL_T nMaxFactorLevel = system.GetMaxLevel(nFactor);
+            double  dBestDensity    = -1.0;
+
+            nBestLevel = system.HasConstraints() ? LEVEL_INVALID : nMinFactorLevel;
+
+            // levels completing a forbidden tuple are passed over, leaving the
+            // factor unassigned should none remain
+            if (system.HasConstraints())
+                system.get_Constraints().GetBlockingMask(TestCase, nFactor, m_rgBlocking);
+
+            for (int j = nMinFactorLevel; j <= nMaxFactorLevel; j++)
+            {
+                if (system.HasConstraints() && !system.get_Constraints().IsFeasible(m_rgBlocking, j))
+                    continue;
+
+                TestCase[nFactor] = j;
+
+                double dDensity = m_bmpUncoveredT3Tuples.CalcLevelDensity(nFactor, TestCase);
+
+                if (dDensity > dBestDensity)
+                {
+                    dBestDensity = dDensity;
+                    nBestLevel   = j;
+                }
+            }
+
+            TestCase[nFactor] = nBestLevel;
+        }
+
+        nResult = CalculateT3TestCaseCoverage(TestCase);
+    }
+
+    return nResult;
+}
@@ -0,0 +1,95 @@
+/**
+ *  @file       DensityTestSuite.h
+ *  @brief      CDensityTestSuite class interface
+ *
+ *  Provides type definitions for: CDensityTestSuite
+ *
+ *  @author     Mark L. Short
+ *  @date       October 18, 2026
+ */
+
+#pragma once
+
+#if !defined(__DENSITY_TEST_SUITE_H__)
+#define __DENSITY_TEST_SUITE_H__
+
+#ifndef __TEST_SUITE_H__
+    #include "TestSuite.h"
+#endif
+
+/**
+  @brief  Density-based (DDA) test case generation engine
+
+  An implementation of the deterministic density algorithm of Bryce and 
+  Colbourn.  Rather than selecting the best of many randomized candidates, a 
+  single test case is constructed per row, assigning factors in decreasing 
+  order of factor density, with each factor taking the level of greatest local
+  density.  Since the expected number of newly covered tuples never decreases 
+  as levels are assigned, every test case covers at least one uncovered tuple.
+
+  @sa RC Bryce and CJ Colbourn, "A density-based greedy algorithm for higher 
+      strength covering arrays", Softw. Test. Verif. Reliab. 2009
+*/
+class CDensityTestSuite : public CTestSuite
+{
+    std::vector<double>    m_rgFactorDensity;      ///< current factor density, indexed by factor
+    std::vector<FACTOR_T>  m_rgFactorOrder;        ///< factor assignment order of the current row
+    std::vector<QWORD>     m_rgBlocking;           ///< forbidden tuple mask of the factor being assigned
+
+public:
+    /// Default Constructor
+    CDensityTestSuite( ) noexcept
+        : CTestSuite(),
+          m_rgFactorDensity(),
+          m_rgFactorOrder(),
+          m_rgBlocking()
+    { };
+
+    /// Default Destructor
+    virtual ~CDensityTestSuite( ) = default;
+
+/**
+  @brief  Generates the next test case to be added to the suite
+
+  @param [in]   system       CComponentSystem object, containing the inputs
+  @param [out]  TestCase     the resultant CTestCase object
+
+  @retval size_t             containing the number of uncovered 3-way tuples
+                             covered by the test case
+*/
+    virtual size_t GenerateTestCase(const CComponentSystem& system, CTestCase& TestCase) override;
+
+/**
+  @brief  Indicates whether the engine always generates the same suite
+
+  @retval true               the density algorithm is deterministic
+*/
+    virtual bool   IsDeterministic(void) const noexcept override
+    { return true; };
+
+/**
+  @brief  Returns the short name of the engine
+
+  @retval const char*        "dda"
+*/
+    virtual const char* GetEngineName(void) const noexcept override
+    { return "dda"; };
+
+private:
+/**
+  @brief  Updates the factor densities from the current level counts
+
+  The density of a factor is estimated as the mean uncovered tuple count of 
+  its levels, which for a fixed level configuration is proportional to the 
+  number of uncovered tuples involving the factor divided by the number of 
+  level combinations they are drawn from.
+
+  @param [in]   system       CComponentSystem object, containing the inputs
+
+  @retval FACTOR_T           containing the factor of greatest density
+  @retval FACTOR_INVALID     if there are no uncovered tuples
+*/
+    FACTOR_T UpdateFactorDensity(const CComponentSystem& system);
+};
+
+#endif
@@ -0,0 +1,112 @@
+/**
+ *  @file       GaloisField.cpp
+ *  @brief      CGaloisField class implementation
+ *  @author     Mark L. Short
+ *  @date       October 18, 2026
+ */
+
+#include "stdafx.h"
+
+#include "GaloisField.h"
+
+bool
+CGaloisField::IsPrimePower(size_t nNumber, WORD& nPrime, WORD& nDegree) noexcept
+{
+    if (nNumber < 2)
+        return false;
+
+    size_t nFactor = 2;
+    while ((nNumber % nFactor) != 0)
+        nFactor++;
+
+    nPrime  = static_cast<WORD>(nFactor);
+    nDegree = 0;
+
+    while ((nNumber % nFactor) == 0)
+    {
+        nNumber /= nFactor;
+        nDegree++;
+    }
+
+    return nNumber == 1;
+}
+
+bool
+CGaloisField::Init(WORD nOrder)
+{
+    m_nOrder = 0;
+    m_rgExp.clear();
+    m_rgLog.clear();
+
+    if ((nOrder > MAX_FIELD_ORDER) || !IsPrimePower(nOrder, m_nChar, m_nDegree))
+        return false;
+
+    std::vector<WORD> rgDigits(m_nDegree);
+    std::vector<WORD> rgPoly  (m_nDegree);
+
+    // each candidate monic polynomial x^n + c(x) is tried in turn until the
+    // powers of x run through every non-zero element, which makes it primitive
+    for (WORD nPoly = 0; nPoly < nOrder; nPoly++)
+    {
+        for (WORD i = 0, n = nPoly; i < m_nDegree; i++, n /= m_nChar)
+            rgPoly[i] = n % m_nChar;
+
+        m_rgExp.assign(nOrder - 1, 0);
+        m_rgLog.assign(nOrder, 0);
+
+        std::fill(rgDigits.begin(), rgDigits.end(), 0);
+        rgDigits[0] = 1;
+
+        bool bPrimitive = true;
+
+        for (WORD nExp = 0; (nExp < nOrder - 1) && bPrimitive; nExp++)
+        {
+            WORD nElement = 0;
+            for (WORD i = m_nDegree; i > 0; i--)
+                nElement = nElement * m_nChar + rgDigits[i - 1];
+
+            // a repeated element means the powers of x cycle early
+            bPrimitive = (nElement != 0) && 
+                         ((nExp == 0) || ((nElement != 1) && (m_rgLog[nElement] == 0)));
+
+            m_rgExp[nExp]     = nElement;
+            m_rgLog[nElement] = nExp;
+
+            // multiply by x, reducing x^n to -c(x)
+            WORD nTop = rgDigits[m_nDegree - 1];
+            for (WORD i = m_nDegree - 1; i > 0; i--)
+                rgDigits[i] = rgDigits[i - 1];
+            rgDigits[0] = 0;
+
+            for (WORD i = 0; i < m_nDegree; i++)
+                rgDigits[i] = (rgDigits[i] + (m_nChar - rgPoly[i]) * nTop) % m_nChar;
+        }
+
+        if (bPrimitive)
+        {
+            m_nOrder = nOrder;
+            return true;
+        }
+    }
+
+    return false;
+}
+
+WORD
+CGaloisField::Add(WORD a, WORD b) const noexcept
+{
+    if (m_nChar == 2)
+        return a ^ b;
+
+    WORD nResult = 0;
+
+    for (WORD nPlace = 1; (a > 0) || (b > 0); nPlace *= m_nChar)
+    {
+        nResult += ((a % m_nChar + b % m_nChar) % m_nChar) * nPlace;
+
+        a /= m_nChar;
+        b /= m_nChar;
+    }
+
+    return nResult;
+}
@@ -0,0 +1,109 @@
+/**
+ *  @file       GaloisField.h
+ *  @brief      CGaloisField class interface
+ *
+ *  Provides type definitions for: CGaloisField
+ *
+ *  @author     Mark L. Short
+ *  @date       October 18, 2026
+ */
+#pragma once
+
+#if !defined(__GALOIS_FIELD_H__)
+#define __GALOIS_FIELD_H__
+
+#ifndef __COMMON_DEF_H__
+    #include "CommonDef.h"
+#endif
+
+#ifndef _VECTOR_
+    #include <vector>
+#endif
+
+/// largest field order supported
+constexpr const WORD MAX_FIELD_ORDER = 256;
+
+/**
+  @brief  Arithmetic over the finite field GF(q), q = p^n
+
+  Elements are numbered [0 .. q-1], element e standing for the polynomial
+  over GF(p) whose coefficients are the base p digits of e.  Multiplication
+  goes through exponent and logarithm tables of a primitive element, found
+  by searching for a primitive polynomial of degree n.
+*/
+class CGaloisField
+{
+    WORD               m_nOrder;       ///< number of elements q
+    WORD               m_nChar;        ///< characteristic p
+    WORD               m_nDegree;      ///< extension degree n
+    std::vector<WORD>  m_rgExp;        ///< powers of the primitive element, indexed by exponent
+    std::vector<WORD>  m_rgLog;        ///< exponent of each non-zero element
+
+public:
+    /// Default Constructor
+    CGaloisField() noexcept
+        : m_nOrder(0),
+          m_nChar(0),
+          m_nDegree(0),
+          m_rgExp(),
+          m_rgLog()
+    { };
+
+/**
+  @brief  Tests whether a number is a prime power, and splits it if so
+
+  @param [in]  nNumber       the number to be tested
+  @param [out] nPrime        the prime p
+  @param [out] nDegree       the exponent n, nNumber being p^n
+
+  @retval true               if nNumber is a prime power
+  @retval false              otherwise
+*/
+    static bool IsPrimePower(size_t nNumber, WORD& nPrime, WORD& nDegree) noexcept;
+
+/**
+  @brief  class initializer
+
+  @param [in] nOrder         the field order q, a prime power no greater than
+                             MAX_FIELD_ORDER
+
+  @retval true               on success
+  @retval false              if nOrder is not a supported prime power
+*/
+    bool   Init(WORD nOrder);
+
+/**
+  @brief  Adds two field elements
+
+  @param [in] a              first element
+  @param [in] b              second element
+
+  @retval WORD               containing a + b
+*/
+    WORD   Add(WORD a, WORD b) const noexcept;
+
+/**
+  @brief  Multiplies two field elements
+
+  @param [in] a              first element
+  @param [in] b              second element
+
+  @retval WORD               containing a * b
+*/
+    inline WORD Mul(WORD a, WORD b) const noexcept
+    {
+        return ((a == 0) || (b == 0)) ? 0
+                                      : m_rgExp[(m_rgLog[a] + m_rgLog[b]) % (m_nOrder - 1)];
+    };
+
+// Primitive data accessors
+/**
+  @brief  Returns the number of field elements
+
+  @retval WORD               containing the field order q
+*/
+    inline WORD get_Order(void) const noexcept
+    { return m_nOrder; };
+};
+
+#endif
@@ -0,0 +1,253 @@
+/**
+ *  @file       GenerationContext.cpp
+ *  @brief      CGenerationContext class implementation
+ *  @author     Mark L. Short
+ *  @date       October 18, 2026
+ */
+
+#include "stdafx.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include "AETGTestSuite.h"
+#include "DensityTestSuite.h"
+#include "IPOGTestSuite.h"
+#include "SuiteVerifier.h"
+
+#include "GenerationContext.h"
+
+/**
+  @brief  Retrieves the level range of each factor of a system
+
+  @param [in]  system        target CComponentSystem
+  @param [out] rgMinLevel    minimum level, indexed by factor
+  @param [out] rgNumLevels   number of levels, indexed by factor
+*/
+static void GetLevelRanges(const CComponentSystem& system, std::vector<LEVEL_T>& rgMinLevel,
+                           std::vector<LEVEL_T>& rgNumLevels)
+{
+    FACTOR_T nNumFactors = system.get_NumFactors( );
+
+    rgMinLevel.resize(nNumFactors);
+    rgNumLevels.resize(nNumFactors);
+
+    for (FACTOR_T nCurFactor = 0; nCurFactor < nNumFactors; nCurFactor++)
+    {
+        rgMinLevel[nCurFactor]  = system.GetMinLevel(nCurFactor);
+        rgNumLevels[nCurFactor] = system.GetMaxLevel(nCurFactor) - rgMinLevel[nCurFactor] + 1;
+    }
+}
+
+CGenerationContext::CGenerationContext()
+    : m_System(),
+      m_pTestSuite(CreateTestSuite(nullptr)),
+      m_lstTestSuite(),
+      m_lstSeedSuite(),
+      m_fnRowSink(),
+      m_bFixedSeed(false),
+      m_nSeed(0),
+      m_nRepetitions(0),
+      m_nNumUnresolved(0),
+      m_dSeconds(0.0),
+      m_strError()
+{ };
+
+std::unique_ptr<CTestSuite>
+CGenerationContext::CreateTestSuite(const char* szEngine)
+{
+    std::unique_ptr<CTestSuite> pResult;
+
+    if ((szEngine == nullptr) || (*szEngine == '\0') || (strcmp(szEngine, "aetg") == 0))
+        pResult.reset(new CAETGTestSuite);
+    else if (strcmp(szEngine, "dda") == 0)
+        pResult.reset(new CDensityTestSuite);
+    else if (strcmp(szEngine, "ipog") == 0)
+        pResult.reset(new CIPOGTestSuite);
+
+    return pResult;
+}
+
+bool
+CGenerationContext::SetModel(const std::vector<LEVEL_T>& rgNumLevels, WORD nT)
+{
+    m_lstTestSuite.clear();
+    m_lstSeedSuite.clear();
+    m_strError.clear();
+
+    if (rgNumLevels.empty() || !m_System.Init(rgNumLevels))
+        return SetError("invalid levels");
+
+    if (m_System.SetStrength(nT) == false)
+        return SetError("t must be in [1..k]");
+
+    return true;
+}
+
+bool
+CGenerationContext::AddRelation(const std::vector<FACTOR_T>& rgFactors, WORD nT)
+{
+    m_strError.clear();
+
+    return m_System.AddRelation(rgFactors, nT) || SetError("invalid relation");
+}
+
+bool
+CGenerationContext::AddForbiddenTuple(const std::vector<LEVEL_T>& rgLevels)
+{
+    m_strError.clear();
+
+    return m_System.AddForbiddenTuple(rgLevels) || SetError("invalid forbidden tuple");
+}
+
+bool
+CGenerationContext::SetEngine(const char* szEngine)
+{
+    std::unique_ptr<CTestSuite> pTestSuite = CreateTestSuite(szEngine);
+
+    m_strError.clear();
+
+    if (pTestSuite == nullptr)
+        return SetError("unknown engine");
+
+    m_pTestSuite = std::move(pTestSuite);
+    return true;
+}
+
+void
+CGenerationContext::SetSeed(DWORD nSeed) noexcept
+{
+    m_bFixedSeed = true;
+    m_nSeed      = nSeed;
+}
+
+size_t
+CGenerationContext::SetSeedSuite(const std::list<CTestCase>& lstSeedSuite)
+{
+    m_lstSeedSuite = lstSeedSuite;
+
+    return m_lstSeedSuite.size();
+}
+
+void
+CGenerationContext::SetRowSink(const ROW_SINK& fnRowSink)
+{
+    m_fnRowSink = fnRowSink;
+}
+
+bool
+CGenerationContext::Generate(DWORD nRepetitions, double dBudget)
+{
+    typedef std::chrono::steady_clock CLOCK;
+
+    CLOCK::time_point tpStart    = CLOCK::now();
+    CLOCK::time_point tpDeadline = CLOCK::time_point::max();
+
+    m_lstTestSuite.clear();
+    m_nRepetitions   = 0;
+    m_nNumUnresolved = 0;
+    m_dSeconds       = 0.0;
+    m_strError.clear();
+
+    if (m_System.get_NumFactors() == 0)
+        return SetError("no model");
+
+    if (dBudget > 0.0)
+        tpDeadline = tpStart + std::chrono::duration_cast<CLOCK::duration>(std::chrono::duration<double>(dBudget));
+
+    if (m_bFixedSeed)
+        m_System.SetSeed(m_nSeed);
+
+    m_pTestSuite->Init(m_System);
+    m_pTestSuite->set_Deadline(tpDeadline);
+    m_pTestSuite->SetRowSink(m_fnRowSink);
+
+    if (!m_lstSeedSuite.empty())
+    {
+        std::vector<LEVEL_T> rgMinLevel;
+        std::vector<LEVEL_T> rgNumLevels;
+
+        GetLevelRanges(m_System, rgMinLevel, rgNumLevels);
+        m_pTestSuite->SetSeedSuite(m_System, rgMinLevel, rgNumLevels, m_lstSeedSuite);
+    }
+
+    if (m_fnRowSink || m_pTestSuite->IsDeterministic() || m_pTestSuite->CanConstructTestSuite(m_System))
+        nRepetitions = 1;
+
+    nRepetitions = std::max<DWORD>(nRepetitions, 1);
+
+    for (; (m_nRepetitions < nRepetitions) && (CLOCK::now() < tpDeadline); m_nRepetitions++)
+    {
+        m_pTestSuite->GenerateTestSuite(m_System);
+
+        // a suite abandoned at the deadline is incomplete
+        if (m_pTestSuite->get_NumUncoveredT3Tuples() > 0)
+            break;
+
+        if (!m_fnRowSink)
+            m_pTestSuite->ReduceTestSuite(m_System);
+
+        if (m_lstTestSuite.empty() || (m_pTestSuite->get_TestSuiteSize() < m_lstTestSuite.size()))
+        {
+            m_nNumUnresolved = m_pTestSuite->get_NumUnresolvedTuples( );
+            m_lstTestSuite.clear();
+            m_pTestSuite->SpliceTestSuite(m_lstTestSuite);
+        }
+    }
+
+    m_pTestSuite->SetRowSink(ROW_SINK());
+
+    CLOCK::time_point tpEnd = CLOCK::now();
+
+    m_dSeconds = std::chrono::duration<double>(tpEnd - tpStart).count();
+
+    if (m_lstTestSuite.empty())
+        return SetError((tpEnd >= tpDeadline) ? "time budget exceeded" : "generation abandoned");
+
+    return true;
+}
+
+bool
+CGenerationContext::Verify(const std::list<CTestCase>& lstTestSuite, WORD nT, CSuiteVerifier& verifier,
+                           size_t& nNumMissing)
+{
+    std::vector<LEVEL_T>       rgMinLevel;
+    std::vector<LEVEL_T>       rgNumLevels;
+    std::vector<MISSING_TUPLE> rgMissing;
+
+    nNumMissing = 0;
+    m_strError.clear();
+
+    if (m_System.get_NumFactors() == 0)
+        return SetError("no model");
+
+    if (nT == 0)
+        nT = m_System.get_Strength( );
+
+    if ((nT > m_System.get_NumFactors()) || (nT > MAX_T_WAY))
+        return SetError("t must be in [1..k]");
+
+    GetLevelRanges(m_System, rgMinLevel, rgNumLevels);
+
+    if (verifier.Load(rgMinLevel, rgNumLevels, lstTestSuite) == false)
+        return SetError("suite does not match the levels");
+
+    const CConstraintSet&             constraints = m_System.get_Constraints( );
+    std::vector<std::vector<LEVEL_T>> rgForbidden;
+
+    for (size_t i = 0; i < constraints.get_NumTuples(); i++)
+        rgForbidden.emplace_back(constraints.GetLevels(i), constraints.GetLevels(i) + constraints.GetArity(i));
+
+    if (verifier.SetForbiddenTuples(rgForbidden) == false)
+        return SetError("invalid forbidden tuple");
+
+    nNumMissing = verifier.Verify(nT, 0, rgMissing);
+    return true;
+}
+
+bool
+CGenerationContext::SetError(const char* szError)
+{
+    m_strError = szError;
+    return false;
+}
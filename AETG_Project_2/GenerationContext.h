@@ -0,0 +1,265 @@
+/**
+ *  @file       GenerationContext.h
+ *  @brief      CGenerationContext class interface
+ *
+ *  Provides type definitions for: CGenerationContext
+ *
+ *  @author     Mark L. Short
+ *  @date       October 18, 2026
+ */
+#pragma once
+
+#if !defined(__GENERATION_CONTEXT_H__)
+#define __GENERATION_CONTEXT_H__
+
+#ifndef __COMMON_DEF_H__
+    #include "CommonDef.h"
+#endif
+
+#ifndef _LIST_
+    #include <list>
+#endif
+
+#ifndef _MEMORY_
+    #include <memory>
+#endif
+
+#ifndef _STRING_
+    #include <string>
+#endif
+
+#ifndef _VECTOR_
+    #include <vector>
+#endif
+
+#ifndef __COMPONENT_SYSTEM_H__
+    #include "ComponentSystem.h"
+#endif
+
+#ifndef __TEST_SUITE_H__
+    #include "TestSuite.h"
+#endif
+
+// forward declaration
+class CSuiteVerifier;
+
+/**
+  @brief  Everything a single generation works with
+
+  A context owns its model, the random engine of the model, the generation
+  engine along with all of its scratch state, the rows to be extended, the
+  last suite generated and the figures describing how it was arrived at.
+  Nothing is shared between contexts, so generations on separate contexts
+  may run concurrently; a single context is used by one thread at a time.
+
+  The model is set up in the same steps as a CComponentSystem: SetModel,
+  then any AddRelation and AddForbiddenTuple calls.  SetModel clears the
+  sub-relations, forbidden tuples and seed rows of the previous model.
+*/
+class CGenerationContext
+{
+    CComponentSystem             m_System;           ///< the model
+    std::unique_ptr<CTestSuite>  m_pTestSuite;       ///< generation engine and its scratch state
+    std::list<CTestCase>         m_lstTestSuite;     ///< the last suite generated
+    std::list<CTestCase>         m_lstSeedSuite;     ///< rows to extend, as global levels
+    ROW_SINK                     m_fnRowSink;        ///< optional sink for rows as they are generated
+    bool                         m_bFixedSeed;       ///< true if SetSeed fixed the engine seed
+    DWORD                        m_nSeed;            ///< the fixed seed
+    DWORD                        m_nRepetitions;     ///< repetitions run by the last Generate
+    size_t                       m_nNumUnresolved;   ///< tuples the last suite may be missing
+    double                       m_dSeconds;         ///< duration of the last Generate, in seconds
+    std::string                  m_strError;         ///< reason the last call failed
+
+public:
+    /// Default Constructor
+    CGenerationContext();
+
+    /// Destructor
+    ~CGenerationContext() = default;
+
+/**
+  @brief  Creates the generation engine of a name, as given to <b>-engine</b>
+
+  @param [in] szEngine       aetg, dda or ipog; nullptr or empty for aetg
+
+  @retval std::unique_ptr    containing the new engine
+  @retval nullptr            if the name is unknown
+*/
+    static std::unique_ptr<CTestSuite> CreateTestSuite(const char* szEngine);
+
+/**
+  @brief  Sets the factors, levels and base strength of the model
+
+  @param [in] rgNumLevels    number of levels, indexed by factor
+  @param [in] nT             base interaction strength
+
+  @retval true               on success
+  @retval false              on invalid levels, or if t is not in [1..k]
+*/
+    bool   SetModel(const std::vector<LEVEL_T>& rgNumLevels, WORD nT);
+
+/**
+  @brief  Adds a sub-relation of a higher strength to the model
+
+  @param [in] rgFactors      factors of the relation
+  @param [in] nT             strength of the relation
+
+  @retval true               on success
+  @retval false              on an invalid relation
+*/
+    bool   AddRelation(const std::vector<FACTOR_T>& rgFactors, WORD nT);
+
+/**
+  @brief  Forbids a combination of levels from appearing in any test case
+
+  @param [in] rgLevels       the global levels of the forbidden tuple
+
+  @retval true               on success
+  @retval false              on an invalid tuple
+*/
+    bool   AddForbiddenTuple(const std::vector<LEVEL_T>& rgLevels);
+
+/**
+  @brief  Selects the generation engine
+
+  @param [in] szEngine       aetg, dda or ipog
+
+  @retval true               on success
+  @retval false              if the name is unknown
+*/
+    bool   SetEngine(const char* szEngine);
+
+/**
+  @brief  Fixes the seed of the model's random engine
+
+  Every subsequent Generate starts from the seed, so that the same model
+  gives the same suite.  Without a fixed seed the engine is seeded from
+  std::random_device.
+
+  @param [in] nSeed          the seed
+*/
+    void   SetSeed(DWORD nSeed) noexcept;
+
+/**
+  @brief  Sets the rows which subsequent Generate calls extend
+
+  The rows are kept as given, and generation adds only those needed to
+  complete the coverage.  An empty list returns to generating from scratch.
+
+  @param [in] lstSeedSuite   the rows, as global levels of the model
+
+  @retval size_t             containing the number of rows
+*/
+    size_t SetSeedSuite(const std::list<CTestCase>& lstSeedSuite);
+
+/**
+  @brief  Hands each row to a sink as soon as it is generated
+
+  Streaming generates a single suite, whatever the repetitions asked for,
+  and leaves it unreduced, so that the suite kept is the rows streamed.
+
+  @param [in] fnRowSink      the sink, or an empty ROW_SINK to stop streaming
+*/
+    void   SetRowSink(const ROW_SINK& fnRowSink);
+
+/**
+  @brief  Generates a suite for the model
+
+  The best of nRepetitions suites is kept, or a single suite for a
+  deterministic engine, a model with a direct construction or a streamed
+  generation.
+
+  @param [in] nRepetitions   number of suites to generate, at least 1
+  @param [in] dBudget        time budget in seconds, or 0 for none
+
+  @retval true               on success
+  @retval false              if no complete suite was generated in the budget,
+                             or the row sink abandoned generation
+*/
+    bool   Generate(DWORD nRepetitions, double dBudget);
+
+/**
+  @brief  Verifies the coverage of a suite against the model
+
+  @param [in]  lstTestSuite  the test cases, as global levels of the model
+  @param [in]  nT            strength to verify, or 0 for the model's
+  @param [out] verifier      holds the verification results
+  @param [out] nNumMissing   number of uncovered t-tuples, those containing
+                             a forbidden tuple aside
+
+  @retval true               on success
+  @retval false              if a test case does not match the model
+*/
+    bool   Verify(const std::list<CTestCase>& lstTestSuite, WORD nT, CSuiteVerifier& verifier,
+                  size_t& nNumMissing);
+
+/**
+  @brief  Returns the model
+
+  @retval CComponentSystem&  containing the model
+*/
+    inline const CComponentSystem& get_System(void) const noexcept
+    { return m_System; };
+
+/**
+  @brief  Returns the last suite generated
+
+  @retval std::list<CTestCase>&  containing the test cases
+*/
+    inline const std::list<CTestCase>& get_TestSuite(void) const noexcept
+    { return m_lstTestSuite; };
+
+/**
+  @brief  Returns the generation engine
+
+  @retval CTestSuite&        containing the engine
+*/
+    inline const CTestSuite& get_Engine(void) const noexcept
+    { return *m_pTestSuite; };
+
+/**
+  @brief  Returns the number of repetitions run by the last Generate
+
+  @retval DWORD              containing the repetitions
+*/
+    inline DWORD get_Repetitions(void) const noexcept
+    { return m_nRepetitions; };
+
+/**
+  @brief  Returns the number of tuples the last suite generated may be 
+          missing
+
+  Under constraints a tuple may be neither covered nor shown to be 
+  forbidden, leaving the suite short of full coverage.
+
+  @retval size_t             containing the number of unresolved tuples
+*/
+    inline size_t get_NumUnresolved(void) const noexcept
+    { return m_nNumUnresolved; };
+
+/**
+  @brief  Returns the duration of the last Generate
+
+  @retval double             containing the duration, in seconds
+*/
+    inline double get_Seconds(void) const noexcept
+    { return m_dSeconds; };
+
+/**
+  @brief  Returns the reason the last call failed
+
+  @retval std::string&       containing the reason, empty after a success
+*/
+    inline const std::string& get_LastError(void) const noexcept
+    { return m_strError; };
+
+private:
+/**
+  @brief  Records the reason a call failed
+
+  @retval false              always
+*/
+    bool   SetError(const char* szError);
+};
+
+#endif
@@ -0,0 +1,385 @@
+/**
+ *  @file       GenerationService.cpp
+ *  @brief      CGenerationService class implementation
+ *  @author     Mark L. Short
+ *  @date       October 18, 2026
+ */
+
+#include "stdafx.h"
+
+#include <chrono>
+#include <cstdlib>
+#include <list>
+#include <sstream>
+#include "GenerationContext.h"
+#include "ParallelUtility.h"
+#include "SuiteVerifier.h"
+
+#include "GenerationService.h"
+
+/**
+  @brief  Parses a list of numbers separated by commas or spaces
+
+  @param [in]  strList       the list
+  @param [out] rgNumbers     the numbers
+
+  @retval true               if every entry is a non-negative number
+  @retval false              otherwise
+*/
+static bool ParseNumbers(const std::string& strList, std::vector<long>& rgNumbers)
+{
+    rgNumbers.clear();
+
+    for (const char* p = strList.c_str(); *p; )
+    {
+        if ((*p == ',') || (*p == ' ') || (*p == '\t') || (*p == '\r'))
+        {
+            p++;
+            continue;
+        }
+
+        char* pEnd   = nullptr;
+        long  nValue = strtol(p, &pEnd, 10);
+
+        if ((pEnd == p) || (nValue < 0))
+            return false;
+
+        rgNumbers.push_back(nValue);
+        p = pEnd;
+    }
+
+    return true;
+}
+
+/**
+  @brief  Builds an error response
+*/
+static std::string MakeError(const char* szMessage)
+{
+    return std::string("status=error\nmessage=") + szMessage + "\n";
+}
+
+/**
+  @brief  Builds the model a request describes
+*/
+static bool InitContext(const SERVICE_REQUEST& Request, CGenerationContext& context)
+{
+    if (context.SetModel(Request.rgNumLevels, Request.nT) == false)
+        return false;
+
+    for (const auto& it : Request.rgRelations)
+    {
+        if (context.AddRelation(it.rgFactors, it.nT) == false)
+            return false;
+    }
+
+    for (const auto& it : Request.rgForbidden)
+    {
+        if (context.AddForbiddenTuple(it) == false)
+            return false;
+    }
+
+    return true;
+}
+
+bool
+CGenerationService::Init(const TCHAR* szCacheDir, QWORD cbCacheSize, double dMaxBudget)
+{
+    m_dMaxBudget  = (dMaxBudget > 0.0) ? dMaxBudget : DEFAULT_SERVICE_BUDGET;
+    m_nMaxRunning = GetNumWorkerThreads( );
+
+    return (szCacheDir == nullptr) || m_Cache.Open(szCacheDir, cbCacheSize);
+}
+
+bool
+CGenerationService::ParseRequest(const std::string& strRequest, SERVICE_REQUEST& Request)
+{
+    std::istringstream ss(strRequest);
+    std::string        strLine;
+    std::vector<long>  rgNumbers;
+    long               nFactors = 0;
+
+    Request = SERVICE_REQUEST();
+    Request.nT           = DEFAULT_T_WAY;
+    Request.dBudget      = 0.0;
+    Request.nRepetitions = 1;
+
+    while (std::getline(ss, strLine))
+    {
+        if (!strLine.empty() && (strLine.back() == '\r'))
+            strLine.pop_back();
+
+        // a blank line separates the header from the body
+        if (strLine.empty())
+            break;
+
+        size_t nPos = strLine.find('=');
+        if (nPos == std::string::npos)
+            return false;
+
+        std::string strName  = strLine.substr(0, nPos);
+        std::string strValue = strLine.substr(nPos + 1);
+
+        if (strName == "op")
+        {
+            Request.strOp = strValue;
+        }
+        else if (strName == "engine")
+        {
+            Request.strEngine = strValue;
+        }
+        else if (strName == "budget")
+        {
+            Request.dBudget = strtod(strValue.c_str(), nullptr);
+        }
+        else if ((strName == "relation") && (strValue.find(':') != std::string::npos))
+        {
+            STRENGTH_RELATION relation;
+
+            relation.nT = static_cast<WORD>(strtol(strValue.c_str(), nullptr, 10));
+
+            if (!ParseNumbers(strValue.substr(strValue.find(':') + 1), rgNumbers))
+                return false;
+
+            for (long n : rgNumbers)
+                relation.rgFactors.push_back(static_cast<FACTOR_T>(n));
+
+            Request.rgRelations.push_back(relation);
+        }
+        else if (ParseNumbers(strValue, rgNumbers) && !rgNumbers.empty())
+        {
+            if (strName == "levels")
+            {
+                for (long n : rgNumbers)
+                {
+                    if ((n <= 0) || (n >= LEVEL_INVALID))
+                        return false;
+                    Request.rgNumLevels.push_back(static_cast<LEVEL_T>(n));
+                }
+            }
+            else if (strName == "factors")
+                nFactors = rgNumbers[0];
+            else if (strName == "t")
+                Request.nT = static_cast<WORD>(rgNumbers[0]);
+            else if (strName == "repetitions")
+                Request.nRepetitions = static_cast<DWORD>(rgNumbers[0]);
+            else if (strName == "forbid")
+                Request.rgForbidden.emplace_back(rgNumbers.begin(), rgNumbers.end());
+            else
+                return false;
+        }
+        else
+        {
+            return false;
+        }
+    }
+
+    // the remainder is the body
+    Request.strBody.assign(std::istreambuf_iterator<char>(ss), std::istreambuf_iterator<char>());
+
+    if ((nFactors > 0) && (nFactors < FACTOR_INVALID) && (Request.rgNumLevels.size() == 1))
+        Request.rgNumLevels.assign(nFactors, Request.rgNumLevels[0]);
+
+    return !Request.strOp.empty();
+}
+
+bool
+CGenerationService::HandleRequest(const std::string& strRequest, std::string& strResponse)
+{
+    SERVICE_REQUEST Request;
+
+    if (ParseRequest(strRequest, Request) == false)
+    {
+        strResponse = MakeError("malformed request");
+        return true;
+    }
+
+    if ((Request.strOp == "ping") || (Request.strOp == "shutdown"))
+    {
+        strResponse = "status=ok\n";
+        return Request.strOp == "ping";
+    }
+
+    if ((Request.strOp != "generate") && (Request.strOp != "verify"))
+    {
+        strResponse = MakeError("unknown op");
+        return true;
+    }
+
+    // an identical request already in flight is waited on rather than repeated
+    std::promise<std::string>        promise;
+    std::shared_future<std::string>  future;
+    bool                             bOwner = false;
+
+    {
+        std::lock_guard<std::mutex> lock(m_mtxInFlight);
+
+        auto itFound = m_mapInFlight.find(strRequest);
+
+        if (itFound != m_mapInFlight.end())
+        {
+            future = itFound->second;
+        }
+        else
+        {
+            future = promise.get_future().share();
+            m_mapInFlight.emplace(strRequest, future);
+            bOwner = true;
+        }
+    }
+
+    if (bOwner)
+    {
+        promise.set_value((Request.strOp == "generate") ? Generate(Request) : Verify(Request));
+
+        std::lock_guard<std::mutex> lock(m_mtxInFlight);
+        m_mapInFlight.erase(strRequest);
+    }
+
+    strResponse = future.get();
+    return true;
+}
+
+void
+CGenerationService::EnterRunning(void)
+{
+    std::unique_lock<std::mutex> lock(m_mtxRunning);
+
+    m_cvRunning.wait(lock, [this] { return m_nNumRunning < m_nMaxRunning; });
+    m_nNumRunning++;
+}
+
+void
+CGenerationService::LeaveRunning(void)
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mtxRunning);
+        m_nNumRunning--;
+    }
+    m_cvRunning.notify_one( );
+}
+
+std::string
+CGenerationService::Generate(const SERVICE_REQUEST& Request)
+{
+    typedef std::chrono::steady_clock CLOCK;
+
+    CGenerationContext   context;
+    std::list<CTestCase> lstBestTestSuite;
+    CLOCK::time_point    tpStart  = CLOCK::now();
+    double               dBudget  = ((Request.dBudget > 0.0) && (Request.dBudget < m_dMaxBudget)) ?
+                                    Request.dBudget : m_dMaxBudget;
+
+    if ((InitContext(Request, context) == false) || (context.SetEngine(Request.strEngine.c_str()) == false))
+        return MakeError(context.get_LastError().c_str());
+
+    const CComponentSystem& system = context.get_System( );
+
+    std::string strKey      = CSuiteCache::MakeKey(system, Request.rgForbidden, false);
+    const char* szSource    = "cache";
+    DWORD       nNumDone    = 0;
+    size_t      nUnresolved = 0;
+
+    if (m_Cache.Lookup(strKey, system, lstBestTestSuite) == false)
+    {
+        szSource = "generated";
+
+        // each request generates on its own context, so requests run side by 
+        // side, up to the number of slots
+        EnterRunning( );
+
+        bool bGenerated = context.Generate(std::min(std::max<DWORD>(Request.nRepetitions, 1), MAX_SERVICE_REPETITIONS),
+                                           dBudget);
+        LeaveRunning( );
+
+        if (bGenerated == false)
+            return MakeError(context.get_LastError().c_str());
+
+        nNumDone         = context.get_Repetitions( );
+        nUnresolved      = context.get_NumUnresolved( );
+        lstBestTestSuite = context.get_TestSuite( );
+
+        // a suite which may fall short of full coverage is not worth reusing
+        if (nUnresolved == 0)
+            m_Cache.Store(strKey, system, lstBestTestSuite, context.get_Engine().GetEngineName(), nNumDone);
+    }
+
+    std::ostringstream ss;
+
+    ss << "status=ok\nrows=" << lstBestTestSuite.size() << "\nsource=" << szSource
+       << "\nrepetitions=" << nNumDone << "\nunresolved=" << nUnresolved << "\nseconds="
+       << std::chrono::duration<double>(CLOCK::now() - tpStart).count() << "\n\n";
+
+    ss << lstBestTestSuite.size() << "\n\n";
+
+    for (const auto& it : lstBestTestSuite)
+    {
+        for (size_t nFactor = 0; nFactor < it.get_Size(); nFactor++)
+        {
+            if (IsValidLevel(it[nFactor]))
+                ss << it[nFactor] << ' ';
+            else
+                ss << "* ";
+        }
+        ss << '\n';
+    }
+
+    return ss.str();
+}
+
+std::string
+CGenerationService::Verify(const SERVICE_REQUEST& Request)
+{
+    CGenerationContext      context;
+    CSuiteVerifier          verifier;
+    std::list<CTestCase>    lstTestSuite;
+    size_t                  nMissing = 0;
+
+    if (InitContext(Request, context) == false)
+        return MakeError(context.get_LastError().c_str());
+
+    FACTOR_T nNumFactors = context.get_System().get_NumFactors( );
+
+    std::istringstream ssBody(Request.strBody);
+    std::string        strLine;
+
+    while (std::getline(ssBody, strLine))
+    {
+        std::istringstream   ssLine(strLine);
+        std::string          strCell;
+        std::vector<LEVEL_T> rgCells;
+
+        while (ssLine >> strCell)
+        {
+            rgCells.push_back((strCell == "*") ? LEVEL_INVALID
+                                               : static_cast<LEVEL_T>(strtol(strCell.c_str(), nullptr, 10)));
+        }
+
+        // blank lines and the row count header of the text format are skipped
+        if (rgCells.empty() || ((rgCells.size() == 1) && (nNumFactors > 1)))
+            continue;
+
+        lstTestSuite.emplace_back();
+        lstTestSuite.back().Init(rgCells.size());
+
+        for (size_t n = 0; n < rgCells.size(); n++)
+            lstTestSuite.back()[n] = rgCells[n];
+    }
+
+    EnterRunning( );
+
+    bool bVerified = context.Verify(lstTestSuite, 0, verifier, nMissing);
+    LeaveRunning( );
+
+    if (bVerified == false)
+        return MakeError(context.get_LastError().c_str());
+
+    std::ostringstream ss;
+
+    ss << "status=ok\nrows=" << verifier.get_NumRows() << "\ntuples=" << verifier.get_NumTuples()
+       << "\nforbidden=" << verifier.get_NumExcluded()
+       << "\nmissing=" << nMissing << "\ncoverage=" << std::fixed << std::setprecision(4)
+       << verifier.get_CoveragePercent() << "\n";
+
+    return ss.str();
+}
@@ -0,0 +1,191 @@
+/**
+ *  @file       GenerationService.h
+ *  @brief      CGenerationService class interface
+ *
+ *  Provides type definitions for: SERVICE_REQUEST, CGenerationService
+ *
+ *  @author     Mark L. Short
+ *  @date       October 18, 2026
+ */
+#pragma once
+
+#if !defined(__GENERATION_SERVICE_H__)
+#define __GENERATION_SERVICE_H__
+
+#ifndef __COMMON_DEF_H__
+    #include "CommonDef.h"
+#endif
+
+#ifndef _CONDITION_VARIABLE_
+    #include <condition_variable>
+#endif
+
+#ifndef _FUTURE_
+    #include <future>
+#endif
+
+#ifndef _MAP_
+    #include <map>
+#endif
+
+#ifndef _MUTEX_
+    #include <mutex>
+#endif
+
+#ifndef _STRING_
+    #include <string>
+#endif
+
+#ifndef _VECTOR_
+    #include <vector>
+#endif
+
+#ifndef __COMPONENT_SYSTEM_H__
+    #include "ComponentSystem.h"
+#endif
+
+#ifndef __SUITE_CACHE_H__
+    #include "SuiteCache.h"
+#endif
+
+/// default, and largest, time budget of a request, in seconds
+constexpr const double DEFAULT_SERVICE_BUDGET      = 60.0;
+
+/// largest number of generation repetitions a request may ask for
+constexpr const DWORD  MAX_SERVICE_REPETITIONS     = 100;
+
+/**
+  @brief  A parsed generation service request
+*/
+struct SERVICE_REQUEST
+{
+    std::string                       strOp;          ///< generate, verify, ping or shutdown
+    std::vector<LEVEL_T>              rgNumLevels;    ///< number of levels, indexed by factor
+    WORD                              nT;             ///< base interaction strength
+    std::string                       strEngine;      ///< aetg, dda or ipog
+    std::vector<STRENGTH_RELATION>    rgRelations;    ///< higher strength sub-relations
+    std::vector<std::vector<LEVEL_T>> rgForbidden;    ///< forbidden tuples, as global level ids
+    double                            dBudget;        ///< time budget in seconds, 0 for the default
+    DWORD                             nRepetitions;   ///< generation repetitions, the best kept
+    std::string                       strBody;        ///< suite to be verified, in text format
+};
+
+/**
+  @brief  Serves generation and verification requests for a long running
+          process
+
+  A request is a block of key=value lines, then optionally a blank line and
+  a body:
+
+  @code
+      op=generate              generate, verify, ping or shutdown
+      levels=3,3,3,3           levels per factor, or
+      factors=4                  with levels=3, for a uniform system
+      t=3                      base strength (default 3)
+      engine=aetg              aetg (default), dda or ipog
+      relation=4:0,1,2,3       a sub-relation, repeatable
+      forbid=0 3               a forbidden tuple of level ids, repeatable
+      budget=30                time budget in seconds
+      repetitions=10           generate up to n suites, keeping the best
+  @endcode
+
+  A verify request carries the suite in the text format as its body.  The
+  response starts with status=ok or status=error and message=..., then for a
+  generated suite rows=, source= (cache or generated), repetitions=,
+  unresolved= (tuples neither covered nor shown to be forbidden, a suite 
+  with any being left out of the cache) and seconds=, a blank line and the
+  suite in the text format, and for a verification tuples=, forbidden= (tuples left out for containing a 
+  forbidden tuple), missing= and coverage=.
+
+  Every request shares the service's suite cache, and identical requests in
+  flight at the same time share a single response.  A request exceeding its
+  time budget is abandoned, though the best suite of any repetitions already
+  complete is returned.  Each request generates on a CGenerationContext of
+  its own, so requests are served side by side, though as each generation
+  already spreads its work across every hardware thread, no more than that
+  many generations or verifications run at once and any others wait their
+  turn.
+*/
+class CGenerationService
+{
+    CSuiteCache  m_Cache;          ///< suites shared by every request
+    double       m_dMaxBudget;     ///< default and largest time budget, in seconds
+    std::mutex   m_mtxInFlight;    ///< guards m_mapInFlight
+    std::map<std::string, std::shared_future<std::string>> m_mapInFlight;  ///< responses pending, keyed by request
+    unsigned int             m_nMaxRunning;    ///< most generations or verifications at once
+    unsigned int             m_nNumRunning;    ///< generations or verifications under way
+    std::mutex               m_mtxRunning;     ///< guards m_nNumRunning
+    std::condition_variable  m_cvRunning;      ///< signalled as a generation or verification ends
+
+public:
+    /// Default Constructor
+    CGenerationService()
+        : m_Cache(),
+          m_dMaxBudget(DEFAULT_SERVICE_BUDGET),
+          m_mtxInFlight(),
+          m_mapInFlight(),
+          m_nMaxRunning(1),
+          m_nNumRunning(0),
+          m_mtxRunning(),
+          m_cvRunning()
+    { };
+
+/**
+  @brief  class initializer
+
+  @param [in] szCacheDir     suite cache directory, or nullptr for none
+  @param [in] cbCacheSize    size cap of the suite cache, in bytes
+  @param [in] dMaxBudget     default and largest time budget, in seconds
+
+  @retval true               on success
+  @retval false              if the cache directory could not be opened
+*/
+    bool   Init(const TCHAR* szCacheDir, QWORD cbCacheSize, double dMaxBudget);
+
+/**
+  @brief  Handles a single request, as a SERVICE_HANDLER
+
+  May be called concurrently.
+
+  @param [in]  strRequest    the request
+  @param [out] strResponse   the response
+
+  @retval true               to continue serving
+  @retval false              after a shutdown request
+*/
+    bool   HandleRequest(const std::string& strRequest, std::string& strResponse);
+
+/**
+  @brief  Parses a request
+
+  @param [in]  strRequest    the request
+  @param [out] Request       the parsed request
+
+  @retval true               on success
+  @retval false              if the request is malformed
+*/
+    static bool ParseRequest(const std::string& strRequest, SERVICE_REQUEST& Request);
+
+private:
+/**
+  @brief  Waits for, and takes, one of the m_nMaxRunning slots
+*/
+    void   EnterRunning(void);
+
+/**
+  @brief  Gives back a slot taken by EnterRunning
+*/
+    void   LeaveRunning(void);
+
+/**
+  @brief  Generates, or retrieves from the cache, a suite
+*/
+    std::string Generate(const SERVICE_REQUEST& Request);
+
+/**
+  @brief  Verifies the coverage of the suite in a request's body
+*/
+    std::string Verify  (const SERVICE_REQUEST& Request);
+};
+
+#endif
@@ -0,0 +1,251 @@
+/**
+ *  @file       IPOGTestSuite.cpp
+ *  @brief      CIPOGTestSuite class implementation
+ *  @author     Mark L. Short
+ *  @date       October 18, 2026
+ */
+
+#include "stdafx.h"
+
+#include "ComponentSystem.h"
+#include "MathUtility.h"
+
+#include "IPOGTestSuite.h"
+
+size_t
+CIPOGTestSuite::GenerateTestSuite(const CComponentSystem& system)
+{
+    ClearTestSuite( );
+    GenerateUncoveredT3Tuples(system);
+
+    if (AddConstructedTestCases(system) > 0)
+    {
+        CoverRemainingTuples(system);
+        return get_TestSuiteSize( );
+    }
+
+    if (m_nNumFactors >= m_nT)
+    {
+        FACTOR_T nFirstFactor = m_nT;
+
+        if (m_rgSeedRows.empty( ))
+        {
+            InitialArray(system);
+        }
+        else
+        {
+            // the seed takes the place of the initial array, so vertical 
+            // growth starts with the tuples of the first t factors
+            m_rgRows = m_rgSeedRows;
+
+            for (auto& it : m_rgRows)
+                m_bmpUncoveredT3Tuples.Cover(it, m_rgLevelCount);
+
+            nFirstFactor = m_nT - 1;
+        }
+
+        for (FACTOR_T nFactor = nFirstFactor; (nFactor < m_nNumFactors) && !IsAbandoned(); nFactor++)
+        {
+            ExtendHorizontal(system, nFactor, m_rgRows);
+            ExtendVertical  (system, nFactor);
+        }
+
+        // any don't-care levels left over are resolved to the factor's minimum
+        // level, and the coverage bookkeeping is rebuilt from the completed 
+        // test cases as they are added to the suite
+        GenerateUncoveredT3Tuples(system);
+
+        // the seed test cases lead the rows, so those kept lead the suite
+        for (size_t nRow = 0; nRow < m_rgRows.size(); nRow++)
+        {
+            CTestCase& it = m_rgRows[nRow];
+
+            if (system.HasConstraints())
+            {
+                // under constraints the levels are searched for instead, a 
+                // test case which can't be completed being dropped
+                if (CompleteTestCase(system, it) != COMPLETION_RESULT::FOUND)
+                    continue;
+            }
+            else
+            {
+                for (FACTOR_T nCurFactor = 0; nCurFactor < m_nNumFactors; nCurFactor++)
+                {
+                    if (IsValidLevel(it[nCurFactor]) == false)
+                        it[nCurFactor] = system.GetMinLevel(nCurFactor);
+                }
+            }
+
+            if ((AddToT3TestSuite(it) > 0) && (nRow < m_rgSeedRows.size()))
+                m_nNumSeedRowsAdded++;
+        }
+
+        // whatever the dropped test cases held is picked up again here, as 
+        // are the tuples of any higher strength sub-relation
+        if (system.HasConstraints() || (m_rgRelations.empty() == false))
+            CoverRemainingTuples(system);
+
+        m_rgRows.clear( );
+        m_rgDontCareRows.clear( );
+    }
+
+    return get_TestSuiteSize( );
+}
+
+size_t
+CIPOGTestSuite::GenerateTestCase(const CComponentSystem& system, CTestCase& TestCase)
+{
+    size_t   nResult = 0;
+
+    FACTOR_T rgColumns[MAX_T_WAY];
+    LEVEL_T  rgLevels [MAX_T_WAY];
+
+    TestCase.Init(m_nNumFactors);
+
+    if (m_bmpUncoveredT3Tuples.FindFirstUncovered(rgColumns, rgLevels))
+    {
+        for (FACTOR_T nCurFactor = 0; nCurFactor < m_nNumFactors; nCurFactor++)
+            TestCase[nCurFactor] = system.GetMinLevel(nCurFactor);
+
+        for (WORD i = 0; i < m_nT; i++)
+            TestCase[rgColumns[i]] = rgLevels[i];
+
+        nResult = CalculateT3TestCaseCoverage(TestCase);
+    }
+
+    return nResult;
+}
+
+size_t
+CIPOGTestSuite::InitialArray(const CComponentSystem& system)
+{
+    FACTOR_T rgColumns[MAX_T_WAY];
+    LEVEL_T  rgLevels [MAX_T_WAY];
+
+    m_rgRows.clear( );
+    m_rgDontCareRows.clear( );
+
+    for (WORD i = 0; i < m_nT; i++)
+    {
+        rgColumns[i] = i;
+        rgLevels [i] = system.GetMinLevel(i);
+    }
+
+    for (;;)
+    {
+        CTestCase TestCase;
+        TestCase.Init(m_nNumFactors);
+
+        for (WORD i = 0; i < m_nT; i++)
+            TestCase[i] = rgLevels[i];
+
+        m_bmpUncoveredT3Tuples.CoverTuple(rgColumns, rgLevels, m_rgLevelCount);
+
+        if (system.get_Constraints().IsForbidden(TestCase) == false)
+            m_rgRows.push_back(TestCase);
+
+        // advance to the next level combination
+        int i = m_nT - 1;
+        for ( ; i >= 0; i--)
+        {
+            if (rgLevels[i] < system.GetMaxLevel(i))
+            {
+                rgLevels[i]++;
+                break;
+            }
+            rgLevels[i] = system.GetMinLevel(i);
+        }
+        if (i < 0)
+            break;
+    }
+
+    return m_rgRows.size( );
+}
+
+size_t
+CIPOGTestSuite::ExtendVertical(const CComponentSystem& system, FACTOR_T nFactor)
+{
+    size_t nResult = 0;
+
+    // only test cases with a don't-care level among the factors processed so 
+    // far are able to absorb an uncovered tuple
+    m_rgDontCareRows.clear( );
+    for (size_t nRow = 0; nRow < m_rgRows.size( ); nRow++)
+    {
+        for (FACTOR_T nCurFactor = 0; nCurFactor <= nFactor; nCurFactor++)
+        {
+            if (IsValidLevel(m_rgRows[nRow][nCurFactor]) == false)
+            {
+                m_rgDontCareRows.push_back(nRow);
+                break;
+            }
+        }
+    }
+
+    std::vector<LEVEL_T> rgTuples;
+
+    FACTOR_T rgOthers [MAX_T_WAY];
+    FACTOR_T rgColumns[MAX_T_WAY];
+
+    ResetOthers(rgOthers);
+    do
+    {
+        MakeColumns(rgOthers, nFactor, rgColumns);
+
+        rgTuples.clear( );
+        size_t nNumTuples = m_bmpUncoveredT3Tuples.GetUncoveredTuples(rgColumns, rgTuples);
+
+        for (size_t n = 0; n < nNumTuples; n++)
+        {
+            const LEVEL_T* rgLevels = &rgTuples[n * m_nT];
+            CTestCase*     pRow     = nullptr;
+
+            for (auto nRow : m_rgDontCareRows)
+            {
+                bool bCompatible = true;
+                for (WORD i = 0; (i < m_nT) && bCompatible; i++)
+                {
+                    LEVEL_T nLevel = m_rgRows[nRow][rgColumns[i]];
+                    bCompatible    = (IsValidLevel(nLevel) == false) || (nLevel == rgLevels[i]);
+                }
+
+                // nor may the tuple complete a forbidden tuple of the test case
+                if (bCompatible && system.HasConstraints())
+                {
+                    CTestCase Merged(m_rgRows[nRow]);
+
+                    for (WORD i = 0; i < m_nT; i++)
+                        Merged[rgColumns[i]] = rgLevels[i];
+
+                    bCompatible = (system.get_Constraints().IsForbidden(Merged) == false);
+                }
+
+                if (bCompatible)
+                {
+                    pRow = &m_rgRows[nRow];
+                    break;
+                }
+            }
+
+            if (pRow == nullptr)
+            {
+                CTestCase TestCase;
+                TestCase.Init(m_nNumFactors);
+
+                m_rgDontCareRows.push_back(m_rgRows.size( ));
+                m_rgRows.push_back(TestCase);
+
+                pRow = &m_rgRows.back( );
+                nResult++;
+            }
+
+            for (WORD i = 0; i < m_nT; i++)
+                (*pRow)[rgColumns[i]] = rgLevels[i];
+
+            m_bmpUncoveredT3Tuples.CoverTuple(rgColumns, rgLevels, m_rgLevelCount);
+        }
+
+    } while (NextCombination(rgOthers, m_nT - 1, nFactor));
+
+    return nResult;
+}
@@ -0,0 +1,124 @@
+/**
+ *  @file       IPOGTestSuite.h
+ *  @brief      CIPOGTestSuite class interface
+ *
+ *  Provides type definitions for: CIPOGTestSuite
+ *
+ *  @author     Mark L. Short
+ *  @date       October 18, 2026
+ */
+
+#pragma once
+
+#if !defined(__IPOG_TEST_SUITE_H__)
+#define __IPOG_TEST_SUITE_H__
+
+#ifndef __TEST_SUITE_H__
+    #include "TestSuite.h"
+#endif
+
+/**
+  @brief  In-parameter-order (IPOG) test case generation engine
+
+  Rather than generating the suite one test case at a time, IPOG starts with
+  every level combination of the first t factors and then grows the suite     
+  one factor at a time:
+
+  1. Horizontal growth assigns the new factor a level in each existing test 
+     case, choosing the level that covers the most uncovered tuples involving 
+     the new factor.  Candidate levels are scored for a batch of test cases in
+     parallel, each against the same snapshot of the uncovered tuples.
+  2. Vertical growth covers any remaining tuples involving the new factor, 
+     either by assigning don't-care levels of existing test cases or by adding
+     new test cases.
+
+  Only tuples involving the new factor are visited at each step, making IPOG 
+  well suited to systems with a large number of factors.
+
+  A seeded suite takes the place of the initial array: its test cases are 
+  grown horizontally across any newly added factors, and vertical growth then
+  covers whatever tuples the seed leaves uncovered.
+
+  @sa Lei, Kacker, Kuhn, Okun, Lawrence, "IPOG: A General Strategy for T-Way 
+      Software Testing", ECBS'07
+*/
+class CIPOGTestSuite : public CTestSuite
+{
+    std::vector<CTestCase>  m_rgRows;         ///< working array of test cases
+    std::vector<size_t>     m_rgDontCareRows; ///< indices of test cases having don't-care levels
+
+public:
+    /// Default Constructor
+    CIPOGTestSuite( ) noexcept
+        : CTestSuite(),
+          m_rgRows(),
+          m_rgDontCareRows()
+    { };
+
+    /// Default Destructor
+    virtual ~CIPOGTestSuite( ) = default;
+
+/**
+  @brief  Generates a complete 3-way test suite in parameter order
+
+  @param [in]   system       CComponentSystem object, containing the inputs
+
+  @retval size_t             containing the number of test cases in the 
+                             generated suite
+*/
+    virtual size_t GenerateTestSuite(const CComponentSystem& system) override;
+
+/**
+  @brief  Generates a test case covering the lowest ranked uncovered tuple
+
+  IPOG does not construct its suites one test case at a time; this is provided
+  so the engine may still be used to top up an existing suite.  Factors not
+  involved in the tuple are assigned their minimum level.
+
+  @param [in]   system       CComponentSystem object, containing the inputs
+  @param [out]  TestCase     the resultant CTestCase object
+
+  @retval size_t             containing the number of uncovered 3-way tuples
+                             covered by the test case
+*/
+    virtual size_t GenerateTestCase(const CComponentSystem& system, CTestCase& TestCase) override;
+
+/**
+  @brief  Indicates whether the engine always generates the same suite
+
+  @retval true               IPOG is deterministic
+*/
+    virtual bool   IsDeterministic(void) const noexcept override
+    { return true; };
+
+/**
+  @brief  Returns the short name of the engine
+
+  @retval const char*        "ipog"
+*/
+    virtual const char* GetEngineName(void) const noexcept override
+    { return "ipog"; };
+
+private:
+/**
+  @brief  Initializes the working array with every level combination of the
+          first t factors
+
+  @param [in]   system       CComponentSystem object, containing the inputs
+
+  @retval size_t             containing the number of test cases
+*/
+    size_t  InitialArray     (const CComponentSystem& system);
+
+/**
+  @brief  Covers all remaining tuples involving the new factor
+
+  @param [in]   system       CComponentSystem object, containing the inputs
+  @param [in]   nFactor      the factor being added
+
+  @retval size_t             containing the number of test cases added
+*/
+    size_t  ExtendVertical   (const CComponentSystem& system, FACTOR_T nFactor);
+};
+
+#endif
@@ -0,0 +1,102 @@
+/**
+ *  @file       MappedFile.cpp
+ *  @brief      CMappedFile class implementation
+ *  @author     Mark L. Short
+ *  @date       October 18, 2026
+ */
+
+#include "stdafx.h"
+
+#if defined(_WIN32)
+    #include <Windows.h>
+#else
+    #include <fcntl.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <unistd.h>
+#endif
+
+#include "MappedFile.h"
+
+bool
+CMappedFile::Open(const TCHAR* szPath) noexcept
+{
+    Close( );
+
+#if defined(_WIN32)
+    HANDLE hFile = CreateFile(szPath, GENERIC_READ, FILE_SHARE_READ, nullptr,
+                              OPEN_EXISTING, FILE_FLAG_RANDOM_ACCESS, nullptr);
+
+    if (hFile != INVALID_HANDLE_VALUE)
+    {
+        LARGE_INTEGER liSize = { 0 };
+
+        if (GetFileSizeEx(hFile, &liSize) && (liSize.QuadPart > 0))
+        {
+            HANDLE hMapping = CreateFileMapping(hFile, nullptr, PAGE_READONLY, 0, 0, nullptr);
+
+            if (hMapping)
+            {
+                m_pView = MapViewOfFile(hMapping, FILE_MAP_READ, 0, 0, 0);
+
+                if (m_pView)
+                {
+                    m_hFile    = hFile;
+                    m_hMapping = hMapping;
+                    m_cbSize   = static_cast<size_t>(liSize.QuadPart);
+
+                    return true;
+                }
+                CloseHandle(hMapping);
+            }
+        }
+        CloseHandle(hFile);
+    }
+#else
+    int iFile = open(szPath, O_RDONLY);
+
+    if (iFile >= 0)
+    {
+        struct stat st = { };
+
+        if ((fstat(iFile, &st) == 0) && (st.st_size > 0))
+        {
+            void* pView = mmap(nullptr, static_cast<size_t>(st.st_size), PROT_READ, 
+                               MAP_SHARED, iFile, 0);
+
+            if (pView != MAP_FAILED)
+            {
+                m_pView  = pView;
+                m_cbSize = static_cast<size_t>(st.st_size);
+            }
+        }
+        // the mapping remains valid once the descriptor is closed
+        close(iFile);
+    }
+#endif
+
+    return (m_pView != nullptr);
+}
+
+void
+CMappedFile::Close(void) noexcept
+{
+#if defined(_WIN32)
+    if (m_pView)
+        UnmapViewOfFile(m_pView);
+
+    if (m_hMapping)
+        CloseHandle(m_hMapping);
+
+    if (m_hFile)
+        CloseHandle(m_hFile);
+#else
+    if (m_pView)
+        munmap(const_cast<void*>(m_pView), m_cbSize);
+#endif
+
+    m_hFile    = nullptr;
+    m_hMapping = nullptr;
+    m_pView    = nullptr;
+    m_cbSize   = 0;
+}
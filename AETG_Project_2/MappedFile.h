@@ -0,0 +1,83 @@
+/**
+ *  @file       MappedFile.h
+ *  @brief      CMappedFile class interface
+ *
+ *  Provides type definitions for: CMappedFile
+ *
+ *  @author     Mark L. Short
+ *  @date       October 18, 2026
+ */
+#pragma once
+
+#if !defined(__MAPPED_FILE_H__)
+#define __MAPPED_FILE_H__
+
+#ifndef _CSTDDEF_
+    #include <cstddef>
+#endif
+
+/**
+  @brief  A read-only memory mapped file
+
+  The implementation is kept apart from CommonDef.h, whose fixed width 
+  typedefs conflict with those of Windows.h, so the interface only exposes 
+  standard types.
+*/
+class CMappedFile
+{
+    void*        m_hFile;      ///< platform file handle
+    void*        m_hMapping;   ///< platform file mapping handle
+    const void*  m_pView;      ///< start of the mapped view
+    size_t       m_cbSize;     ///< size of the mapped view, in bytes
+
+public:
+    /// Default Constructor
+    CMappedFile() noexcept
+        : m_hFile(nullptr),
+          m_hMapping(nullptr),
+          m_pView(nullptr),
+          m_cbSize(0)
+    { };
+
+    /// Destructor, unmaps the file
+    ~CMappedFile() noexcept
+    { Close( ); };
+
+    CMappedFile(const CMappedFile&)            = delete;
+    CMappedFile& operator=(const CMappedFile&) = delete;
+
+/**
+  @brief  Maps an entire file into memory
+
+  @param [in] szPath         path of the file
+
+  @retval true               on success
+  @retval false              if the file could not be opened or mapped, or is
+                             empty
+*/
+    bool   Open(const TCHAR* szPath) noexcept;
+
+/**
+  @brief  Unmaps the file
+*/
+    void   Close(void) noexcept;
+
+// Primitive data accessors
+/**
+  @brief  Returns the start of the mapped view
+
+  @retval const void*        pointing to the first byte, or nullptr
+*/
+    inline const void* get_Data(void) const noexcept
+    { return m_pView; };
+
+/**
+  @brief  Returns the size of the mapped view
+
+  @retval size_t             containing the size in bytes
+*/
+    inline size_t      get_Size(void) const noexcept
+    { return m_cbSize; };
+};
+
+#endif
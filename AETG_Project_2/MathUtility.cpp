@@ -26,7 +26,7 @@ size_t N_Choose_T(unsigned short nN /* Factor */, unsigned short nT /* T */) noe
 
     nResult = 1;
 
-    for (int i = 1; i < nT; i++)
+    for (int i = 1; i <= nT; i++)
     {
         nResult *= nN - i + 1;
         nResult /= i;
@@ -62,3 +62,28 @@ bool NextCombination(BYTE* rgSubset, size_t nSubset_size, size_t nSet_size) noex
     }
     return false;
 }
+
+bool UnrankCombination(size_t nRank, unsigned short* rgSubset, size_t nSubset_size, size_t nSet_size) noexcept
+{
+    unsigned short x = 0;
+
+    for (size_t i = 0; i < nSubset_size; i++)
+    {
+        // skip over every block of combinations whose i'th element is
+        // smaller than the one we are looking for
+        size_t nBlock = 0;
+        while ((x < nSet_size) &&
+               (nRank >= (nBlock = N_Choose_T(static_cast<unsigned short>(nSet_size - 1 - x),
+                                              static_cast<unsigned short>(nSubset_size - 1 - i)))))
+        {
+            nRank -= nBlock;
+            x++;
+        }
+
+        if (x >= nSet_size)
+            return false;
+
+        rgSubset[i] = x++;
+    }
+    return true;
+}
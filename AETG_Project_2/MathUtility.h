@@ -85,4 +85,21 @@ bool NextCombination(unsigned short* rgSubset, size_t nSubset_size, size_t nSet_
 
 bool NextCombination(BYTE* rgSubset, size_t nSubset_size, size_t nSet_size) noexcept;
 
+/**
+  @brief Generates the combination found at a given lexicographic rank
+
+  This is the inverse of repeatedly calling NextCombination starting from
+  { 0, 1, ... nSubset_size - 1 }, allowing a range of combinations to be 
+  visited starting anywhere in the sequence.
+
+  @param [in]  nRank         zero based lexicographic rank of the combination
+  @param [out] rgSubset      destination sequence of nSubset_size elements
+  @param [in]  nSubset_size  the number of elements in rgSubset
+  @param [in]  nSet_size     the number of elements in the overall set
+
+  @retval true               on success
+  @retval false              if nRank is out of range
+*/
+bool UnrankCombination(size_t nRank, unsigned short* rgSubset, size_t nSubset_size, size_t nSet_size) noexcept;
+
 #endif
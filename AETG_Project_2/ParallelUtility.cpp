@@ -0,0 +1,73 @@
+/**
+ *  @file       ParallelUtility.cpp
+ *  @brief      Implementation of ParallelUtility.cpp
+ *  @author     Mark L. Short
+ *  @date       October 18, 2026
+ */
+
+#include "stdafx.h"
+
+#include <algorithm>
+#include <thread>
+#include <vector>
+
+#include "ParallelUtility.h"
+
+unsigned int GetNumWorkerThreads(void) noexcept
+{
+    unsigned int nResult = std::thread::hardware_concurrency( );
+
+    // hardware_concurrency is permitted to return 0 when it can't tell
+    if (nResult == 0)
+        nResult = 1;
+
+    return nResult;
+}
+
+unsigned int ParallelForRange(size_t nBegin, size_t nEnd, size_t nGrain, const RANGE_FN& fnBody)
+{
+    unsigned int nResult = 0;
+
+    if (nEnd > nBegin)
+    {
+        size_t nSize = nEnd - nBegin;
+
+        if (nGrain == 0)
+            nGrain = 1;
+
+        nResult = static_cast<unsigned int>(std::min<size_t>(GetNumWorkerThreads( ),
+                                                              (nSize + nGrain - 1) / nGrain));
+        if (nResult <= 1)
+        {
+            nResult = 1;
+            fnBody(nBegin, nEnd, 0);
+        }
+        else
+        {
+            std::vector<std::thread> vThreads;
+            vThreads.reserve(nResult - 1);
+
+            size_t nChunk = nSize / nResult;
+            size_t nExtra = nSize % nResult;
+            size_t nFirst = nBegin;
+
+            for (unsigned int i = 0; i < nResult; i++)
+            {
+                size_t nLast = nFirst + nChunk + ((i < nExtra) ? 1 : 0);
+
+                // the calling thread services the final partition itself
+                if (i == nResult - 1)
+                    fnBody(nFirst, nLast, i);
+                else
+                    vThreads.emplace_back(fnBody, nFirst, nLast, i);
+
+                nFirst = nLast;
+            }
+
+            for (auto& it : vThreads)
+                it.join( );
+        }
+    }
+
+    return nResult;
+}
@@ -0,0 +1,51 @@
+/**
+ *  @file       ParallelUtility.h
+ *  @brief      Multi-threading utility method declarations
+ *  @author     Mark L. Short
+ *  @date       October 18, 2026
+ */
+#pragma once
+
+#if !defined(__PARALLEL_UTILITY_H__)
+#define __PARALLEL_UTILITY_H__
+
+#ifndef _FUNCTIONAL_
+    #include <functional>
+#endif
+
+/**
+  @brief  Signature of a partitioned work item
+
+  The work item is handed a half-open range [nFirst, nLast) along with the 
+  zero based index of the partition it is servicing, which may be used to 
+  address per-thread scratch data without any locking.
+*/
+typedef std::function<void(size_t nFirst, size_t nLast, unsigned int nPartition)> RANGE_FN;
+
+/**
+  @brief  Returns the number of worker threads to be used for partitioned work
+
+  @retval unsigned int       containing the number of hardware threads, 
+                             which is always at least 1
+*/
+unsigned int GetNumWorkerThreads(void) noexcept;
+
+/**
+  @brief  Executes a work item over a range, partitioned across threads
+
+  The range [nBegin, nEnd) is split into contiguous partitions of roughly equal 
+  size, each of which is serviced on its own thread.  Ranges smaller than 
+  nGrain are not worth the thread creation overhead and are executed on the 
+  calling thread as a single partition.
+
+  @param [in] nBegin         inclusive start of the range
+  @param [in] nEnd           exclusive end of the range
+  @param [in] nGrain         minimum number of elements per partition
+  @param [in] fnBody         work item to be executed for each partition
+
+  @retval unsigned int       containing the number of partitions used
+  @retval 0                  if the range was empty
+*/
+unsigned int ParallelForRange(size_t nBegin, size_t nEnd, size_t nGrain, const RANGE_FN& fnBody);
+
+#endif
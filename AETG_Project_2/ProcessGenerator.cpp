@@ -0,0 +1,384 @@
+/**
+ *  @file       ProcessGenerator.cpp
+ *  @brief      CProcessGenerator class implementation
+ *  @author     Mark L. Short
+ *  @date       October 18, 2026
+ */
+
+#include "stdafx.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include "BinarySuite.h"
+#include "GenerationContext.h"
+#include "ProcessHost.h"
+#include "SuiteReader.h"
+
+#include "ProcessGenerator.h"
+
+/// identifies the layout of a generation section
+constexpr const QWORD SECTION_MAGIC      = 0x314D485347544541ull;   // "AETGSHM1"
+
+/// start of a section name, followed by the process number and generation
+constexpr const TCHAR* SECTION_PREFIX    = _T("AETG_");
+
+/// alignment of the baseline image, keeping it clear of the pages the
+/// workers write their figures to
+constexpr const size_t IMAGE_ALIGNMENT   = 64 * 1024;
+
+/// engine and flag bits of SECTION_HEADER::nFlags
+constexpr const DWORD  SECTION_REDUCE    = 0x01;
+constexpr const DWORD  SECTION_MERGE     = 0x02;
+constexpr const DWORD  SECTION_CONSTRUCT = 0x04;
+constexpr const DWORD  SECTION_RECURSIVE = 0x08;
+
+/**
+  @brief  The start of a generation section
+
+  The model follows the header as DWORDs: the factor count and the level
+  count of each factor, the relation count and for each relation its
+  strength, factor count and factors, then the forbidden tuple count and for
+  each tuple its size and global levels.  The worker slots follow the model,
+  and the baseline image starts at nImageOffset.
+*/
+struct SECTION_HEADER
+{
+    QWORD   qwMagic;            ///< SECTION_MAGIC
+    DWORD   nNumSlots;          ///< number of worker slots
+    DWORD   nFlags;             ///< SECTION_ flags
+    WORD    nT;                 ///< base interaction strength
+    WORD    wReserved[3];       ///< zero
+    char    szEngine[16];       ///< generation engine name
+    QWORD   nModelOffset;       ///< offset of the model, in bytes
+    QWORD   nModelSize;         ///< size of the model, in DWORDs
+    QWORD   nSlotOffset;        ///< offset of the first worker slot, in bytes
+    QWORD   nImageOffset;       ///< offset of the baseline image, in bytes
+    QWORD   cbImage;            ///< size of the baseline image, in bytes
+};
+
+/**
+  @brief  A worker's share of the repetitions and its figures
+*/
+struct WORKER_SLOT
+{
+    DWORD   nRepetitions;           ///< repetitions to run
+    DWORD   nCompleted;             ///< complete suites generated
+    QWORD   nBest;                  ///< rows of the smallest suite
+    QWORD   nTotal;                 ///< rows summed over the suites
+    QWORD   nWorst;                 ///< rows of the largest suite
+    double  dSeconds;               ///< generation time summed over the suites
+    QWORD   nUnresolved;            ///< tuples left unresolved by the smallest suite
+    TCHAR   szSuitePath[_MAX_PATH]; ///< file receiving the smallest suite
+};
+
+/**
+  @brief  Packs a model into the DWORDs of a section
+
+  @param [in]  system        target CComponentSystem
+  @param [in]  rgForbidden   the forbidden tuples added to the system
+  @param [out] rgModel       the packed model
+*/
+static void PackModel(const CComponentSystem& system, const std::vector<std::vector<LEVEL_T>>& rgForbidden,
+                      std::vector<DWORD>& rgModel)
+{
+    rgModel.clear();
+    rgModel.push_back(system.get_NumFactors( ));
+
+    for (FACTOR_T nCurFactor = 0; nCurFactor < system.get_NumFactors( ); nCurFactor++)
+        rgModel.push_back(system.GetNumLevels(nCurFactor));
+
+    rgModel.push_back(static_cast<DWORD>(system.get_Relations().size()));
+
+    for (const auto& it : system.get_Relations( ))
+    {
+        rgModel.push_back(it.nT);
+        rgModel.push_back(static_cast<DWORD>(it.rgFactors.size()));
+        rgModel.insert(rgModel.end(), it.rgFactors.begin(), it.rgFactors.end());
+    }
+
+    rgModel.push_back(static_cast<DWORD>(rgForbidden.size()));
+
+    for (const auto& it : rgForbidden)
+    {
+        rgModel.push_back(static_cast<DWORD>(it.size()));
+        rgModel.insert(rgModel.end(), it.begin(), it.end());
+    }
+}
+
+/**
+  @brief  Rebuilds a model packed by PackModel
+
+  @param [in]  pModel        the packed model
+  @param [in]  nModelSize    size of the packed model, in DWORDs
+  @param [in]  nT            base interaction strength
+  @param [out] system        the model
+
+  @retval true               on success
+  @retval false              if the packed model is malformed
+*/
+static bool UnpackModel(const DWORD* pModel, size_t nModelSize, WORD nT, CComponentSystem& system)
+{
+    const DWORD* pEnd = pModel + nModelSize;
+
+    // each count is checked against the words remaining before it is used
+    auto Take = [&](DWORD nCount, const DWORD*& pItems) -> bool
+    {
+        if (static_cast<size_t>(pEnd - pModel) < nCount)
+            return false;
+
+        pItems  = pModel;
+        pModel += nCount;
+        return true;
+    };
+
+    const DWORD* pItems = nullptr;
+
+    if (!Take(1, pItems) || !Take(pItems[0], pItems))
+        return false;
+
+    std::vector<LEVEL_T> rgNumLevels(pItems, pModel);
+
+    if (!system.Init(rgNumLevels) || !system.SetStrength(nT) || !Take(1, pItems))
+        return false;
+
+    for (DWORD nNumRelations = pItems[0]; nNumRelations > 0; nNumRelations--)
+    {
+        if (!Take(2, pItems))
+            return false;
+
+        WORD nRelationT = static_cast<WORD>(pItems[0]);
+
+        if (!Take(pItems[1], pItems))
+            return false;
+
+        system.AddRelation(std::vector<FACTOR_T>(pItems, pModel), nRelationT);
+    }
+
+    if (!Take(1, pItems))
+        return false;
+
+    // forbidden tuples the coordinator's system ignored are ignored here too
+    for (DWORD nNumForbidden = pItems[0]; nNumForbidden > 0; nNumForbidden--)
+    {
+        if (!Take(1, pItems) || !Take(pItems[0], pItems))
+            return false;
+
+        system.AddForbiddenTuple(std::vector<LEVEL_T>(pItems, pModel));
+    }
+
+    return true;
+}
+
+bool
+CProcessGenerator::Generate(const CComponentSystem& system, const std::vector<std::vector<LEVEL_T>>& rgForbidden,
+                            CTestSuite& testSuite, unsigned int nNumProcesses, DWORD nRepetitions,
+                            bool bReduce, bool bMerge, std::list<CTestCase>& lstTestSuite,
+                            PROCESS_RESULT& result)
+{
+    static std::atomic<unsigned int> s_nGeneration(0);
+
+    CSharedSection      section;
+    std::vector<DWORD>  rgModel;
+    TCHAR               szName[64]            = { 0 };
+    TCHAR               szTempDir[_MAX_PATH]  = { 0 };
+
+    memset(&result, 0, sizeof(result));
+    lstTestSuite.clear();
+
+    nNumProcesses = std::min<unsigned int>(nNumProcesses, nRepetitions);
+
+    if ((nNumProcesses == 0) || (GetTempDirectory(szTempDir, _countof(szTempDir)) == nullptr))
+        return false;
+
+    PackModel(system, rgForbidden, rgModel);
+
+    size_t nModelOffset = sizeof(SECTION_HEADER);
+    size_t nSlotOffset  = nModelOffset + rgModel.size() * sizeof(DWORD);
+    nSlotOffset         = (nSlotOffset + sizeof(QWORD) - 1) / sizeof(QWORD) * sizeof(QWORD);
+    size_t nImageOffset = nSlotOffset + nNumProcesses * sizeof(WORKER_SLOT);
+    nImageOffset        = (nImageOffset + IMAGE_ALIGNMENT - 1) / IMAGE_ALIGNMENT * IMAGE_ALIGNMENT;
+    size_t cbImage      = testSuite.GetBaselineSize( );
+
+    unsigned int nGeneration = s_nGeneration++;
+
+    _sntprintf(szName, _countof(szName) - 1, _T("%s%lu_%u"), SECTION_PREFIX, GetCurrentProcessNumber(), nGeneration);
+
+    // the section of a run whose coordinator was killed is still around
+    RemoveStaleSections(SECTION_PREFIX);
+
+    if (section.Create(szName, nImageOffset + cbImage) == false)
+        return false;
+
+    BYTE*           pSection = static_cast<BYTE*>(section.get_Data( ));
+    SECTION_HEADER* pHeader  = reinterpret_cast<SECTION_HEADER*>(pSection);
+    WORKER_SLOT*    rgSlots  = reinterpret_cast<WORKER_SLOT*>(pSection + nSlotOffset);
+
+    pHeader->qwMagic      = SECTION_MAGIC;
+    pHeader->nNumSlots    = nNumProcesses;
+    pHeader->nFlags       = (bReduce                           ? SECTION_REDUCE    : 0) |
+                            (bMerge                            ? SECTION_MERGE     : 0) |
+                            (testSuite.get_UseConstructions()  ? SECTION_CONSTRUCT : 0) |
+                            (testSuite.get_UseRecursive()      ? SECTION_RECURSIVE : 0);
+    pHeader->nT           = system.get_Strength( );
+    pHeader->nModelOffset = nModelOffset;
+    pHeader->nModelSize   = rgModel.size( );
+    pHeader->nSlotOffset  = nSlotOffset;
+    pHeader->nImageOffset = nImageOffset;
+    pHeader->cbImage      = cbImage;
+
+    strncpy(pHeader->szEngine, testSuite.GetEngineName(), sizeof(pHeader->szEngine) - 1);
+    std::copy(rgModel.begin(), rgModel.end(), reinterpret_cast<DWORD*>(pSection + nModelOffset));
+
+    if (testSuite.WriteBaseline(system, pSection + nImageOffset, cbImage) == false)
+        return false;
+
+    // a truncated path could be shared by two workers, so the run fails 
+    // before any is started
+    for (unsigned int i = 0; i < nNumProcesses; i++)
+    {
+        int iLength = _sntprintf(rgSlots[i].szSuitePath, _countof(rgSlots[i].szSuitePath) - 1, 
+                                 _T("%s%s_%u.bin"), szTempDir, szName, i);
+
+        if ((iLength < 0) || (static_cast<size_t>(iLength) >= _countof(rgSlots[i].szSuitePath) - 1))
+            return false;
+    }
+
+    std::vector<WORKER_PROCESS> rgProcesses(nNumProcesses, nullptr);
+
+    for (unsigned int i = 0; i < nNumProcesses; i++)
+    {
+        TCHAR szArgs[128] = { 0 };
+
+        rgSlots[i].nRepetitions = nRepetitions / nNumProcesses + ((i < nRepetitions % nNumProcesses) ? 1 : 0);
+
+        _sntprintf(szArgs, _countof(szArgs) - 1, _T("-worker %s -slot %u"), szName, i);
+
+        if (StartWorkerProcess(szArgs, [&szName, i] { return RunWorker(szName, i); }, rgProcesses[i]) == false)
+            rgProcesses[i] = nullptr;
+    }
+
+    // the figures are final once each worker has exited
+    for (unsigned int i = 0; i < nNumProcesses; i++)
+    {
+        const WORKER_SLOT& slot = rgSlots[i];
+
+        if ((rgProcesses[i] == nullptr) || (WaitWorkerProcess(rgProcesses[i]) != 0) || (slot.nCompleted == 0))
+        {
+            _tremove(slot.szSuitePath);
+            continue;
+        }
+
+        std::list<CTestCase> lstWorker;
+        std::vector<LEVEL_T> rgMinLevel;
+        std::vector<LEVEL_T> rgNumLevels;
+
+        if (((result.nBest == 0) || (slot.nBest < result.nBest)) &&
+            ReadTestSuite(slot.szSuitePath, std::vector<LEVEL_T>(), rgMinLevel, rgNumLevels, lstWorker))
+        {
+            lstTestSuite.swap(lstWorker);
+            result.nBest       = static_cast<size_t>(slot.nBest);
+            result.nUnresolved = static_cast<size_t>(slot.nUnresolved);
+        }
+
+        _tremove(slot.szSuitePath);
+
+        result.nRepetitions += slot.nCompleted;
+        result.nTotal       += static_cast<size_t>(slot.nTotal);
+        result.nWorst        = std::max(result.nWorst, static_cast<size_t>(slot.nWorst));
+        result.dSeconds     += slot.dSeconds;
+    }
+
+    return (result.nRepetitions > 0) && !lstTestSuite.empty();
+}
+
+int
+CProcessGenerator::RunWorker(const TCHAR* szSection, unsigned int nSlot)
+{
+    typedef std::chrono::steady_clock CLOCK;
+
+    CSharedSection   section;
+    CComponentSystem system;
+
+    if (section.Open(szSection) == false)
+        return 2;
+
+    const BYTE*           pSection = static_cast<const BYTE*>(section.get_Data( ));
+    const SECTION_HEADER* pHeader  = reinterpret_cast<const SECTION_HEADER*>(pSection);
+
+    if ((section.get_Size() < sizeof(SECTION_HEADER)) || (pHeader->qwMagic != SECTION_MAGIC) ||
+        (nSlot >= pHeader->nNumSlots) ||
+        (pHeader->nImageOffset + pHeader->cbImage > section.get_Size()) ||
+        (pHeader->nSlotOffset + pHeader->nNumSlots * sizeof(WORKER_SLOT) > pHeader->nImageOffset) ||
+        (pHeader->nModelOffset + pHeader->nModelSize * sizeof(DWORD) > pHeader->nSlotOffset))
+        return 2;
+
+    WORKER_SLOT& slot = reinterpret_cast<WORKER_SLOT*>(static_cast<BYTE*>(section.get_Data()) +
+                                                       pHeader->nSlotOffset)[nSlot];
+
+    char szEngine[sizeof(pHeader->szEngine) + 1] = { 0 };
+    memcpy(szEngine, pHeader->szEngine, sizeof(pHeader->szEngine));
+
+    std::unique_ptr<CTestSuite> pTestSuite = CGenerationContext::CreateTestSuite(szEngine);
+
+    if ((pTestSuite == nullptr) ||
+        !UnpackModel(reinterpret_cast<const DWORD*>(pSection + pHeader->nModelOffset),
+                     static_cast<size_t>(pHeader->nModelSize), pHeader->nT, system))
+        return 2;
+
+    size_t nImageOffset = static_cast<size_t>(pHeader->nImageOffset);
+
+    pTestSuite->set_UseConstructions((pHeader->nFlags & SECTION_CONSTRUCT) != 0);
+    pTestSuite->set_UseRecursive    ((pHeader->nFlags & SECTION_RECURSIVE) != 0);
+    pTestSuite->SetBaselineSource([&section, nImageOffset]() -> void*
+        {
+            BYTE* pView = static_cast<BYTE*>(section.MapPrivateView( ));
+
+            return pView ? (pView + nImageOffset) : nullptr;
+        });
+    pTestSuite->Init(system);
+
+    if (pTestSuite->GetBaselineSize() != pHeader->cbImage)
+        return 2;
+
+    std::list<CTestCase> lstBestTestSuite;
+
+    for (DWORD i = 0; i < slot.nRepetitions; i++)
+    {
+        CLOCK::time_point tpStart = CLOCK::now( );
+
+        // one construction between all of the workers is enough, the rest 
+        // of the repetitions search
+        pTestSuite->set_UseRecursive(((pHeader->nFlags & SECTION_RECURSIVE) != 0) && (nSlot == 0) && (i == 0));
+
+        size_t nCurAETG = pTestSuite->GenerateTestSuite(system);
+
+        if (pHeader->nFlags & SECTION_REDUCE)
+            nCurAETG -= pTestSuite->ReduceTestSuite(system);
+
+        if (pHeader->nFlags & SECTION_MERGE)
+            nCurAETG -= pTestSuite->MergeTestSuite(system);
+
+        slot.dSeconds += std::chrono::duration<double>(CLOCK::now() - tpStart).count( );
+        slot.nTotal   += nCurAETG;
+        slot.nWorst    = std::max<QWORD>(slot.nWorst, nCurAETG);
+        slot.nCompleted++;
+
+        if ((slot.nBest == 0) || (nCurAETG < slot.nBest))
+        {
+            slot.nBest       = nCurAETG;
+            slot.nUnresolved = pTestSuite->get_NumUnresolvedTuples( );
+            lstBestTestSuite.clear();
+            pTestSuite->SpliceTestSuite(lstBestTestSuite);
+        }
+    }
+
+    if ((slot.nCompleted > 0) &&
+        (WriteBinarySuite(slot.szSuitePath, system, system.get_Strength(), lstBestTestSuite,
+                          pTestSuite->GetEngineName(), slot.nCompleted) == false))
+        return 2;
+
+    return 0;
+}
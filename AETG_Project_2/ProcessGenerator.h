@@ -0,0 +1,104 @@
+/**
+ *  @file       ProcessGenerator.h
+ *  @brief      CProcessGenerator class interface
+ *
+ *  Provides type definitions for: PROCESS_RESULT, CProcessGenerator
+ *
+ *  @author     Mark L. Short
+ *  @date       October 18, 2026
+ */
+#pragma once
+
+#if !defined(__PROCESS_GENERATOR_H__)
+#define __PROCESS_GENERATOR_H__
+
+#ifndef __COMMON_DEF_H__
+    #include "CommonDef.h"
+#endif
+
+#ifndef _LIST_
+    #include <list>
+#endif
+
+#ifndef _VECTOR_
+    #include <vector>
+#endif
+
+#ifndef __COMPONENT_SYSTEM_H__
+    #include "ComponentSystem.h"
+#endif
+
+#ifndef __TEST_SUITE_H__
+    #include "TestSuite.h"
+#endif
+
+/**
+  @brief  Figures of the repetitions run by the worker processes
+*/
+struct PROCESS_RESULT
+{
+    DWORD   nRepetitions;   ///< complete suites generated
+    size_t  nBest;          ///< rows of the smallest suite
+    size_t  nTotal;         ///< rows summed over the suites
+    size_t  nWorst;         ///< rows of the largest suite
+    double  dSeconds;       ///< generation time summed over the suites
+    size_t  nUnresolved;    ///< tuples left unresolved by the smallest suite
+};
+
+/**
+  @brief  Runs the repetitions of a generation in worker processes sharing a
+          single baseline coverage image
+
+  For a high strength over many factors the coverage bitmap alone runs to
+  gigabytes, too much for a private copy per thread.  The coordinator fills
+  the bitmap once, into a CSharedSection along with the model, and starts
+  the workers.  Each worker starts every repetition from a fresh
+  copy-on-write view of the image, so that it holds only the pages its own
+  generation has covered tuples in, scoring candidates against the rest of
+  the shared image.  Each worker reports its figures in a slot of the
+  section, and its smallest suite in a temporary binary suite file, from
+  which the coordinator keeps the best.
+
+  On Windows the workers are new instances of the executable, started with
+  <b>-worker name -slot n</b>, which hands them to RunWorker; elsewhere they
+  are forks of the coordinator.
+*/
+class CProcessGenerator
+{
+public:
+/**
+  @brief  Generates suites in worker processes, keeping the smallest
+
+  @param [in]  system        target CComponentSystem
+  @param [in]  rgForbidden   the forbidden tuples added to the system
+  @param [in]  testSuite     the engine, initialized for the system; its
+                             coverage bitmap is used to build the image
+  @param [in]  nNumProcesses number of worker processes
+  @param [in]  nRepetitions  number of suites to generate, spread over the
+                             workers
+  @param [in]  bReduce       true to remove the redundant rows of each suite
+  @param [in]  bMerge        true to merge the compatible rows of each suite
+  @param [out] lstTestSuite  the smallest suite
+  @param [out] result        figures of the repetitions
+
+  @retval true               if any suite was generated
+  @retval false              if the section or workers could not be set up,
+                             or every worker failed
+*/
+    bool   Generate(const CComponentSystem& system, const std::vector<std::vector<LEVEL_T>>& rgForbidden,
+                    CTestSuite& testSuite, unsigned int nNumProcesses, DWORD nRepetitions,
+                    bool bReduce, bool bMerge, std::list<CTestCase>& lstTestSuite,
+                    PROCESS_RESULT& result);
+
+/**
+  @brief  Runs the repetitions of a worker's slot
+
+  @param [in] szSection      name of the coordinator's section
+  @param [in] nSlot          the worker's slot
+
+  @retval int                0 on success, 2 on error
+*/
+    static int RunWorker(const TCHAR* szSection, unsigned int nSlot);
+};
+
+#endif
@@ -0,0 +1,381 @@
+/**
+ *  @file       ProcessHost.cpp
+ *  @brief      Shared memory and worker processes of multi-process generation
+ *  @author     Mark L. Short
+ *  @date       October 18, 2026
+ */
+
+#include "stdafx.h"
+
+#if defined(_WIN32)
+    #include <Windows.h>
+#else
+    #include <dirent.h>
+    #include <fcntl.h>
+    #include <signal.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <sys/wait.h>
+    #include <unistd.h>
+    #include <cerrno>
+    #include <cstdint>
+    #include <cstdlib>
+    #include <cstring>
+#endif
+
+#include <cstdio>
+#include <iostream>
+#include <string>
+
+#include "ProcessHost.h"
+
+/**
+  @brief  Forms the platform name of a section
+
+  @param [in]  szName        name of the section
+  @param [out] szFullName    receives the platform name
+  @param [in]  cchLen        size of szFullName, in characters
+
+  @retval true               on success
+  @retval false              if the name is too long
+*/
+static bool MakeSectionName(const TCHAR* szName, TCHAR* szFullName, size_t cchLen) noexcept
+{
+#if defined(_WIN32)
+    const TCHAR* szPrefix = _T("Local\\");
+#else
+    const TCHAR* szPrefix = _T("/");
+#endif
+
+    if (_tcslen(szPrefix) + _tcslen(szName) >= cchLen)
+        return false;
+
+    _tcsncpy(szFullName, szPrefix, cchLen);
+    _tcsncpy(szFullName + _tcslen(szPrefix), szName, cchLen - _tcslen(szPrefix));
+
+    return true;
+}
+
+bool
+CSharedSection::Create(const TCHAR* szName, size_t cbSize) noexcept
+{
+    Close( );
+
+    if ((cbSize == 0) || !MakeSectionName(szName, m_szName, _countof(m_szName)))
+        return false;
+
+#if defined(_WIN32)
+    ULARGE_INTEGER uliSize;
+    uliSize.QuadPart = cbSize;
+
+    HANDLE hSection = CreateFileMapping(INVALID_HANDLE_VALUE, nullptr, PAGE_READWRITE,
+                                        uliSize.HighPart, uliSize.LowPart, m_szName);
+
+    if (hSection && (GetLastError() == ERROR_ALREADY_EXISTS))
+    {
+        CloseHandle(hSection);
+        hSection = nullptr;
+    }
+
+    if (hSection)
+    {
+        m_pView = MapViewOfFile(hSection, FILE_MAP_ALL_ACCESS, 0, 0, cbSize);
+
+        if (m_pView == nullptr)
+            CloseHandle(hSection);
+        else
+            m_hSection = hSection;
+    }
+#else
+    int iSection = shm_open(m_szName, O_CREAT | O_EXCL | O_RDWR, 0600);
+
+    if (iSection >= 0)
+    {
+        void* pView = MAP_FAILED;
+
+        if (ftruncate(iSection, static_cast<off_t>(cbSize)) == 0)
+            pView = mmap(nullptr, cbSize, PROT_READ | PROT_WRITE, MAP_SHARED, iSection, 0);
+
+        if (pView != MAP_FAILED)
+        {
+            m_pView    = pView;
+            m_iSection = iSection;
+        }
+        else
+        {
+            close(iSection);
+            shm_unlink(m_szName);
+        }
+    }
+#endif
+
+    if (m_pView)
+    {
+        m_cbSize   = cbSize;
+        m_bCreator = true;
+    }
+
+    return (m_pView != nullptr);
+}
+
+bool
+CSharedSection::Open(const TCHAR* szName) noexcept
+{
+    Close( );
+
+    if (!MakeSectionName(szName, m_szName, _countof(m_szName)))
+        return false;
+
+#if defined(_WIN32)
+    HANDLE hSection = OpenFileMapping(FILE_MAP_ALL_ACCESS, FALSE, m_szName);
+
+    if (hSection)
+    {
+        MEMORY_BASIC_INFORMATION mbi = { 0 };
+
+        m_pView = MapViewOfFile(hSection, FILE_MAP_ALL_ACCESS, 0, 0, 0);
+
+        // a view spans whole pages, the section's own size being rounded up
+        if (m_pView && VirtualQuery(m_pView, &mbi, sizeof(mbi)))
+        {
+            m_hSection = hSection;
+            m_cbSize   = mbi.RegionSize;
+        }
+        else
+        {
+            if (m_pView)
+                UnmapViewOfFile(m_pView);
+
+            m_pView = nullptr;
+            CloseHandle(hSection);
+        }
+    }
+#else
+    int iSection = shm_open(m_szName, O_RDWR, 0600);
+
+    if (iSection >= 0)
+    {
+        struct stat st = { };
+        void*       pView = MAP_FAILED;
+
+        if ((fstat(iSection, &st) == 0) && (st.st_size > 0))
+            pView = mmap(nullptr, static_cast<size_t>(st.st_size), PROT_READ | PROT_WRITE,
+                         MAP_SHARED, iSection, 0);
+
+        if (pView != MAP_FAILED)
+        {
+            m_pView    = pView;
+            m_iSection = iSection;
+            m_cbSize   = static_cast<size_t>(st.st_size);
+        }
+        else
+        {
+            close(iSection);
+        }
+    }
+#endif
+
+    return (m_pView != nullptr);
+}
+
+void*
+CSharedSection::MapPrivateView(void) noexcept
+{
+    if (m_pView == nullptr)
+        return nullptr;
+
+#if defined(_WIN32)
+    if (m_pPrivate)
+        UnmapViewOfFile(m_pPrivate);
+
+    m_pPrivate = MapViewOfFile(m_hSection, FILE_MAP_COPY, 0, 0, m_cbSize);
+#else
+    if (m_pPrivate)
+        munmap(m_pPrivate, m_cbSize);
+
+    m_pPrivate = mmap(nullptr, m_cbSize, PROT_READ | PROT_WRITE, MAP_PRIVATE, m_iSection, 0);
+
+    if (m_pPrivate == MAP_FAILED)
+        m_pPrivate = nullptr;
+#endif
+
+    return m_pPrivate;
+}
+
+void
+CSharedSection::Close(void) noexcept
+{
+#if defined(_WIN32)
+    if (m_pPrivate)
+        UnmapViewOfFile(m_pPrivate);
+
+    if (m_pView)
+        UnmapViewOfFile(m_pView);
+
+    if (m_hSection)
+        CloseHandle(m_hSection);
+#else
+    if (m_pPrivate)
+        munmap(m_pPrivate, m_cbSize);
+
+    if (m_pView)
+        munmap(m_pView, m_cbSize);
+
+    if (m_iSection >= 0)
+        close(m_iSection);
+
+    // the object outlives its descriptors until unlinked
+    if (m_pView && m_bCreator)
+        shm_unlink(m_szName);
+#endif
+
+    m_hSection = nullptr;
+    m_iSection = -1;
+    m_pView    = nullptr;
+    m_pPrivate = nullptr;
+    m_cbSize   = 0;
+    m_bCreator = false;
+}
+
+bool StartWorkerProcess(const TCHAR* szArgs, const std::function<int(void)>& fnWorker,
+                        WORKER_PROCESS& hProcess) noexcept
+{
+    hProcess = nullptr;
+
+#if defined(_WIN32)
+    (void) fnWorker;
+
+    TCHAR szModule[_MAX_PATH] = { 0 };
+
+    if (GetModuleFileName(nullptr, szModule, _countof(szModule)) == 0)
+        return false;
+
+    // CreateProcess may write to the command line, so it is a private copy
+    tstring strCommandLine = tstring(_T("\"")) + szModule + _T("\" ") + szArgs;
+
+    STARTUPINFO         si = { sizeof(si) };
+    PROCESS_INFORMATION pi = { 0 };
+
+    if (CreateProcess(szModule, &strCommandLine[0], nullptr, nullptr, FALSE, 0,
+                      nullptr, nullptr, &si, &pi) == FALSE)
+        return false;
+
+    CloseHandle(pi.hThread);
+    hProcess = pi.hProcess;
+#else
+    (void) szArgs;
+
+    // buffered output would otherwise be written by both processes
+    std::cout.flush( );
+    std::cerr.flush( );
+    fflush(nullptr);
+
+    pid_t pid = fork( );
+
+    if (pid < 0)
+        return false;
+
+    if (pid == 0)
+        _exit(fnWorker( ));
+
+    hProcess = reinterpret_cast<WORKER_PROCESS>(static_cast<intptr_t>(pid));
+#endif
+
+    return true;
+}
+
+int WaitWorkerProcess(WORKER_PROCESS hProcess) noexcept
+{
+    int iResult = -1;
+
+#if defined(_WIN32)
+    DWORD dwExitCode = 0;
+
+    if ((WaitForSingleObject(hProcess, INFINITE) == WAIT_OBJECT_0) &&
+        GetExitCodeProcess(hProcess, &dwExitCode))
+        iResult = static_cast<int>(dwExitCode);
+
+    CloseHandle(hProcess);
+#else
+    int   iStatus = 0;
+    pid_t pid     = static_cast<pid_t>(reinterpret_cast<intptr_t>(hProcess));
+
+    if ((waitpid(pid, &iStatus, 0) == pid) && WIFEXITED(iStatus))
+        iResult = WEXITSTATUS(iStatus);
+#endif
+
+    return iResult;
+}
+
+unsigned long GetCurrentProcessNumber(void) noexcept
+{
+#if defined(_WIN32)
+    return GetCurrentProcessId( );
+#else
+    return static_cast<unsigned long>(getpid( ));
+#endif
+}
+
+size_t RemoveStaleSections(const TCHAR* szPrefix) noexcept
+{
+    size_t nResult = 0;
+
+#if defined(_WIN32)
+    (void) szPrefix;
+#else
+    // Linux lists its shared memory objects here; elsewhere there is no 
+    // listing, and nothing is removed
+    DIR*   pDir      = opendir("/dev/shm");
+    size_t cchPrefix = strlen(szPrefix);
+
+    if (pDir == nullptr)
+        return 0;
+
+    while (const struct dirent* pEntry = readdir(pDir))
+    {
+        const char* szEntry = pEntry->d_name;
+        char*       pEnd    = nullptr;
+
+        if (strncmp(szEntry, szPrefix, cchPrefix) != 0)
+            continue;
+
+        unsigned long nProcess = strtoul(szEntry + cchPrefix, &pEnd, 10);
+
+        if ((pEnd == szEntry + cchPrefix) || (*pEnd != '_'))
+            continue;
+
+        // a process of another user answers EPERM, and is left alone
+        if ((kill(static_cast<pid_t>(nProcess), 0) == 0) || (errno != ESRCH))
+            continue;
+
+        std::string strName = std::string("/") + szEntry;
+
+        if (shm_unlink(strName.c_str()) == 0)
+            nResult++;
+    }
+
+    closedir(pDir);
+#endif
+
+    return nResult;
+}
+
+TCHAR* GetTempDirectory(TCHAR* szPath, size_t cchLen) noexcept
+{
+#if defined(_WIN32)
+    DWORD dwLen = GetTempPath(static_cast<DWORD>(cchLen), szPath);
+
+    return ((dwLen > 0) && (dwLen < cchLen)) ? szPath : nullptr;
+#else
+    const char* szDir = getenv("TMPDIR");
+
+    if ((szDir == nullptr) || (*szDir == '\0'))
+        szDir = "/tmp";
+
+    if (strlen(szDir) + 2 > cchLen)
+        return nullptr;
+
+    snprintf(szPath, cchLen, "%s%s", szDir, (szDir[strlen(szDir) - 1] == '/') ? "" : "/");
+    return szPath;
+#endif
+}
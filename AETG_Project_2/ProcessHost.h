@@ -0,0 +1,182 @@
+/**
+ *  @file       ProcessHost.h
+ *  @brief      Shared memory and worker processes of multi-process generation
+ *
+ *  Provides type definitions for: CSharedSection
+ *
+ *  The implementation is kept apart from CommonDef.h, whose fixed width
+ *  typedefs conflict with those of Windows.h, so the interface only exposes
+ *  standard types.
+ *
+ *  @author     Mark L. Short
+ *  @date       October 18, 2026
+ */
+#pragma once
+
+#if !defined(__PROCESS_HOST_H__)
+#define __PROCESS_HOST_H__
+
+#ifndef _CSTDDEF_
+    #include <cstddef>
+#endif
+
+#ifndef _FUNCTIONAL_
+    #include <functional>
+#endif
+
+/**
+  @brief  A named section of memory shared between processes
+
+  The section is a Windows file mapping backed by the paging file, and
+  elsewhere a POSIX shared memory object.  Besides the shared view, through
+  which every process sees the writes of the others, a process may map a
+  private view, whose pages are copied on the first write to them, so that
+  a large read-mostly image is held once however many processes work on it.
+  The section lasts as long as its creator keeps it open.
+*/
+class CSharedSection
+{
+    void*   m_hSection;    ///< platform section handle
+    int     m_iSection;    ///< shared memory descriptor, outside of Windows
+    void*   m_pView;       ///< the shared view
+    void*   m_pPrivate;    ///< the current copy-on-write view, or nullptr
+    size_t  m_cbSize;      ///< size of the views, in bytes
+    bool    m_bCreator;    ///< true if this process created the section
+    TCHAR   m_szName[64];  ///< platform name of the section
+
+public:
+    /// Default Constructor
+    CSharedSection() noexcept
+        : m_hSection(nullptr),
+          m_iSection(-1),
+          m_pView(nullptr),
+          m_pPrivate(nullptr),
+          m_cbSize(0),
+          m_bCreator(false),
+          m_szName()
+    { };
+
+    /// Destructor, unmaps and closes the section
+    ~CSharedSection() noexcept
+    { Close( ); };
+
+    CSharedSection(const CSharedSection&)            = delete;
+    CSharedSection& operator=(const CSharedSection&) = delete;
+
+/**
+  @brief  Creates a zero filled section and maps its shared view
+
+  @param [in] szName         name of the section, letters, digits and '_' only
+  @param [in] cbSize         size of the section, in bytes
+
+  @retval true               on success
+  @retval false              if the section exists or could not be created
+*/
+    bool   Create(const TCHAR* szName, size_t cbSize) noexcept;
+
+/**
+  @brief  Opens a section created by another process and maps its shared view
+
+  @param [in] szName         name given to Create
+
+  @retval true               on success
+  @retval false              if the section could not be opened
+*/
+    bool   Open(const TCHAR* szName) noexcept;
+
+/**
+  @brief  Maps a fresh copy-on-write view of the section, unmapping the
+          previous one
+
+  The view starts out as the section's contents; writes to it are private
+  to the process and discarded with the view.
+
+  @retval void*              pointing to the view, nullptr on failure
+*/
+    void*  MapPrivateView(void) noexcept;
+
+/**
+  @brief  Unmaps the views and closes the section
+*/
+    void   Close(void) noexcept;
+
+// Primitive data accessors
+/**
+  @brief  Returns the start of the shared view
+
+  @retval void*              pointing to the first byte, or nullptr
+*/
+    inline void*  get_Data(void) const noexcept
+    { return m_pView; };
+
+/**
+  @brief  Returns the size of the section
+
+  @retval size_t             containing the size in bytes
+*/
+    inline size_t get_Size(void) const noexcept
+    { return m_cbSize; };
+};
+
+/// identifies a started worker process
+typedef void* WORKER_PROCESS;
+
+/**
+  @brief  Starts a worker process
+
+  On Windows the worker is a new instance of this executable, given the
+  arguments; elsewhere it is a fork of this process, which runs fnWorker and
+  exits with its result.
+
+  @param [in]  szArgs        command line arguments of a new instance
+  @param [in]  fnWorker      body of a forked worker, returning its exit code
+  @param [out] hProcess      the worker, for WaitWorkerProcess
+
+  @retval true               on success
+  @retval false              if the process could not be started
+*/
+bool StartWorkerProcess(const TCHAR* szArgs, const std::function<int(void)>& fnWorker,
+                        WORKER_PROCESS& hProcess) noexcept;
+
+/**
+  @brief  Waits for a worker process to exit
+
+  @param [in] hProcess       the worker
+
+  @retval int                containing its exit code, -1 if it did not exit
+                             normally
+*/
+int  WaitWorkerProcess(WORKER_PROCESS hProcess) noexcept;
+
+/**
+  @brief  Returns an identifier of this process, unique among running processes
+
+  @retval unsigned long      containing the process id
+*/
+unsigned long GetCurrentProcessNumber(void) noexcept;
+
+/**
+  @brief  Removes the sections left behind by processes no longer running
+
+  A section outlives a creator killed before it could close it, outside of
+  Windows, where a section goes with its last handle.  Sections named 
+  szPrefix, then the process number of an exited process and '_', are 
+  unlinked.
+
+  @param [in] szPrefix       start of the section names
+
+  @retval size_t             containing the number of sections removed
+*/
+size_t RemoveStaleSections(const TCHAR* szPrefix) noexcept;
+
+/**
+  @brief  Retrieves the directory for temporary files
+
+  @param [out] szPath        receives the directory, with a trailing separator
+  @param [in]  cchLen        size of szPath, in characters
+
+  @retval TCHAR*             szPath on success, nullptr on failure
+*/
+TCHAR* GetTempDirectory(TCHAR* szPath, size_t cchLen) noexcept;
+
+#endif
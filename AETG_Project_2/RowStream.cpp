@@ -0,0 +1,99 @@
+/**
+ *  @file       RowStream.cpp
+ *  @brief      CRowStream class implementation
+ *  @author     Mark L. Short
+ *  @date       October 18, 2026
+ */
+
+#include "stdafx.h"
+
+#include "GenerationContext.h"
+
+#include "RowStream.h"
+
+bool
+CRowStream::Open(CGenerationContext& context, double dBudget, size_t nCapacity)
+{
+    if (m_thread.joinable())
+        return false;
+
+    m_pContext  = &context;
+    m_nCapacity = (nCapacity > 0) ? nCapacity : 1;
+    m_dqRows.clear();
+    m_bDone     = false;
+    m_bClosed   = false;
+    m_bComplete = false;
+
+    context.SetRowSink([this](const CTestCase& TestCase)
+        {
+            std::unique_lock<std::mutex> lock(m_mtxRows);
+
+            m_cvSpace.wait(lock, [this] { return m_bClosed || (m_dqRows.size() < m_nCapacity); });
+
+            if (m_bClosed)
+                return false;
+
+            m_dqRows.push_back(TestCase);
+            m_cvRows.notify_one();
+            return true;
+        });
+
+    m_thread = std::thread([this, dBudget]
+        {
+            bool bComplete = m_pContext->Generate(1, dBudget);
+
+            std::lock_guard<std::mutex> lock(m_mtxRows);
+
+            m_bDone     = true;
+            m_bComplete = bComplete;
+            m_cvRows.notify_all();
+        });
+
+    return true;
+}
+
+bool
+CRowStream::Next(CTestCase& TestCase)
+{
+    std::unique_lock<std::mutex> lock(m_mtxRows);
+
+    m_cvRows.wait(lock, [this] { return m_bClosed || m_bDone || !m_dqRows.empty(); });
+
+    if (m_bClosed || m_dqRows.empty())
+        return false;
+
+    TestCase = std::move(m_dqRows.front());
+    m_dqRows.pop_front();
+    m_cvSpace.notify_one();
+
+    return true;
+}
+
+void
+CRowStream::Close(void)
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mtxRows);
+
+        m_bClosed = true;
+        m_cvSpace.notify_all();
+        m_cvRows.notify_all();
+    }
+
+    if (m_thread.joinable())
+        m_thread.join();
+
+    if (m_pContext)
+        m_pContext->SetRowSink(ROW_SINK());
+
+    m_pContext = nullptr;
+    m_dqRows.clear();
+}
+
+bool
+CRowStream::IsComplete(void)
+{
+    std::lock_guard<std::mutex> lock(m_mtxRows);
+
+    return m_bDone && m_bComplete;
+}
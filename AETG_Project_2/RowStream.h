@@ -0,0 +1,145 @@
+/**
+ *  @file       RowStream.h
+ *  @brief      CRowStream class interface
+ *
+ *  Provides type definitions for: CRowStream
+ *
+ *  @author     Mark L. Short
+ *  @date       October 18, 2026
+ */
+#pragma once
+
+#if !defined(__ROW_STREAM_H__)
+#define __ROW_STREAM_H__
+
+#ifndef __COMMON_DEF_H__
+    #include "CommonDef.h"
+#endif
+
+#ifndef _CONDITION_VARIABLE_
+    #include <condition_variable>
+#endif
+
+#ifndef _DEQUE_
+    #include <deque>
+#endif
+
+#ifndef _MUTEX_
+    #include <mutex>
+#endif
+
+#ifndef _THREAD_
+    #include <thread>
+#endif
+
+#ifndef __TEST_CASE_H__
+    #include "TestCase.h"
+#endif
+
+// forward declaration
+class CGenerationContext;
+
+/// default number of rows generated ahead of the consumer
+constexpr const size_t DEFAULT_ROW_STREAM_CAPACITY = 64;
+
+/**
+  @brief  Pulls the rows of a suite one at a time, as they are generated
+
+  Open starts the generation of a context on a thread of its own, and Next
+  returns each row as soon as the engine accepts it, so that a test runner
+  may execute the first rows while the rest are still being generated.  The
+  generation runs at most nCapacity rows ahead of the consumer, waiting for
+  Next to catch up.
+
+  @code
+      CRowStream stream;
+      CTestCase  TestCase;
+
+      if (stream.Open(context, 0.0))
+      {
+          while (stream.Next(TestCase))
+              RunTest(TestCase);
+      }
+  @endcode
+
+  Closing the stream, or destroying it, before the last row abandons the
+  generation.  The context is not to be used by anyone else while the
+  stream is open.
+*/
+class CRowStream
+{
+    CGenerationContext*      m_pContext;    ///< context being generated
+    std::thread              m_thread;      ///< the generating thread
+    std::mutex               m_mtxRows;     ///< guards the members below
+    std::condition_variable  m_cvRows;      ///< signalled as rows arrive, or generation ends
+    std::condition_variable  m_cvSpace;     ///< signalled as rows are taken, or the stream closes
+    std::deque<CTestCase>    m_dqRows;      ///< rows generated, not yet taken
+    size_t                   m_nCapacity;   ///< most rows generated ahead of the consumer
+    bool                     m_bDone;       ///< set once generation has ended
+    bool                     m_bClosed;     ///< set once the consumer has closed the stream
+    bool                     m_bComplete;   ///< true if generation completed the suite
+
+public:
+    /// Default Constructor
+    CRowStream()
+        : m_pContext(nullptr),
+          m_thread(),
+          m_mtxRows(),
+          m_cvRows(),
+          m_cvSpace(),
+          m_dqRows(),
+          m_nCapacity(DEFAULT_ROW_STREAM_CAPACITY),
+          m_bDone(false),
+          m_bClosed(false),
+          m_bComplete(false)
+    { };
+
+    /// Destructor
+    ~CRowStream()
+    { Close(); };
+
+    CRowStream(const CRowStream&)            = delete;
+    CRowStream& operator=(const CRowStream&) = delete;
+
+/**
+  @brief  Starts generating a suite for the model of a context
+
+  @param [in] context        the context, its model and engine set up
+  @param [in] dBudget        time budget in seconds, or 0 for none
+  @param [in] nCapacity      most rows to generate ahead of the consumer
+
+  @retval true               on success
+  @retval false              if the stream is already open
+*/
+    bool   Open(CGenerationContext& context, double dBudget,
+                size_t nCapacity = DEFAULT_ROW_STREAM_CAPACITY);
+
+/**
+  @brief  Takes the next row, waiting for it to be generated
+
+  @param [out] TestCase      the row, as global levels of the model
+
+  @retval true               on success
+  @retval false              once every row has been taken, or the stream
+                             is closed
+*/
+    bool   Next(CTestCase& TestCase);
+
+/**
+  @brief  Closes the stream, abandoning the generation should it be running
+
+  The context's last error and suite describe the generation afterward.
+*/
+    void   Close(void);
+
+/**
+  @brief  Indicates whether generation completed the suite
+
+  Meaningful once Next has returned false.
+
+  @retval bool               true if every row of a complete suite was streamed
+*/
+    bool   IsComplete(void);
+};
+
+#endif
@@ -0,0 +1,440 @@
+/**
+ *  @file       ServiceHost.cpp
+ *  @brief      Local endpoint of the generation service
+ *  @author     Mark L. Short
+ *  @date       October 18, 2026
+ */
+
+#include "stdafx.h"
+
+#if defined(_WIN32)
+    #include <Windows.h>
+#else
+    #include <sys/socket.h>
+    #include <sys/stat.h>
+    #include <sys/un.h>
+    #include <unistd.h>
+    #include <cerrno>
+#endif
+
+#include <algorithm>
+#include <atomic>
+#include <list>
+#include <mutex>
+#include <thread>
+
+#include "ServiceHost.h"
+
+#if defined(_WIN32)
+    typedef HANDLE CHANNEL;                                ///< a connected client
+    static const CHANNEL CHANNEL_INVALID = INVALID_HANDLE_VALUE;
+#else
+    typedef int    CHANNEL;                                ///< a connected client
+    static const CHANNEL CHANNEL_INVALID = -1;
+#endif
+
+/**
+  @brief  The listening side of the endpoint
+*/
+struct SERVICE_LISTENER
+{
+    tstring  strName;     ///< full pipe name, or socket path
+    CHANNEL  hListen;     ///< the pipe instance awaiting a client, or the listening socket
+};
+
+/**
+  @brief  A client being served
+*/
+struct SERVICE_CLIENT
+{
+    CHANNEL            hChannel;   ///< the connection, CHANNEL_INVALID once closed
+    std::thread        thread;     ///< the thread serving it
+    std::atomic<bool>  bDone;      ///< set once the thread no longer needs joining to finish
+};
+
+#if defined(_WIN32)
+
+/**
+  @brief  Creates a pipe instance for the next client
+*/
+static HANDLE CreatePipeInstance(const tstring& strName, bool bFirst) noexcept
+{
+    return CreateNamedPipe(strName.c_str(),
+                           PIPE_ACCESS_DUPLEX | (bFirst ? FILE_FLAG_FIRST_PIPE_INSTANCE : 0),
+                           PIPE_TYPE_BYTE | PIPE_READMODE_BYTE | PIPE_WAIT | PIPE_REJECT_REMOTE_CLIENTS,
+                           PIPE_UNLIMITED_INSTANCES, 64 * 1024, 64 * 1024, 0, nullptr);
+}
+
+static bool OpenListener(const TCHAR* szEndpoint, SERVICE_LISTENER& listener, bool& bInUse)
+{
+    listener.strName = szEndpoint;
+
+    if (listener.strName.compare(0, 2, _T("\\\\")) != 0)
+        listener.strName = _T("\\\\.\\pipe\\") + listener.strName;
+
+    // the first instance fails should another process own the name
+    listener.hListen = CreatePipeInstance(listener.strName, true);
+    bInUse           = (listener.hListen == CHANNEL_INVALID) && (GetLastError() == ERROR_ACCESS_DENIED);
+
+    return listener.hListen != CHANNEL_INVALID;
+}
+
+static CHANNEL AcceptClient(SERVICE_LISTENER& listener)
+{
+    CHANNEL hClient = listener.hListen;
+
+    if ((ConnectNamedPipe(hClient, nullptr) == FALSE) && (GetLastError() != ERROR_PIPE_CONNECTED))
+        DisconnectNamedPipe(hClient);       // the client gave up, the instance is reused
+    else
+        listener.hListen = CreatePipeInstance(listener.strName, false);
+
+    return (hClient != listener.hListen) ? hClient : CHANNEL_INVALID;
+}
+
+static void WakeListener(const SERVICE_LISTENER& listener) noexcept
+{
+    HANDLE hPipe = CreateFile(listener.strName.c_str(), GENERIC_READ | GENERIC_WRITE, 0, nullptr,
+                              OPEN_EXISTING, 0, nullptr);
+
+    if (hPipe != INVALID_HANDLE_VALUE)
+        CloseHandle(hPipe);
+}
+
+static void CloseListener(SERVICE_LISTENER& listener) noexcept
+{
+    if (listener.hListen != CHANNEL_INVALID)
+        CloseHandle(listener.hListen);
+
+    listener.hListen = CHANNEL_INVALID;
+}
+
+static void InterruptChannel(CHANNEL hChannel) noexcept
+{
+    CancelIoEx(hChannel, nullptr);
+    DisconnectNamedPipe(hChannel);
+}
+
+static void CloseChannel(CHANNEL hChannel) noexcept
+{
+    FlushFileBuffers(hChannel);
+    DisconnectNamedPipe(hChannel);
+    CloseHandle(hChannel);
+}
+
+static bool ReadExact(CHANNEL hChannel, void* pBuffer, size_t cbSize) noexcept
+{
+    char* p = static_cast<char*>(pBuffer);
+
+    while (cbSize > 0)
+    {
+        DWORD cbRead = 0;
+
+        if (!ReadFile(hChannel, p, static_cast<DWORD>(std::min<size_t>(cbSize, 1 << 20)), &cbRead, nullptr) ||
+            (cbRead == 0))
+            return false;
+
+        p      += cbRead;
+        cbSize -= cbRead;
+    }
+
+    return true;
+}
+
+static bool WriteExact(CHANNEL hChannel, const void* pBuffer, size_t cbSize) noexcept
+{
+    const char* p = static_cast<const char*>(pBuffer);
+
+    while (cbSize > 0)
+    {
+        DWORD cbWritten = 0;
+
+        if (!WriteFile(hChannel, p, static_cast<DWORD>(std::min<size_t>(cbSize, 1 << 20)), &cbWritten, nullptr) ||
+            (cbWritten == 0))
+            return false;
+
+        p      += cbWritten;
+        cbSize -= cbWritten;
+    }
+
+    return true;
+}
+
+#else
+
+static bool OpenListener(const TCHAR* szEndpoint, SERVICE_LISTENER& listener, bool& bInUse)
+{
+    struct sockaddr_un addr = { };
+    struct stat        st   = { };
+
+    listener.strName = szEndpoint;
+    listener.hListen = CHANNEL_INVALID;
+    bInUse           = false;
+
+    if (listener.strName.size() >= sizeof(addr.sun_path))
+        return false;
+
+    addr.sun_family = AF_UNIX;
+    listener.strName.copy(addr.sun_path, sizeof(addr.sun_path) - 1);
+
+    // a socket left behind by a previous instance is replaced, though not one 
+    // another instance still listens on, nor anything which isn't a socket
+    if (lstat(szEndpoint, &st) == 0)
+    {
+        if (S_ISSOCK(st.st_mode) == false)
+            return false;
+
+        int iSocket = socket(AF_UNIX, SOCK_STREAM, 0);
+
+        if (iSocket < 0)
+            return false;
+
+        int iResult = connect(iSocket, reinterpret_cast<struct sockaddr*>(&addr), sizeof(addr));
+        int iError  = errno;
+        close(iSocket);
+
+        if ((iResult != 0) && (iError != ECONNREFUSED))
+            return false;
+
+        bInUse = (iResult == 0);
+
+        if (bInUse)
+            return false;
+
+        unlink(szEndpoint);
+    }
+
+    listener.hListen = socket(AF_UNIX, SOCK_STREAM, 0);
+
+    if ((listener.hListen < 0) ||
+        (bind(listener.hListen, reinterpret_cast<struct sockaddr*>(&addr), sizeof(addr)) != 0) ||
+        (chmod(szEndpoint, S_IRUSR | S_IWUSR) != 0) ||
+        (listen(listener.hListen, SOMAXCONN) != 0))
+    {
+        if (listener.hListen >= 0)
+            close(listener.hListen);
+
+        listener.hListen = CHANNEL_INVALID;
+        return false;
+    }
+
+    return true;
+}
+
+static CHANNEL AcceptClient(SERVICE_LISTENER& listener)
+{
+    return accept(listener.hListen, nullptr, nullptr);
+}
+
+static void WakeListener(const SERVICE_LISTENER& listener) noexcept
+{
+    struct sockaddr_un addr = { };
+
+    addr.sun_family = AF_UNIX;
+    listener.strName.copy(addr.sun_path, sizeof(addr.sun_path) - 1);
+
+    int iSocket = socket(AF_UNIX, SOCK_STREAM, 0);
+
+    if (iSocket >= 0)
+    {
+        connect(iSocket, reinterpret_cast<struct sockaddr*>(&addr), sizeof(addr));
+        close(iSocket);
+    }
+}
+
+static void CloseListener(SERVICE_LISTENER& listener) noexcept
+{
+    if (listener.hListen != CHANNEL_INVALID)
+    {
+        close(listener.hListen);
+        unlink(listener.strName.c_str());
+    }
+
+    listener.hListen = CHANNEL_INVALID;
+}
+
+static void InterruptChannel(CHANNEL hChannel) noexcept
+{
+    shutdown(hChannel, SHUT_RDWR);
+}
+
+static void CloseChannel(CHANNEL hChannel) noexcept
+{
+    close(hChannel);
+}
+
+static bool ReadExact(CHANNEL hChannel, void* pBuffer, size_t cbSize) noexcept
+{
+    char* p = static_cast<char*>(pBuffer);
+
+    while (cbSize > 0)
+    {
+        ssize_t cbRead = recv(hChannel, p, cbSize, 0);
+
+        if ((cbRead < 0) && (errno == EINTR))
+            continue;
+
+        if (cbRead <= 0)
+            return false;
+
+        p      += cbRead;
+        cbSize -= static_cast<size_t>(cbRead);
+    }
+
+    return true;
+}
+
+static bool WriteExact(CHANNEL hChannel, const void* pBuffer, size_t cbSize) noexcept
+{
+#if defined(MSG_NOSIGNAL)
+    const int iFlags = MSG_NOSIGNAL;    // a departed client is an error, not a signal
+#else
+    const int iFlags = 0;
+#endif
+    const char* p = static_cast<const char*>(pBuffer);
+
+    while (cbSize > 0)
+    {
+        ssize_t cbWritten = send(hChannel, p, cbSize, iFlags);
+
+        if ((cbWritten < 0) && (errno == EINTR))
+            continue;
+
+        if (cbWritten <= 0)
+            return false;
+
+        p      += cbWritten;
+        cbSize -= static_cast<size_t>(cbWritten);
+    }
+
+    return true;
+}
+
+#endif
+
+/**
+  @brief  Reads a length prefixed frame
+*/
+static bool ReadFrame(CHANNEL hChannel, std::string& strPayload)
+{
+    unsigned char rgLength[4] = { 0 };
+
+    if (ReadExact(hChannel, rgLength, sizeof(rgLength)) == false)
+        return false;
+
+    size_t cbSize = static_cast<size_t>(rgLength[0])         | (static_cast<size_t>(rgLength[1]) << 8) |
+                    (static_cast<size_t>(rgLength[2]) << 16) | (static_cast<size_t>(rgLength[3]) << 24);
+
+    if (cbSize > MAX_SERVICE_FRAME)
+        return false;
+
+    strPayload.resize(cbSize);
+
+    return (cbSize == 0) || ReadExact(hChannel, &strPayload[0], cbSize);
+}
+
+/**
+  @brief  Writes a length prefixed frame
+*/
+static bool WriteFrame(CHANNEL hChannel, const std::string& strPayload)
+{
+    size_t        cbSize      = strPayload.size();
+    unsigned char rgLength[4] = { static_cast<unsigned char>(cbSize),
+                                  static_cast<unsigned char>(cbSize >> 8),
+                                  static_cast<unsigned char>(cbSize >> 16),
+                                  static_cast<unsigned char>(cbSize >> 24) };
+
+    return (cbSize <= MAX_SERVICE_FRAME) &&
+           WriteExact(hChannel, rgLength, sizeof(rgLength)) &&
+           WriteExact(hChannel, strPayload.data(), cbSize);
+}
+
+int RunServiceHost(const TCHAR* szEndpoint, const SERVICE_HANDLER& fnHandler)
+{
+    SERVICE_LISTENER          listener;
+    std::atomic<bool>         bStop(false);
+    std::mutex                mtxClients;
+    std::list<SERVICE_CLIENT> lstClients;
+    bool                      bInUse = false;
+
+    if (OpenListener(szEndpoint, listener, bInUse) == false)
+        return bInUse ? 3 : 2;
+
+    while (!bStop)
+    {
+        CHANNEL hClient = AcceptClient(listener);
+
+        if (hClient == CHANNEL_INVALID)
+        {
+            if (listener.hListen == CHANNEL_INVALID)
+                break;                  // no further pipe instance could be created
+            continue;
+        }
+
+        if (bStop)
+        {
+            CloseChannel(hClient);      // the connection which woke us
+            break;
+        }
+
+        std::lock_guard<std::mutex> lock(mtxClients);
+
+        // threads which have finished are reaped as new clients arrive
+        for (auto it = lstClients.begin(); it != lstClients.end(); )
+        {
+            if (it->bDone)
+            {
+                it->thread.join();
+                it = lstClients.erase(it);
+            }
+            else
+            {
+                ++it;
+            }
+        }
+
+        lstClients.emplace_back();
+
+        SERVICE_CLIENT& client = lstClients.back();
+        client.hChannel = hClient;
+        client.bDone    = false;
+        client.thread   = std::thread([&, hClient, pClient = &client]
+            {
+                std::string strRequest;
+                std::string strResponse;
+
+                while (!bStop && ReadFrame(hClient, strRequest))
+                {
+                    bool bContinue = fnHandler(strRequest, strResponse);
+
+                    if (WriteFrame(hClient, strResponse) == false)
+                        break;
+
+                    if ((bContinue == false) && (bStop.exchange(true) == false))
+                        WakeListener(listener);
+                }
+
+                std::lock_guard<std::mutex> lockClose(mtxClients);
+
+                CloseChannel(hClient);
+                pClient->hChannel = CHANNEL_INVALID;
+                pClient->bDone    = true;
+            });
+    }
+
+    // clients still connected are cut off, so their threads can be joined
+    {
+        std::lock_guard<std::mutex> lock(mtxClients);
+
+        for (auto& it : lstClients)
+        {
+            if (it.hChannel != CHANNEL_INVALID)
+                InterruptChannel(it.hChannel);
+        }
+    }
+
+    for (auto& it : lstClients)
+        it.thread.join();
+
+    CloseListener(listener);
+    return 0;
+}
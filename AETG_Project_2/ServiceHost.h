@@ -0,0 +1,55 @@
+/**
+ *  @file       ServiceHost.h
+ *  @brief      Local endpoint of the generation service
+ *
+ *  The implementation is kept apart from CommonDef.h, whose fixed width
+ *  typedefs conflict with those of Windows.h, so the interface only exposes
+ *  standard types.
+ *
+ *  @author     Mark L. Short
+ *  @date       October 18, 2026
+ */
+#pragma once
+
+#if !defined(__SERVICE_HOST_H__)
+#define __SERVICE_HOST_H__
+
+#ifndef _FUNCTIONAL_
+    #include <functional>
+#endif
+
+#ifndef _STRING_
+    #include <string>
+#endif
+
+/// largest frame accepted from a client, in bytes
+constexpr const size_t MAX_SERVICE_FRAME = 256 * 1024 * 1024;
+
+/**
+  @brief  Signature of a service request handler
+
+  Receives the payload of a request frame and fills in the payload of the
+  response frame, returning false once the service is to stop.
+*/
+typedef std::function<bool(const std::string& strRequest, std::string& strResponse)> SERVICE_HANDLER;
+
+/**
+  @brief  Serves requests on a local endpoint until the handler stops it
+
+  The endpoint is a named pipe on Windows, given by name or in full as
+  \\\\.\\pipe\\name, which refuses remote clients, and elsewhere a Unix
+  domain socket, given by path, accessible only to the current user.  Each
+  client is served on its own thread and may send any number of requests,
+  each frame being a 4 byte little endian payload length followed by the
+  payload.  Responses are framed the same way and sent in request order.
+
+  @param [in] szEndpoint     the pipe name or socket path
+  @param [in] fnHandler      the request handler, called concurrently
+
+  @retval int                0 once stopped by the handler, 2 if the
+                             endpoint could not be created, 3 if another
+                             process already serves it
+*/
+int RunServiceHost(const TCHAR* szEndpoint, const SERVICE_HANDLER& fnHandler);
+
+#endif
@@ -0,0 +1,232 @@
+/**
+ *  @file       ShardFile.cpp
+ *  @brief      CShardFile class implementation
+ *  @author     Mark L. Short
+ *  @date       October 18, 2026
+ */
+
+#include "stdafx.h"
+
+#if defined(_WIN32)
+    #include <Windows.h>
+#else
+    #include <fcntl.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <unistd.h>
+    #include <cstdlib>
+    #include <cstring>
+#endif
+
+#include "ShardFile.h"
+
+bool
+CShardFile::Create(const TCHAR* szDirectory, const std::vector<size_t>& rgShardSize)
+{
+    Close( );
+
+    size_t nGranularity = GetAllocationGranularity( );
+    size_t cbFile       = 0;
+
+    // every shard starts on a boundary a view may be mapped from
+    for (size_t cbShard : rgShardSize)
+    {
+        m_rgOffsets.push_back(cbFile);
+        m_rgSizes.push_back(cbShard);
+
+        cbFile += (cbShard + nGranularity - 1) / nGranularity * nGranularity;
+    }
+
+    m_rgViews.assign(rgShardSize.size(), nullptr);
+
+    if (cbFile == 0)
+    {
+        Close( );
+        return false;
+    }
+
+#if defined(_WIN32)
+    TCHAR szDir [_MAX_PATH] = { 0 };
+    TCHAR szPath[_MAX_PATH] = { 0 };
+
+    if ((szDirectory == nullptr) || (*szDirectory == _T('\0')))
+    {
+        if (GetTempPath(_countof(szDir), szDir) == 0)
+        {
+            Close( );
+            return false;
+        }
+        szDirectory = szDir;
+    }
+
+    // a temporary file is kept in the cache as long as memory allows, and
+    // goes with its last handle
+    HANDLE hFile = INVALID_HANDLE_VALUE;
+
+    if (GetTempFileName(szDirectory, _T("AET"), 0, szPath))
+        hFile = CreateFile(szPath, GENERIC_READ | GENERIC_WRITE, 0, nullptr, CREATE_ALWAYS,
+                           FILE_ATTRIBUTE_TEMPORARY | FILE_FLAG_DELETE_ON_CLOSE, nullptr);
+
+    if (hFile == INVALID_HANDLE_VALUE)
+    {
+        Close( );
+        return false;
+    }
+
+    ULARGE_INTEGER uliSize;
+    uliSize.QuadPart = cbFile;
+
+    m_hFile    = hFile;
+    m_hMapping = CreateFileMapping(hFile, nullptr, PAGE_READWRITE, uliSize.HighPart, uliSize.LowPart, nullptr);
+
+    if (m_hMapping == nullptr)
+    {
+        Close( );
+        return false;
+    }
+#else
+    std::string strPath = ((szDirectory == nullptr) || (*szDirectory == '\0'))
+                              ? std::string(getenv("TMPDIR") ? getenv("TMPDIR") : "/tmp")
+                              : std::string(szDirectory);
+
+    if (strPath.empty() || (strPath.back() != '/'))
+        strPath += '/';
+
+    strPath += "AETG_XXXXXX";
+
+    m_iFile = mkstemp(&strPath[0]);
+
+    if (m_iFile < 0)
+    {
+        Close( );
+        return false;
+    }
+
+    // the file lasts as long as its descriptor and views
+    unlink(strPath.c_str());
+
+    if (ftruncate(m_iFile, static_cast<off_t>(cbFile)) != 0)
+    {
+        Close( );
+        return false;
+    }
+#endif
+
+    return true;
+}
+
+void*
+CShardFile::Map(size_t nShard) noexcept
+{
+    if ((nShard >= m_rgViews.size()) || m_rgViews[nShard])
+        return (nShard < m_rgViews.size()) ? m_rgViews[nShard] : nullptr;
+
+#if defined(_WIN32)
+    ULARGE_INTEGER uliOffset;
+    uliOffset.QuadPart = m_rgOffsets[nShard];
+
+    m_rgViews[nShard] = MapViewOfFile(m_hMapping, FILE_MAP_ALL_ACCESS, uliOffset.HighPart,
+                                      uliOffset.LowPart, m_rgSizes[nShard]);
+#else
+    void* pView = mmap(nullptr, m_rgSizes[nShard], PROT_READ | PROT_WRITE, MAP_SHARED,
+                       m_iFile, static_cast<off_t>(m_rgOffsets[nShard]));
+
+    if (pView != MAP_FAILED)
+    {
+        // passes over the bitmap run in rank order, so read ahead
+        madvise(pView, m_rgSizes[nShard], MADV_SEQUENTIAL);
+        m_rgViews[nShard] = pView;
+    }
+#endif
+
+    return m_rgViews[nShard];
+}
+
+void
+CShardFile::Release(size_t nShard) noexcept
+{
+    if ((nShard >= m_rgViews.size()) || (m_rgViews[nShard] == nullptr))
+        return;
+
+#if defined(_WIN32)
+    // the pages of a temporary file are seldom written back before it goes
+    UnmapViewOfFile(m_rgViews[nShard]);
+#else
+    // free the blocks behind the shard where the file system allows, and
+    // otherwise just drop the pages
+  #if defined(MADV_REMOVE)
+    if (madvise(m_rgViews[nShard], m_rgSizes[nShard], MADV_REMOVE) != 0)
+  #endif
+        madvise(m_rgViews[nShard], m_rgSizes[nShard], MADV_DONTNEED);
+
+    munmap(m_rgViews[nShard], m_rgSizes[nShard]);
+#endif
+
+    m_rgViews[nShard] = nullptr;
+}
+
+void
+CShardFile::Close(void) noexcept
+{
+    for (size_t nShard = 0; nShard < m_rgViews.size(); nShard++)
+    {
+        if (m_rgViews[nShard] == nullptr)
+            continue;
+
+#if defined(_WIN32)
+        UnmapViewOfFile(m_rgViews[nShard]);
+#else
+        munmap(m_rgViews[nShard], m_rgSizes[nShard]);
+#endif
+    }
+
+#if defined(_WIN32)
+    if (m_hMapping)
+        CloseHandle(m_hMapping);
+
+    if (m_hFile)
+        CloseHandle(m_hFile);
+#else
+    if (m_iFile >= 0)
+        close(m_iFile);
+#endif
+
+    m_hFile    = nullptr;
+    m_hMapping = nullptr;
+    m_iFile    = -1;
+
+    m_rgOffsets.clear( );
+    m_rgSizes.clear( );
+    m_rgViews.clear( );
+}
+
+size_t
+CShardFile::GetAllocationGranularity(void) noexcept
+{
+#if defined(_WIN32)
+    SYSTEM_INFO si = { 0 };
+    GetSystemInfo(&si);
+
+    return si.dwAllocationGranularity;
+#else
+    long nPageSize = sysconf(_SC_PAGESIZE);
+
+    return (nPageSize > 0) ? static_cast<size_t>(nPageSize) : 4096;
+#endif
+}
+
+unsigned long long GetPhysicalMemorySize(void) noexcept
+{
+#if defined(_WIN32)
+    MEMORYSTATUSEX msx = { sizeof(msx) };
+
+    return GlobalMemoryStatusEx(&msx) ? msx.ullTotalPhys : 0;
+#else
+    long nPages    = sysconf(_SC_PHYS_PAGES);
+    long nPageSize = sysconf(_SC_PAGESIZE);
+
+    return ((nPages > 0) && (nPageSize > 0))
+                ? static_cast<unsigned long long>(nPages) * static_cast<unsigned long long>(nPageSize)
+                : 0;
+#endif
+}
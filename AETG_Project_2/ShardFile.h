@@ -0,0 +1,129 @@
+/**
+ *  @file       ShardFile.h
+ *  @brief      CShardFile class interface
+ *
+ *  Provides type definitions for: CShardFile
+ *
+ *  The implementation is kept apart from CommonDef.h, whose fixed width
+ *  typedefs conflict with those of Windows.h, so the interface only exposes
+ *  standard types.
+ *
+ *  @author     Mark L. Short
+ *  @date       October 18, 2026
+ */
+#pragma once
+
+#if !defined(__SHARD_FILE_H__)
+#define __SHARD_FILE_H__
+
+#ifndef _CSTDDEF_
+    #include <cstddef>
+#endif
+
+#ifndef _VECTOR_
+    #include <vector>
+#endif
+
+/**
+  @brief  A temporary file mapped as a sequence of separately mapped shards
+
+  Each shard starts on an allocation granularity boundary of the file and is
+  mapped as a view of its own, so that a shard no longer of interest can be
+  unmapped, dropping its pages from the working set, while the others stay
+  mapped.  The views are shared, read-write views of the file, whose pages
+  the system writes back and reads in as memory requires, so the file may be
+  far larger than the physical memory.  The file is deleted once closed.
+*/
+class CShardFile
+{
+    void*                 m_hFile;        ///< platform file handle
+    void*                 m_hMapping;     ///< platform file mapping handle
+    int                   m_iFile;        ///< file descriptor, outside of Windows
+    std::vector<size_t>   m_rgOffsets;    ///< file offset of each shard, in bytes
+    std::vector<size_t>   m_rgSizes;      ///< size of each shard, in bytes
+    std::vector<void*>    m_rgViews;      ///< view of each shard, or nullptr
+
+public:
+    /// Default Constructor
+    CShardFile() noexcept
+        : m_hFile(nullptr),
+          m_hMapping(nullptr),
+          m_iFile(-1),
+          m_rgOffsets(),
+          m_rgSizes(),
+          m_rgViews()
+    { };
+
+    /// Destructor, unmaps the shards and deletes the file
+    ~CShardFile() noexcept
+    { Close( ); };
+
+    CShardFile(const CShardFile&)            = delete;
+    CShardFile& operator=(const CShardFile&) = delete;
+
+/**
+  @brief  Creates a zero filled temporary file holding the shards
+
+  No shard is mapped until Map is called for it.
+
+  @param [in] szDirectory    directory of the file, or nullptr for the
+                             temporary directory
+  @param [in] rgShardSize    size of each shard, in bytes
+
+  @retval true               on success
+  @retval false              if the file could not be created or sized
+*/
+    bool   Create(const TCHAR* szDirectory, const std::vector<size_t>& rgShardSize);
+
+/**
+  @brief  Maps a shard, should it not be mapped already
+
+  The system is advised the shard will be read in rank order.
+
+  @param [in] nShard         the shard
+
+  @retval void*              pointing to the shard, nullptr on failure
+*/
+    void*  Map(size_t nShard) noexcept;
+
+/**
+  @brief  Unmaps a shard, its contents no longer being of interest
+
+  The pages are dropped from the working set, and may be neither written
+  back nor read in again; a shard mapped again after being released holds
+  undefined contents.
+
+  @param [in] nShard         the shard
+*/
+    void   Release(size_t nShard) noexcept;
+
+/**
+  @brief  Unmaps the shards and deletes the file
+*/
+    void   Close(void) noexcept;
+
+// Primitive data accessors
+/**
+  @brief  Returns the number of shards
+
+  @retval size_t             containing the number of shards
+*/
+    inline size_t get_NumShards(void) const noexcept
+    { return m_rgSizes.size(); };
+
+/**
+  @brief  Returns the alignment of the shards within the file
+
+  @retval size_t             containing the allocation granularity, in bytes
+*/
+    static size_t GetAllocationGranularity(void) noexcept;
+};
+
+/**
+  @brief  Returns the amount of physical memory installed
+
+  @retval unsigned long long containing the size in bytes, 0 if unknown
+*/
+unsigned long long GetPhysicalMemorySize(void) noexcept;
+
+#endif
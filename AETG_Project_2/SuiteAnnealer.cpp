@@ -0,0 +1,382 @@
+/**
+ *  @file       SuiteAnnealer.cpp
+ *  @brief      CSuiteAnnealer class implementation
+ *  @author     Mark L. Short
+ *  @date       October 18, 2026
+ */
+
+#include "stdafx.h"
+
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <mutex>
+#include <random>
+#include <unordered_map>
+#include "ComponentSystem.h"
+#include "MathUtility.h"
+#include "ParallelUtility.h"
+
+#include "SuiteAnnealer.h"
+
+/// temperature at the start of every cooling cycle
+constexpr const double ANNEAL_TEMP_START   = 0.5;
+
+/// temperature at which the chain is reheated
+constexpr const double ANNEAL_TEMP_END     = 0.01;
+
+/// geometric cooling factor, applied after every move
+constexpr const double ANNEAL_COOLING      = 0.9995;
+
+/// probability of a move targeting the test case that best matches the tuple
+constexpr const double ANNEAL_GUIDED_MOVE  = 0.7;
+
+/// number of moves between checks of the deadline and the other chains
+constexpr const size_t ANNEAL_POLL_MASK    = 0x3FF;
+
+typedef std::chrono::steady_clock CLOCK;
+
+/**
+  @brief  A single simulated annealing chain
+
+  The chain owns a private copy of the test cases and their coverage counts,
+  along with an indexed set of the uncovered tuple positions, so a random 
+  uncovered tuple can be drawn and updated in constant time.
+*/
+class CAnnealingChain
+{
+    const CComponentSystem&           m_System;      ///< target component system
+    CCoverageCount                    m_cntTuples;   ///< coverage multiplicity of m_rgRows
+    std::vector<CTestCase>            m_rgRows;      ///< the working test cases
+    std::vector<size_t>               m_rgUncovered; ///< positions of the uncovered tuples
+    std::unordered_map<size_t,size_t> m_mapUncovered;///< uncovered position to m_rgUncovered index
+    std::mt19937                      m_mt;          ///< the chain's random stream
+
+public:
+    CAnnealingChain(const CComponentSystem& system, const CCoverageCount& cntTemplate,
+                    const std::vector<CTestCase>& rgRows, unsigned int nSeed)
+        : m_System(system),
+          m_cntTuples(cntTemplate),
+          m_rgRows(rgRows),
+          m_rgUncovered(),
+          m_mapUncovered(),
+          m_mt(nSeed)
+    {
+        for (auto& it : m_rgRows)
+            m_cntTuples.Add(it);
+    };
+
+/**
+  @brief  Drops the test case covering the fewest tuples uniquely
+*/
+    void   DropWeakestRow(void);
+
+/**
+  @brief  Anneals until every tuple is covered
+
+  @param [in] bStop          set when the chain should be abandoned
+  @param [in] tpDeadline     time at which the chain is abandoned
+
+  @retval true               if the test cases are coverage complete
+  @retval false              if the chain was abandoned
+*/
+    bool   Run(const std::atomic<bool>& bStop, CLOCK::time_point tpDeadline);
+
+/**
+  @brief  Returns the working test cases
+*/
+    const std::vector<CTestCase>& get_Rows(void) const noexcept
+    { return m_rgRows; };
+
+private:
+/**
+  @brief  Adds a tuple position to the uncovered set
+*/
+    void   MarkUncovered(size_t nPos);
+
+/**
+  @brief  Removes a tuple position from the uncovered set
+*/
+    void   MarkCovered  (size_t nPos);
+
+/**
+  @brief  Calculates the change in the number of uncovered tuples were a 
+          test case cell to be assigned a new level
+
+  @param [in] TestCase       target CTestCase object, restored on return
+  @param [in] nFactor        factor of the cell
+  @param [in] nLevel         the new level, different from the current one
+
+  @retval long               containing the change in uncovered tuples
+*/
+    long   CalcFlipDelta(CTestCase& TestCase, FACTOR_T nFactor, LEVEL_T nLevel) const;
+
+/**
+  @brief  Assigns a test case cell a new level, updating the coverage counts
+
+  @param [in,out] TestCase   target CTestCase object
+  @param [in]     nFactor    factor of the cell
+  @param [in]     nLevel     the new level, different from the current one
+*/
+    void   Flip         (CTestCase& TestCase, FACTOR_T nFactor, LEVEL_T nLevel);
+};
+
+void
+CAnnealingChain::MarkUncovered(size_t nPos)
+{
+    m_mapUncovered[nPos] = m_rgUncovered.size();
+    m_rgUncovered.push_back(nPos);
+}
+
+void
+CAnnealingChain::MarkCovered(size_t nPos)
+{
+    auto it = m_mapUncovered.find(nPos);
+
+    if (it != m_mapUncovered.end())
+    {
+        // swap the last entry into the vacated slot
+        size_t nIndex = it->second;
+        size_t nLast  = m_rgUncovered.back();
+
+        m_rgUncovered[nIndex]  = nLast;
+        m_mapUncovered[nLast]  = nIndex;
+        m_rgUncovered.pop_back();
+        m_mapUncovered.erase(nPos);
+    }
+}
+
+void
+CAnnealingChain::DropWeakestRow(void)
+{
+    WORD     nT          = m_cntTuples.get_T( );
+    FACTOR_T nNumFactors = m_cntTuples.get_NumFactors( );
+    FACTOR_T rgColumns[MAX_T_WAY];
+
+    size_t nWeakest   = 0;
+    size_t nMinUnique = std::numeric_limits<size_t>::max();
+
+    for (size_t nRow = 0; nRow < m_rgRows.size(); nRow++)
+    {
+        size_t nUnique = 0;
+
+        CTupleSpace::ResetColumns(rgColumns, nT);
+        do
+        {
+            size_t nPos = 0;
+            if (m_cntTuples.GetTuplePos(rgColumns, m_rgRows[nRow], nPos) && 
+                (m_cntTuples.GetCount(nPos) == 1))
+                nUnique++;
+        } while (NextCombination(rgColumns, nT, nNumFactors));
+
+        if (nUnique < nMinUnique)
+        {
+            nMinUnique = nUnique;
+            nWeakest   = nRow;
+        }
+    }
+
+    CTupleSpace::ResetColumns(rgColumns, nT);
+    do
+    {
+        size_t nPos = 0;
+        if (m_cntTuples.GetTuplePos(rgColumns, m_rgRows[nWeakest], nPos) && 
+            (m_cntTuples.Decrement(nPos) == 0))
+            MarkUncovered(nPos);
+    } while (NextCombination(rgColumns, nT, nNumFactors));
+
+    m_rgRows.erase(m_rgRows.begin() + nWeakest);
+}
+
+long
+CAnnealingChain::CalcFlipDelta(CTestCase& TestCase, FACTOR_T nFactor, LEVEL_T nLevel) const
+{
+    long    lResult  = 0;
+    LEVEL_T nCurrent = TestCase[nFactor];
+
+    m_cntTuples.ForEachCombination(nFactor, [&](const FACTOR_T* rgColumns)
+        {
+            size_t nPos = 0;
+
+            if (m_cntTuples.GetTuplePos(rgColumns, TestCase, nPos) && 
+                (m_cntTuples.GetCount(nPos) == 1))
+                lResult++;
+
+            TestCase[nFactor] = nLevel;
+            if (m_cntTuples.GetTuplePos(rgColumns, TestCase, nPos) && 
+                (m_cntTuples.GetCount(nPos) == 0))
+                lResult--;
+            TestCase[nFactor] = nCurrent;
+        });
+
+    return lResult;
+}
+
+void
+CAnnealingChain::Flip(CTestCase& TestCase, FACTOR_T nFactor, LEVEL_T nLevel)
+{
+    LEVEL_T nCurrent = TestCase[nFactor];
+
+    m_cntTuples.ForEachCombination(nFactor, [&](const FACTOR_T* rgColumns)
+        {
+            size_t nPos = 0;
+
+            if (m_cntTuples.GetTuplePos(rgColumns, TestCase, nPos) && 
+                (m_cntTuples.Decrement(nPos) == 0))
+                MarkUncovered(nPos);
+
+            TestCase[nFactor] = nLevel;
+            if (m_cntTuples.GetTuplePos(rgColumns, TestCase, nPos) && 
+                (m_cntTuples.Increment(nPos) == 1))
+                MarkCovered(nPos);
+            TestCase[nFactor] = nCurrent;
+        });
+
+    TestCase[nFactor] = nLevel;
+}
+
+bool
+CAnnealingChain::Run(const std::atomic<bool>& bStop, CLOCK::time_point tpDeadline)
+{
+    WORD   nT        = m_cntTuples.get_T( );
+    double dTemp     = ANNEAL_TEMP_START;
+    size_t nNumMoves = 0;
+
+    std::uniform_real_distribution<double> distProb(0.0, 1.0);
+    std::vector<size_t>                    rgMatches;
+
+    FACTOR_T rgColumns[MAX_T_WAY];
+    LEVEL_T  rgLevels [MAX_T_WAY];
+    WORD     rgMismatch[MAX_T_WAY];
+
+    while (!m_rgUncovered.empty())
+    {
+        if (((++nNumMoves & ANNEAL_POLL_MASK) == 0) && 
+            (bStop || (CLOCK::now() >= tpDeadline)))
+            return false;
+
+        size_t nPos = m_rgUncovered[std::uniform_int_distribution<size_t>(0, m_rgUncovered.size() - 1)(m_mt)];
+        m_cntTuples.GetTuple(nPos, rgColumns, rgLevels);
+
+        // either the test case agreeing with the tuple in the most columns,
+        // or any test case at all
+        size_t nRow = std::uniform_int_distribution<size_t>(0, m_rgRows.size() - 1)(m_mt);
+
+        if (distProb(m_mt) < ANNEAL_GUIDED_MOVE)
+        {
+            WORD nBestMatch = 0;
+
+            rgMatches.clear();
+            for (size_t i = 0; i < m_rgRows.size(); i++)
+            {
+                WORD nMatch = 0;
+                for (WORD j = 0; j < nT; j++)
+                {
+                    if (m_rgRows[i][rgColumns[j]] == rgLevels[j])
+                        nMatch++;
+                }
+
+                if (nMatch > nBestMatch)
+                {
+                    nBestMatch = nMatch;
+                    rgMatches.clear();
+                }
+                if (nMatch == nBestMatch)
+                    rgMatches.push_back(i);
+            }
+            nRow = rgMatches[std::uniform_int_distribution<size_t>(0, rgMatches.size() - 1)(m_mt)];
+        }
+
+        CTestCase& TestCase    = m_rgRows[nRow];
+        WORD       nMismatches = 0;
+
+        for (WORD j = 0; j < nT; j++)
+        {
+            if (TestCase[rgColumns[j]] != rgLevels[j])
+                rgMismatch[nMismatches++] = j;
+        }
+
+        WORD j = rgMismatch[std::uniform_int_distribution<WORD>(0, nMismatches - 1)(m_mt)];
+
+        // a move completing a forbidden tuple is never taken
+        if (m_System.get_Constraints().IsFeasible(TestCase, rgColumns[j], rgLevels[j]))
+        {
+            long lDelta = CalcFlipDelta(TestCase, rgColumns[j], rgLevels[j]);
+
+            if ((lDelta <= 0) || (distProb(m_mt) < std::exp(-lDelta / dTemp)))
+                Flip(TestCase, rgColumns[j], rgLevels[j]);
+        }
+
+        dTemp *= ANNEAL_COOLING;
+        if (dTemp < ANNEAL_TEMP_END)
+            dTemp = ANNEAL_TEMP_START;
+    }
+
+    return true;
+}
+
+bool
+CSuiteAnnealer::Init(const CComponentSystem& system, WORD nT)
+{
+    bool bResult = m_cntTemplate.Init(system, nT);
+
+    m_pSystem = bResult ? &system : nullptr;
+
+    return bResult;
+}
+
+size_t
+CSuiteAnnealer::Shrink(std::list<CTestCase>& lstTestSuite, double dTimeBudget)
+{
+    size_t nResult = 0;
+
+    if ((m_pSystem == nullptr) || (lstTestSuite.size() < 2))
+        return nResult;
+
+    std::vector<CTestCase> rgBest(lstTestSuite.begin(), lstTestSuite.end());
+    std::mt19937           mtSeeds(static_cast<unsigned int>(CLOCK::now().time_since_epoch().count()));
+    unsigned int           nNumChains = GetNumWorkerThreads( );
+    CLOCK::time_point      tpDeadline = CLOCK::now() + 
+                                        std::chrono::duration_cast<CLOCK::duration>(
+                                            std::chrono::duration<double>(dTimeBudget));
+
+    while ((rgBest.size() > 1) && (CLOCK::now() < tpDeadline))
+    {
+        std::atomic<bool>         bSolved(false);
+        std::mutex                mtxSolution;
+        std::vector<CTestCase>    rgSolution;
+        std::vector<unsigned int> rgSeeds(nNumChains);
+
+        for (auto& it : rgSeeds)
+            it = mtSeeds( );
+
+        ParallelForRange(0, nNumChains, 1, 
+            [&](size_t nFirst, size_t /* nLast */, unsigned int /* nPartition */)
+            {
+                CAnnealingChain chain(*m_pSystem, m_cntTemplate, rgBest, rgSeeds[nFirst]);
+
+                chain.DropWeakestRow( );
+
+                if (chain.Run(bSolved, tpDeadline))
+                {
+                    std::lock_guard<std::mutex> lock(mtxSolution);
+
+                    if (!bSolved)
+                    {
+                        rgSolution = chain.get_Rows( );
+                        bSolved    = true;
+                    }
+                }
+            });
+
+        if (!bSolved)
+            break;
+
+        rgBest.swap(rgSolution);
+        nResult++;
+    }
+
+    lstTestSuite.assign(rgBest.begin(), rgBest.end());
+
+    return nResult;
+}
@@ -0,0 +1,87 @@
+/**
+ *  @file       SuiteAnnealer.h
+ *  @brief      CSuiteAnnealer class interface
+ *
+ *  Provides type definitions for: CSuiteAnnealer
+ *
+ *  @author     Mark L. Short
+ *  @date       October 18, 2026
+ */
+#pragma once
+
+#if !defined(__SUITE_ANNEALER_H__)
+#define __SUITE_ANNEALER_H__
+
+#ifndef __COMMON_DEF_H__
+    #include "CommonDef.h"
+#endif
+
+#ifndef _LIST_
+    #include <list>
+#endif
+
+#ifndef __TEST_CASE_H__
+    #include "TestCase.h"
+#endif
+
+#ifndef __COVERAGE_COUNT_H__
+    #include "CoverageCount.h"
+#endif
+
+// forward declarations
+class CComponentSystem;
+
+/**
+  @brief  Shrinks a complete test suite by simulated annealing
+
+  Starting from a coverage-complete suite of N test cases, the test case 
+  covering the fewest tuples uniquely is dropped, after which single cell 
+  level changes are annealed until the N - 1 test cases are again coverage 
+  complete.  On success the attempt is repeated from the smaller suite, until 
+  the time budget runs out.
+
+  Every move is evaluated against a CCoverageCount, costing a constant amount
+  of work for each tuple containing the changed cell.  Independent chains, 
+  each with its own random stream, are run on every worker thread; the first 
+  chain to succeed publishes its suite and the others abandon the round.
+*/
+class CSuiteAnnealer
+{
+    const CComponentSystem*  m_pSystem;        ///< target component system
+    CCoverageCount           m_cntTemplate;    ///< empty count layout, copied by each chain
+
+public:
+    /// Default Constructor
+    CSuiteAnnealer() noexcept
+        : m_pSystem(nullptr),
+          m_cntTemplate()
+    { };
+
+    /// Destructor
+    ~CSuiteAnnealer() = default;
+
+/**
+  @brief  class initializer
+
+  @param [in] system         target CComponentSystem, which must outlive the 
+                             annealer
+  @param [in] nT             the T-way value, [1..MAX_T_WAY]
+
+  @retval true               on success
+  @retval false              on error or invalid parameter values
+*/
+    bool   Init(const CComponentSystem& system, WORD nT);
+
+/**
+  @brief  Attempts to remove test cases from a complete suite
+
+  @param [in,out] lstTestSuite  a coverage-complete test suite, replaced by 
+                                the smallest complete suite found
+  @param [in]     dTimeBudget   time budget, in seconds
+
+  @retval size_t             containing the number of test cases removed
+*/
+    size_t Shrink(std::list<CTestCase>& lstTestSuite, double dTimeBudget);
+};
+
+#endif
@@ -0,0 +1,269 @@
+/**
+ *  @file       SuiteCache.cpp
+ *  @brief      CSuiteCache class implementation
+ *  @author     Mark L. Short
+ *  @date       October 18, 2026
+ */
+
+#include "stdafx.h"
+
+#include <algorithm>
+#include <chrono>
+#include <sstream>
+#include "BinarySuite.h"
+#include "ComponentSystem.h"
+
+#include "SuiteCache.h"
+
+namespace fs = std::filesystem;
+
+/// extension of a cache entry
+constexpr const TCHAR* CACHE_ENTRY_EXT   = _T(".bin");
+
+/// extension of an entry being written
+constexpr const TCHAR* CACHE_PARTIAL_EXT = _T(".tmp");
+
+/// age beyond which a temporary file is taken to be abandoned
+constexpr const std::chrono::hours CACHE_PARTIAL_AGE(1);
+
+/**
+  @brief  64-bit FNV-1a hash of a string
+*/
+static QWORD HashKey(const std::string& strKey) noexcept
+{
+    QWORD nHash = 0xcbf29ce484222325ull;
+
+    for (char ch : strKey)
+    {
+        nHash ^= static_cast<BYTE>(ch);
+        nHash *= 0x100000001b3ull;
+    }
+
+    return nHash;
+}
+
+bool
+CSuiteCache::Open(const TCHAR* szDirectory, QWORD cbCapacity)
+{
+    std::error_code ec;
+
+    m_pathDirectory.clear();
+    m_cbCapacity = cbCapacity;
+
+    fs::create_directories(szDirectory, ec);
+
+    if (fs::is_directory(szDirectory, ec) == false)
+        return false;
+
+    m_pathDirectory = szDirectory;
+    return true;
+}
+
+std::string
+CSuiteCache::MakeKey(const CComponentSystem& system,
+                     const std::vector<std::vector<LEVEL_T>>& rgForbidden, bool bDontCare)
+{
+    std::ostringstream ss;
+
+    ss << "t=" << system.get_Strength( ) << ";v=";
+
+    for (FACTOR_T nCurFactor = 0; nCurFactor < system.get_NumFactors( ); nCurFactor++)
+        ss << system.GetNumLevels(nCurFactor) << ',';
+
+    ss << ";r=";
+
+    for (const auto& it : system.get_Relations( ))
+    {
+        ss << it.nT << ':';
+        for (FACTOR_T nFactor : it.rgFactors)
+            ss << nFactor << ',';
+        ss << '|';
+    }
+
+    std::vector<std::vector<LEVEL_T>> rgTuples(rgForbidden);
+
+    for (auto& it : rgTuples)
+        std::sort(it.begin(), it.end());
+
+    std::sort(rgTuples.begin(), rgTuples.end());
+    rgTuples.erase(std::unique(rgTuples.begin(), rgTuples.end()), rgTuples.end());
+
+    ss << ";c=";
+
+    for (const auto& it : rgTuples)
+    {
+        for (LEVEL_T nLevel : it)
+            ss << nLevel << ',';
+        ss << '|';
+    }
+
+    ss << ";d=" << (bDontCare ? 1 : 0);
+
+    return ss.str();
+}
+
+bool
+CSuiteCache::Lookup(const std::string& strKey, const CComponentSystem& system,
+                    std::list<CTestCase>& lstTestSuite)
+{
+    std::error_code    ec;
+    CBinarySuiteReader reader;
+
+    lstTestSuite.clear();
+
+    if (!IsOpen())
+        return false;
+
+    fs::path pathEntry = GetEntryPath(strKey);
+
+    if ((reader.Open(pathEntry.c_str()) == false) ||
+        (reader.get_T() != system.get_Strength( )) ||
+        (reader.get_NumFactors() != system.get_NumFactors( )))
+        return false;
+
+    for (FACTOR_T nCurFactor = 0; nCurFactor < system.get_NumFactors( ); nCurFactor++)
+    {
+        if ((reader.GetMinLevel(nCurFactor)  != system.GetMinLevel(nCurFactor)) ||
+            (reader.GetNumLevels(nCurFactor) != system.GetNumLevels(nCurFactor)))
+            return false;
+    }
+
+    for (size_t nRow = 0; nRow < reader.get_NumRows( ); nRow++)
+    {
+        lstTestSuite.emplace_back( );
+        reader.GetRow(nRow).ToTestCase(lstTestSuite.back( ));
+    }
+
+    reader.Close( );
+
+    // the time stamp orders the entries for eviction
+    fs::last_write_time(pathEntry, fs::file_time_type::clock::now(), ec);
+
+    return true;
+}
+
+bool
+CSuiteCache::Store(const std::string& strKey, const CComponentSystem& system,
+                   const std::list<CTestCase>& lstTestSuite,
+                   const char* szEngine, DWORD nRepetitions)
+{
+    std::error_code ec;
+
+    if (!IsOpen() || lstTestSuite.empty())
+        return false;
+
+    std::lock_guard<std::mutex> lock(m_mtxStore);
+
+    fs::path pathEntry = GetEntryPath(strKey);
+
+    // the better suite wins, ties going to the one already cached
+    if (IsCachedNoLarger(pathEntry, system, lstTestSuite.size()))
+        return false;
+
+    // the suite is written in full under a unique name, then renamed over
+    // the entry in a single step
+    fs::path pathPartial = pathEntry;
+    pathPartial += _T(".");
+    pathPartial += std::to_string(std::chrono::steady_clock::now().time_since_epoch().count());
+    pathPartial += CACHE_PARTIAL_EXT;
+
+    bool bResult = WriteBinarySuite(pathPartial.c_str(), system, system.get_Strength( ),
+                                    lstTestSuite, szEngine, nRepetitions);
+
+    // another process may have stored a better suite while this one was 
+    // being written
+    if (bResult && IsCachedNoLarger(pathEntry, system, lstTestSuite.size()))
+        bResult = false;
+
+    if (bResult)
+        fs::rename(pathPartial, pathEntry, ec);
+
+    if (!bResult || ec)
+    {
+        fs::remove(pathPartial, ec);
+        return false;
+    }
+
+    Evict(pathEntry);
+    return true;
+}
+
+bool
+CSuiteCache::IsCachedNoLarger(const fs::path& pathEntry, const CComponentSystem& system, size_t nNumRows)
+{
+    CBinarySuiteReader reader;
+
+    return reader.Open(pathEntry.c_str()) &&
+           (reader.get_NumFactors() == system.get_NumFactors( )) &&
+           (reader.get_NumRows() <= nNumRows);
+}
+
+fs::path
+CSuiteCache::GetEntryPath(const std::string& strKey) const
+{
+    char szName[32] = { 0 };
+
+    snprintf(szName, _countof(szName), "%016llx", static_cast<unsigned long long>(HashKey(strKey)));
+
+    fs::path pathEntry = m_pathDirectory / szName;
+    pathEntry += CACHE_ENTRY_EXT;
+
+    return pathEntry;
+}
+
+size_t
+CSuiteCache::Evict(const fs::path& pathKeep)
+{
+    struct CACHE_ENTRY
+    {
+        fs::file_time_type tmWrite;
+        QWORD              cbSize;
+        fs::path           pathEntry;
+    };
+
+    std::error_code          ec;
+    std::vector<CACHE_ENTRY> rgEntries;
+    QWORD                    cbTotal = 0;
+    size_t                   nResult = 0;
+    auto                     tmNow   = fs::file_time_type::clock::now();
+
+    for (fs::directory_iterator it(m_pathDirectory, ec), itEnd; !ec && (it != itEnd); it.increment(ec))
+    {
+        const fs::path& pathFile = it->path();
+        fs::file_time_type tmWrite = it->last_write_time(ec);
+
+        if (ec || !it->is_regular_file(ec))
+            continue;
+
+        if (pathFile.extension() == CACHE_PARTIAL_EXT)
+        {
+            if (tmNow - tmWrite > CACHE_PARTIAL_AGE)
+                fs::remove(pathFile, ec);
+        }
+        else if (pathFile.extension() == CACHE_ENTRY_EXT)
+        {
+            QWORD cbSize = it->file_size(ec);
+
+            rgEntries.push_back({ tmWrite, cbSize, pathFile });
+            cbTotal += cbSize;
+        }
+    }
+
+    std::sort(rgEntries.begin(), rgEntries.end(),
+              [](const CACHE_ENTRY& lhs, const CACHE_ENTRY& rhs)
+              { return lhs.tmWrite < rhs.tmWrite; });
+
+    for (const auto& it : rgEntries)
+    {
+        if (cbTotal <= m_cbCapacity)
+            break;
+
+        if ((it.pathEntry != pathKeep) && fs::remove(it.pathEntry, ec))
+        {
+            cbTotal -= it.cbSize;
+            nResult++;
+        }
+    }
+
+    return nResult;
+}
@@ -0,0 +1,178 @@
+/**
+ *  @file       SuiteCache.h
+ *  @brief      CSuiteCache class interface
+ *
+ *  Provides type definitions for: CSuiteCache
+ *
+ *  @author     Mark L. Short
+ *  @date       October 18, 2026
+ */
+#pragma once
+
+#if !defined(__SUITE_CACHE_H__)
+#define __SUITE_CACHE_H__
+
+#ifndef __COMMON_DEF_H__
+    #include "CommonDef.h"
+#endif
+
+#ifndef _FILESYSTEM_
+    #include <filesystem>
+#endif
+
+#ifndef _LIST_
+    #include <list>
+#endif
+
+#ifndef _MUTEX_
+    #include <mutex>
+#endif
+
+#ifndef _STRING_
+    #include <string>
+#endif
+
+#ifndef _VECTOR_
+    #include <vector>
+#endif
+
+#ifndef __TEST_CASE_H__
+    #include "TestCase.h"
+#endif
+
+// forward declaration
+class CComponentSystem;
+
+/// default size cap of a suite cache directory, in bytes
+constexpr const QWORD DEFAULT_CACHE_CAPACITY = 256ull * 1024 * 1024;
+
+/**
+  @brief  A persistent, content addressed cache of generated test suites
+
+  Each entry is a binary suite file named by a hash of the canonical model it
+  covers: the level counts, the strength and any sub-relations, the
+  forbidden tuples and whether don't-care cells were allowed.  Parameters
+  affecting only the size of a suite, such as the engine or the annealing
+  time, are left out, so that an entry is shared by every run able to use
+  it and a better suite from any of them replaces it.
+
+  Entries are written to a temporary file and renamed into place, so a
+  reader never sees a partial entry.  Stores are serialized within the 
+  process, and the entry is checked once more just before the rename, 
+  narrowing the window in which another process's better suite could be 
+  replaced.  A hit refreshes the entry's time stamp
+  and the least recently used entries are evicted once the directory grows
+  beyond its size cap.
+*/
+class CSuiteCache
+{
+    std::filesystem::path  m_pathDirectory;   ///< cache directory
+    QWORD                  m_cbCapacity;      ///< size cap of the cached entries, in bytes
+    std::mutex             m_mtxStore;        ///< serializes Store
+
+public:
+    /// Default Constructor
+    CSuiteCache() noexcept
+        : m_pathDirectory(),
+          m_cbCapacity(DEFAULT_CACHE_CAPACITY),
+          m_mtxStore()
+    { };
+
+/**
+  @brief  Opens a cache directory, creating it if need be
+
+  @param [in] szDirectory    path of the cache directory
+  @param [in] cbCapacity     size cap of the cached entries, in bytes
+
+  @retval true               on success
+  @retval false              if the directory could not be created
+*/
+    bool   Open(const TCHAR* szDirectory, QWORD cbCapacity);
+
+/**
+  @brief  Builds the canonical key of a model
+
+  Forbidden tuples are sorted, both within and between tuples, so the same
+  constraints listed in any order give the same key.
+
+  @param [in] system         CComponentSystem object, containing the inputs
+  @param [in] rgForbidden    the forbidden tuples, as global level ids
+  @param [in] bDontCare      true if the suite may hold don't-care cells
+
+  @retval std::string        containing the key
+*/
+    static std::string MakeKey(const CComponentSystem& system,
+                               const std::vector<std::vector<LEVEL_T>>& rgForbidden,
+                               bool bDontCare);
+
+/**
+  @brief  Looks up a cached suite
+
+  The entry is read through the memory mapped binary suite reader, and
+  checked against the system in case of a hash collision.
+
+  @param [in]  strKey        key from MakeKey
+  @param [in]  system        CComponentSystem object, containing the inputs
+  @param [out] lstTestSuite  the cached test cases
+
+  @retval true               on a hit
+  @retval false              on a miss
+*/
+    bool   Lookup(const std::string& strKey, const CComponentSystem& system,
+                  std::list<CTestCase>& lstTestSuite);
+
+/**
+  @brief  Stores a suite, unless a suite no larger is already cached
+
+  @param [in] strKey         key from MakeKey
+  @param [in] system         CComponentSystem object, containing the inputs
+  @param [in] lstTestSuite   the test cases
+  @param [in] szEngine       generation engine name, up to 8 characters
+  @param [in] nRepetitions   number of generation repetitions
+
+  @retval true               if the suite was stored
+  @retval false              if a better suite is cached, or on error
+*/
+    bool   Store(const std::string& strKey, const CComponentSystem& system,
+                 const std::list<CTestCase>& lstTestSuite,
+                 const char* szEngine, DWORD nRepetitions);
+
+/**
+  @brief  Indicates whether a cache directory has been opened
+
+  @retval bool               true if open
+*/
+    inline bool IsOpen(void) const noexcept
+    { return !m_pathDirectory.empty(); };
+
+private:
+/**
+  @brief  Returns the path of a key's entry
+*/
+    std::filesystem::path GetEntryPath(const std::string& strKey) const;
+
+/**
+  @brief  Indicates whether an entry holds a suite no larger than a 
+          candidate
+
+  @param [in] pathEntry      path of the entry
+  @param [in] system         CComponentSystem object, containing the inputs
+  @param [in] nNumRows       rows of the candidate suite
+
+  @retval bool               true if the cached suite is to be kept
+*/
+    static bool IsCachedNoLarger(const std::filesystem::path& pathEntry, 
+                                 const CComponentSystem& system, size_t nNumRows);
+
+/**
+  @brief  Removes the least recently used entries until the cache fits its
+          size cap, along with any abandoned temporary files
+
+  @param [in] pathKeep       an entry never to be removed
+
+  @retval size_t             containing the number of entries removed
+*/
+    size_t Evict(const std::filesystem::path& pathKeep);
+};
+
+#endif
@@ -0,0 +1,267 @@
+/**
+ *  @file       SuiteReader.cpp
+ *  @brief      Loading of existing test suite files
+ *  @author     Mark L. Short
+ *  @date       October 18, 2026
+ */
+
+#include "stdafx.h"
+
+#include <algorithm>
+#include "BinarySuite.h"
+#include "MappedFile.h"
+
+#include "SuiteReader.h"
+
+/**
+  @brief  Tests whether a character separates the cells of a text suite
+*/
+static inline bool IsSeparator(char ch) noexcept
+{
+    return (ch == ' ') || (ch == ',') || (ch == '\t') || (ch == '\r');
+}
+
+/**
+  @brief  Loads a binary suite
+*/
+static bool ReadBinarySuite(const TCHAR* szPath, 
+                            std::vector<LEVEL_T>& rgMinLevel, std::vector<LEVEL_T>& rgNumLevels,
+                            std::list<CTestCase>& lstTestSuite, QWORD* pSeed)
+{
+    CBinarySuiteReader reader;
+
+    if (reader.Open(szPath) == false)
+        return false;
+
+    if (pSeed)
+        *pSeed = reader.get_Seed( );
+
+    size_t nNumFactors = reader.get_NumFactors( );
+
+    rgMinLevel.resize(nNumFactors);
+    rgNumLevels.resize(nNumFactors);
+
+    for (size_t f = 0; f < nNumFactors; f++)
+    {
+        rgMinLevel [f] = reader.GetMinLevel(f);
+        rgNumLevels[f] = reader.GetNumLevels(f);
+    }
+
+    for (size_t nRow = 0; nRow < reader.get_NumRows( ); nRow++)
+    {
+        lstTestSuite.emplace_back( );
+        reader.GetRow(nRow).ToTestCase(lstTestSuite.back( ));
+    }
+
+    return true;
+}
+
+/**
+  @brief  Loads a text, CSV or TSV suite
+*/
+static bool ReadTextSuite(const TCHAR* szPath, const std::vector<LEVEL_T>& rgTextLevels,
+                          std::vector<LEVEL_T>& rgMinLevel, std::vector<LEVEL_T>& rgNumLevels,
+                          std::list<CTestCase>& lstTestSuite)
+{
+    CMappedFile file;
+
+    if (file.Open(szPath) == false)
+        return false;
+
+    const char* p    = static_cast<const char*>(file.get_Data( ));
+    const char* pEnd = p + file.get_Size( );
+
+    std::vector<LEVEL_T> rgRows;         // row-major global levels
+    size_t               nNumFactors = 0;
+    size_t               nNumRows    = 0;
+    size_t               nMaxLevel   = 0;
+    bool                 bFirstLine  = true;
+
+    while (p < pEnd)
+    {
+        const char* pEol = p;
+        while ((pEol < pEnd) && (*pEol != '\n'))
+            pEol++;
+
+        size_t nCells = 0;
+        size_t nStart = rgRows.size( );
+        bool   bSkip  = false;
+
+        while (p < pEol)
+        {
+            if (IsSeparator(*p))
+            {
+                p++;
+                continue;
+            }
+
+            if (*p == '*')
+            {
+                rgRows.push_back(LEVEL_INVALID);
+                p++;
+            }
+            else if ((*p >= '0') && (*p <= '9'))
+            {
+                size_t nValue = 0;
+                while ((p < pEol) && (*p >= '0') && (*p <= '9'))
+                    nValue = nValue * 10 + (*p++ - '0');
+
+                if (nValue >= LEVEL_INVALID)
+                    return false;
+
+                rgRows.push_back(static_cast<LEVEL_T>(nValue));
+                nMaxLevel = std::max(nMaxLevel, nValue);
+            }
+            else
+            {
+                // a CSV/TSV header line of factor names
+                bSkip = bFirstLine;
+                if (!bSkip)
+                    return false;
+                break;
+            }
+            nCells++;
+        }
+
+        p = pEol + 1;
+
+        if (bSkip || (nCells == 0))
+        {
+            rgRows.resize(nStart);
+            bFirstLine = bFirstLine && (nCells == 0);
+            continue;
+        }
+
+        if (nNumFactors == 0)
+        {
+            nNumFactors = nCells;
+        }
+        else if (nCells != nNumFactors)
+        {
+            // the row count header of the text format has a single cell
+            if ((nNumRows == 1) && (nNumFactors == 1))
+            {
+                rgRows.erase(rgRows.begin());
+                nNumFactors = nCells;
+                nNumRows    = 0;
+                nMaxLevel   = 0;
+                for (auto it : rgRows)
+                {
+                    if (IsValidLevel(it))
+                        nMaxLevel = std::max<size_t>(nMaxLevel, it);
+                }
+            }
+            else
+                return false;
+        }
+
+        nNumRows++;
+        bFirstLine = false;
+    }
+
+    if (nNumFactors == 0)
+        return false;
+
+    if (rgTextLevels.size( ) == nNumFactors)
+        rgNumLevels = rgTextLevels;
+    else if (rgTextLevels.size( ) == 1)
+        rgNumLevels.assign(nNumFactors, rgTextLevels[0]);
+    else if (rgTextLevels.empty( ))
+        rgNumLevels.assign(nNumFactors, static_cast<LEVEL_T>((nMaxLevel + nNumFactors) / nNumFactors));
+    else
+        return false;
+
+    rgMinLevel.resize(nNumFactors);
+
+    for (size_t f = 0; f < nNumFactors; f++)
+        rgMinLevel[f] = (f == 0) ? 0 : static_cast<LEVEL_T>(rgMinLevel[f - 1] + rgNumLevels[f - 1]);
+
+    for (size_t nRow = 0; nRow < nNumRows; nRow++)
+    {
+        lstTestSuite.emplace_back( );
+        CTestCase& TestCase = lstTestSuite.back( );
+        TestCase.Init(nNumFactors);
+
+        for (size_t f = 0; f < nNumFactors; f++)
+        {
+            LEVEL_T nLevel = rgRows[nRow * nNumFactors + f];
+
+            // a level outside the factor's range can not be attributed
+            if (IsValidLevel(nLevel) && 
+                ((nLevel < rgMinLevel[f]) || (nLevel - rgMinLevel[f] >= rgNumLevels[f])))
+                return false;
+
+            TestCase[f] = nLevel;
+        }
+    }
+
+    return true;
+}
+
+bool 
+ReadTestSuite(const TCHAR* szPath, const std::vector<LEVEL_T>& rgTextLevels, 
+              std::vector<LEVEL_T>& rgMinLevel, std::vector<LEVEL_T>& rgNumLevels,
+              std::list<CTestCase>& lstTestSuite, QWORD* pSeed)
+{
+    lstTestSuite.clear( );
+
+    if (pSeed)
+        *pSeed = 0;
+
+    return CBinarySuiteReader::IsBinarySuite(szPath) 
+                ? ReadBinarySuite(szPath, rgMinLevel, rgNumLevels, lstTestSuite, pSeed)
+                : ReadTextSuite(szPath, rgTextLevels, rgMinLevel, rgNumLevels, lstTestSuite);
+}
+
+bool
+ReadForbiddenTuples(const TCHAR* szPath, std::vector<std::vector<LEVEL_T>>& rgTuples)
+{
+    CMappedFile file;
+
+    rgTuples.clear( );
+
+    if (file.Open(szPath) == false)
+        return false;
+
+    const char* p    = static_cast<const char*>(file.get_Data( ));
+    const char* pEnd = p + file.get_Size( );
+
+    std::vector<LEVEL_T> rgLevels;
+
+    while (p < pEnd)
+    {
+        const char* pEol = p;
+        while ((pEol < pEnd) && (*pEol != '\n'))
+            pEol++;
+
+        rgLevels.clear( );
+
+        while ((p < pEol) && (*p != '#'))
+        {
+            if (IsSeparator(*p))
+            {
+                p++;
+                continue;
+            }
+
+            if ((*p < '0') || (*p > '9'))
+                return false;
+
+            size_t nValue = 0;
+            while ((p < pEol) && (*p >= '0') && (*p <= '9'))
+                nValue = nValue * 10 + (*p++ - '0');
+
+            if (nValue >= LEVEL_INVALID)
+                return false;
+
+            rgLevels.push_back(static_cast<LEVEL_T>(nValue));
+        }
+
+        p = pEol + 1;
+
+        if (rgLevels.empty( ) == false)
+            rgTuples.push_back(rgLevels);
+    }
+
+    return true;
+}
@@ -0,0 +1,69 @@
+/**
+ *  @file       SuiteReader.h
+ *  @brief      Loading of existing test suite files
+ *
+ *  @author     Mark L. Short
+ *  @date       October 18, 2026
+ */
+#pragma once
+
+#if !defined(__SUITE_READER_H__)
+#define __SUITE_READER_H__
+
+#ifndef __COMMON_DEF_H__
+    #include "CommonDef.h"
+#endif
+
+#ifndef _LIST_
+    #include <list>
+#endif
+
+#ifndef _VECTOR_
+    #include <vector>
+#endif
+
+#ifndef __TEST_CASE_H__
+    #include "TestCase.h"
+#endif
+
+/**
+  @brief  Loads a suite file, detecting its format
+
+  Binary suites describe their own factors.  Text suites (whitespace, comma
+  or tab separated global level ids, '*' denoting a don't-care, with an 
+  optional row count or column header) number the levels of consecutive 
+  factors on from one another, factor f being given rgTextLevels[f] levels.
+
+  @param [in]  szPath        path of the suite file
+  @param [in]  rgTextLevels  levels per factor of a text suite: one count per
+                             factor, a single count v shared by every factor,
+                             or empty to infer v from the largest level id
+  @param [out] rgMinLevel    minimum level, indexed by factor
+  @param [out] rgNumLevels   number of levels, indexed by factor
+  @param [out] lstTestSuite  the test cases
+  @param [out] pSeed         optional, receives the random seed of a binary
+                             suite, or 0 for a text suite
+
+  @retval true               on success
+  @retval false              if the file could not be read or parsed
+*/
+bool ReadTestSuite(const TCHAR* szPath, const std::vector<LEVEL_T>& rgTextLevels, 
+                   std::vector<LEVEL_T>& rgMinLevel, std::vector<LEVEL_T>& rgNumLevels,
+                   std::list<CTestCase>& lstTestSuite, QWORD* pSeed = nullptr);
+
+/**
+  @brief  Loads a constraints file of forbidden tuples
+
+  Each line holds one forbidden tuple as global level ids of distinct factors,
+  separated as the cells of a text suite.  Blank lines and anything following
+  a '#' are ignored.
+
+  @param [in]  szPath        path of the constraints file
+  @param [out] rgTuples      the forbidden tuples
+
+  @retval true               on success
+  @retval false              if the file could not be read or parsed
+*/
+bool ReadForbiddenTuples(const TCHAR* szPath, std::vector<std::vector<LEVEL_T>>& rgTuples);
+
+#endif
@@ -0,0 +1,118 @@
+/**
+ *  @file       SuiteReorderer.cpp
+ *  @brief      CSuiteReorderer class implementation
+ *  @author     Mark L. Short
+ *  @date       October 18, 2026
+ */
+
+#include "stdafx.h"
+
+#include <algorithm>
+#include <queue>
+#include "ParallelUtility.h"
+
+#include "SuiteReorderer.h"
+
+/// minimum number of test cases worth handing to a thread
+constexpr const size_t REORDER_GRAIN = 1024;
+
+/**
+  @brief  A test case waiting to be placed, under its last known gain
+*/
+struct REORDER_ENTRY
+{
+    size_t nGain;           ///< new tuples covered, as of the last evaluation
+    size_t nRow;            ///< original position of the test case
+};
+
+/**
+  @brief  Orders the queue by descending gain, then ascending original 
+          position, so ties keep the suite's existing order
+*/
+struct REORDER_ENTRY_LESS
+{
+    bool operator()(const REORDER_ENTRY& lhs, const REORDER_ENTRY& rhs) const noexcept
+    {
+        return (lhs.nGain < rhs.nGain) || ((lhs.nGain == rhs.nGain) && (lhs.nRow > rhs.nRow));
+    }
+};
+
+bool
+CSuiteReorderer::Init(const CComponentSystem& system, WORD nT)
+{
+    return m_cntTemplate.Init(system, nT);
+}
+
+bool
+CSuiteReorderer::Init(const std::vector<LEVEL_T>& rgMinLevel, 
+                      const std::vector<LEVEL_T>& rgNumLevels, WORD nT)
+{
+    return m_cntTemplate.Init(rgMinLevel, rgNumLevels, nT);
+}
+
+size_t
+CSuiteReorderer::Reorder(std::list<CTestCase>& lstTestSuite, std::vector<size_t>& rgCurve) const
+{
+    CCoverageCount                              cntTuples(m_cntTemplate);
+    std::vector<std::list<CTestCase>::iterator> rgRows;
+    std::vector<REORDER_ENTRY>                  rgEntries(lstTestSuite.size( ));
+
+    rgRows.reserve(lstTestSuite.size( ));
+    for (auto it = lstTestSuite.begin(); it != lstTestSuite.end(); ++it)
+        rgRows.push_back(it);
+
+    // nothing is covered yet, so the initial gains are independent
+    ParallelForRange(0, rgRows.size( ), REORDER_GRAIN, 
+                     [&](size_t nFirst, size_t nLast, unsigned int)
+    {
+        for (size_t nRow = nFirst; nRow < nLast; nRow++)
+            rgEntries[nRow] = { cntTuples.CountUncovered(*rgRows[nRow]), nRow };
+    });
+
+    std::priority_queue<REORDER_ENTRY, std::vector<REORDER_ENTRY>, REORDER_ENTRY_LESS> 
+        queEntries(REORDER_ENTRY_LESS( ), std::move(rgEntries));
+
+    std::list<CTestCase> lstResult;
+    std::vector<bool>    rgPlaced(rgRows.size( ), false);
+
+    rgCurve.clear( );
+    rgCurve.reserve(rgRows.size( ));
+
+    while (!queEntries.empty( ) && (queEntries.top( ).nGain > 0))
+    {
+        REORDER_ENTRY entry = queEntries.top( );
+        queEntries.pop( );
+
+        size_t nGain = cntTuples.CountUncovered(*rgRows[entry.nRow]);
+
+        if (nGain < entry.nGain)
+        {
+            // stale; requeue under the refreshed gain
+            if (nGain > 0)
+                queEntries.push({ nGain, entry.nRow });
+            continue;
+        }
+
+        cntTuples.Add(*rgRows[entry.nRow]);
+        rgCurve.push_back(nGain);
+        rgPlaced[entry.nRow] = true;
+
+        lstResult.splice(lstResult.end(), lstTestSuite, rgRows[entry.nRow]);
+    }
+
+    size_t nResult = lstResult.size( );
+
+    // whatever remains adds no coverage, and keeps its original order
+    for (size_t nRow = 0; nRow < rgRows.size( ); nRow++)
+    {
+        if (!rgPlaced[nRow])
+        {
+            lstResult.splice(lstResult.end(), lstTestSuite, rgRows[nRow]);
+            rgCurve.push_back(0);
+        }
+    }
+
+    lstTestSuite.swap(lstResult);
+
+    return nResult;
+}
@@ -0,0 +1,111 @@
+/**
+ *  @file       SuiteReorderer.h
+ *  @brief      CSuiteReorderer class interface
+ *
+ *  Provides type definitions for: CSuiteReorderer
+ *
+ *  @author     Mark L. Short
+ *  @date       October 18, 2026
+ */
+#pragma once
+
+#if !defined(__SUITE_REORDERER_H__)
+#define __SUITE_REORDERER_H__
+
+#ifndef __COMMON_DEF_H__
+    #include "CommonDef.h"
+#endif
+
+#ifndef _LIST_
+    #include <list>
+#endif
+
+#ifndef _VECTOR_
+    #include <vector>
+#endif
+
+#ifndef __TEST_CASE_H__
+    #include "TestCase.h"
+#endif
+
+#ifndef __COVERAGE_COUNT_H__
+    #include "CoverageCount.h"
+#endif
+
+// forward declarations
+class CComponentSystem;
+
+/**
+  @brief  Reorders an existing test suite by its rate of t-way coverage
+
+  The test case covering the most tuples not yet covered by the test cases 
+  placed before it is repeatedly placed next, so that any prefix of the 
+  suite covers as many tuples as the greedy choice allows.  Test cases which
+  add no coverage are placed last, in their original order.
+
+  Because the number of new tuples a test case covers can only shrink as 
+  others are placed, gains are evaluated lazily: test cases wait in a 
+  priority queue under their last known gain, and only the top of the queue
+  is re-evaluated against the CCoverageCount.  A test case whose refreshed 
+  gain is unchanged is known to be the best remaining, so most test cases 
+  are evaluated only a handful of times over the whole reordering.
+*/
+class CSuiteReorderer
+{
+    CCoverageCount           m_cntTemplate;    ///< empty count layout of the suite's tuples
+
+public:
+    /// Default Constructor
+    CSuiteReorderer() noexcept
+        : m_cntTemplate()
+    { };
+
+    /// Destructor
+    ~CSuiteReorderer() = default;
+
+/**
+  @brief  class initializer
+
+  @param [in] system         target CComponentSystem
+  @param [in] nT             the T-way value, [1..MAX_T_WAY]
+
+  @retval true               on success
+  @retval false              on error or invalid parameter values
+*/
+    bool   Init(const CComponentSystem& system, WORD nT);
+
+/**
+  @brief  class initializer, from explicit level ranges
+
+  @param [in] rgMinLevel     minimum level, indexed by factor
+  @param [in] rgNumLevels    number of levels, indexed by factor
+  @param [in] nT             the T-way value, [1..MAX_T_WAY]
+
+  @retval true               on success
+  @retval false              on error or invalid parameter values
+*/
+    bool   Init(const std::vector<LEVEL_T>& rgMinLevel, 
+                const std::vector<LEVEL_T>& rgNumLevels, WORD nT);
+
+/**
+  @brief  Reorders a test suite, most new coverage first
+
+  @param [in,out] lstTestSuite  the test suite, reordered in place
+  @param [out]    rgCurve       receives the number of new tuples covered by 
+                                each test case in its new position
+
+  @retval size_t             containing the number of test cases adding 
+                             coverage; the remainder are redundant
+*/
+    size_t Reorder(std::list<CTestCase>& lstTestSuite, std::vector<size_t>& rgCurve) const;
+
+/**
+  @brief  Returns the total number of t-way tuples
+
+  @retval size_t             containing the number of tuples
+*/
+    inline size_t get_NumTuples(void) const noexcept
+    { return m_cntTemplate.get_NumTuples(); };
+};
+
+#endif
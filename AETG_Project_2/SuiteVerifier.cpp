@@ -0,0 +1,271 @@
+/**
+ *  @file       SuiteVerifier.cpp
+ *  @brief      CSuiteVerifier class implementation
+ *  @author     Mark L. Short
+ *  @date       October 18, 2026
+ */
+
+#include "stdafx.h"
+
+#include <algorithm>
+#include <climits>
+#include "MathUtility.h"
+#include "ParallelUtility.h"
+#include "SuiteReader.h"
+#include "TestCase.h"
+
+#include "SuiteVerifier.h"
+
+/// number of bits stored in each bitset word
+constexpr const size_t BITS_PER_WORD    = sizeof(QWORD) * CHAR_BIT;
+
+/// minimum number of column combinations worth handing to a thread
+constexpr const size_t VERIFY_GRAIN     = 256;
+
+bool
+CSuiteVerifier::Load(const TCHAR* szPath, const std::vector<LEVEL_T>& rgTextLevels)
+{
+    std::vector<LEVEL_T> rgMinLevel;
+    std::vector<LEVEL_T> rgNumLevels;
+    std::list<CTestCase> lstTestSuite;
+
+    return ReadTestSuite(szPath, rgTextLevels, rgMinLevel, rgNumLevels, lstTestSuite) &&
+           Load(rgMinLevel, rgNumLevels, lstTestSuite);
+}
+
+bool
+CSuiteVerifier::Load(const std::vector<LEVEL_T>& rgMinLevel, const std::vector<LEVEL_T>& rgNumLevels,
+                     const std::list<CTestCase>& lstTestSuite)
+{
+    size_t nNumFactors = rgNumLevels.size( );
+
+    m_rgFactorMin  = rgMinLevel;
+    m_rgFactorSize = rgNumLevels;
+    m_nNumRows     = lstTestSuite.size( );
+    m_rgForbidden.clear( );
+    m_rgCells.resize(nNumFactors * m_nNumRows);
+
+    size_t nRow = 0;
+    for (auto& it : lstTestSuite)
+    {
+        if (it.get_Size() != nNumFactors)
+            return false;
+
+        for (size_t f = 0; f < nNumFactors; f++)
+        {
+            m_rgCells[f * m_nNumRows + nRow] = IsValidLevel(it[f]) ? 
+                static_cast<LEVEL_T>(it[f] - m_rgFactorMin[f]) : LEVEL_INVALID;
+        }
+        nRow++;
+    }
+
+    return true;
+}
+
+bool
+CSuiteVerifier::SetForbiddenTuples(const std::vector<std::vector<LEVEL_T>>& rgTuples)
+{
+    m_rgForbidden.clear( );
+
+    for (auto& it : rgTuples)
+    {
+        std::vector<std::pair<FACTOR_T, LEVEL_T>> rgEntries;
+
+        for (auto nLevel : it)
+        {
+            size_t f = 0;
+            while ((f < m_rgFactorMin.size()) && 
+                   ((nLevel < m_rgFactorMin[f]) || (nLevel - m_rgFactorMin[f] >= m_rgFactorSize[f])))
+                f++;
+
+            if (f == m_rgFactorMin.size())
+                return false;
+
+            rgEntries.emplace_back(static_cast<FACTOR_T>(f), static_cast<LEVEL_T>(nLevel - m_rgFactorMin[f]));
+        }
+
+        std::sort(rgEntries.begin(), rgEntries.end());
+
+        for (size_t i = 1; i < rgEntries.size(); i++)
+        {
+            if (rgEntries[i].first == rgEntries[i - 1].first)
+                return false;
+        }
+
+        if (rgEntries.empty() == false)
+            m_rgForbidden.push_back(std::move(rgEntries));
+    }
+
+    return true;
+}
+
+size_t
+CSuiteVerifier::Verify(WORD nT, size_t nMaxReported, std::vector<MISSING_TUPLE>& rgMissing)
+{
+    rgMissing.clear();
+    m_nNumTuples   = 0;
+    m_nNumExcluded = 0;
+    m_nNumMissing  = 0;
+
+    if (CTupleSpace::Init(m_rgFactorMin, m_rgFactorSize, nT) == false)
+        return 0;
+
+    unsigned int nNumThreads = GetNumWorkerThreads( );
+
+    std::vector<size_t>                     rgNumTuples (nNumThreads, 0);
+    std::vector<size_t>                     rgNumExcluded(nNumThreads, 0);
+    std::vector<size_t>                     rgNumMissing(nNumThreads, 0);
+    std::vector<std::vector<MISSING_TUPLE>> rgReported  (nNumThreads);
+
+    ParallelForRange(0, m_nNumCombinations, VERIFY_GRAIN, 
+        [&](size_t nFirst, size_t nLast, unsigned int nPartition)
+        {
+            FACTOR_T           rgColumns[MAX_T_WAY];
+            const LEVEL_T*     rgCells  [MAX_T_WAY];
+            LEVEL_T            rgSize   [MAX_T_WAY];
+            std::vector<QWORD> rgBits;
+            std::vector<std::pair<WORD, LEVEL_T>> rgMatch;  // forbidden (column, level), flattened
+            std::vector<size_t>                   rgArity;  // size of each forbidden tuple in rgMatch
+
+            UnrankCombination(nFirst, rgColumns, m_nT, m_nNumFactors);
+
+            for (size_t nRank = nFirst; nRank < nLast; nRank++)
+            {
+                size_t nBlockSize = GetBlockSize(rgColumns);
+                size_t nExcluded  = 0;
+                size_t nCovered   = 0;
+
+                rgBits.assign((nBlockSize + BITS_PER_WORD - 1) / BITS_PER_WORD, 0);
+
+                for (WORD i = 0; i < m_nT; i++)
+                {
+                    rgCells[i] = &m_rgCells[rgColumns[i] * m_nNumRows];
+                    rgSize [i] = m_rgNumLevels[rgColumns[i]];
+                }
+
+                // the forbidden tuples lying within this combination
+                rgMatch.clear();
+                rgArity.clear();
+
+                for (auto& it : m_rgForbidden)
+                {
+                    size_t nMatched = rgMatch.size();
+                    WORD   i        = 0;
+
+                    for (auto& entry : it)
+                    {
+                        while ((i < m_nT) && (rgColumns[i] < entry.first))
+                            i++;
+
+                        if ((i == m_nT) || (rgColumns[i] != entry.first))
+                            break;
+
+                        rgMatch.emplace_back(i, entry.second);
+                    }
+
+                    if (rgMatch.size() - nMatched == it.size())
+                        rgArity.push_back(it.size());
+                    else
+                        rgMatch.resize(nMatched);
+                }
+
+                // a forbidden tuple is marked as though covered, leaving it 
+                // out of both the universe and the missing tuples
+                for (size_t nIndex = 0; (rgArity.empty() == false) && (nIndex < nBlockSize); nIndex++)
+                {
+                    LEVEL_T rgLevels[MAX_T_WAY];
+                    size_t  nRest = nIndex;
+
+                    for (WORD i = m_nT; i-- > 0; )
+                    {
+                        rgLevels[i] = static_cast<LEVEL_T>(nRest % rgSize[i]);
+                        nRest      /= rgSize[i];
+                    }
+
+                    bool   bForbidden = false;
+                    size_t nOffset    = 0;
+
+                    for (size_t j = 0; (j < rgArity.size()) && !bForbidden; nOffset += rgArity[j++])
+                    {
+                        bForbidden = std::all_of(rgMatch.begin() + nOffset, rgMatch.begin() + nOffset + rgArity[j],
+                                                 [&](const std::pair<WORD, LEVEL_T>& m) { return rgLevels[m.first] == m.second; });
+                    }
+
+                    if (bForbidden)
+                    {
+                        rgBits[nIndex / BITS_PER_WORD] |= static_cast<QWORD>(1) << (nIndex % BITS_PER_WORD);
+                        nExcluded++;
+                    }
+                }
+
+                size_t nUniverse = nBlockSize - nExcluded;
+
+                for (size_t nRow = 0; (nRow < m_nNumRows) && (nCovered < nUniverse); nRow++)
+                {
+                    size_t nIndex = 0;
+                    WORD   i      = 0;
+
+                    for ( ; i < m_nT; i++)
+                    {
+                        LEVEL_T nLevel = rgCells[i][nRow];
+
+                        if (IsValidLevel(nLevel) == false)
+                            break;
+
+                        nIndex = nIndex * rgSize[i] + nLevel;
+                    }
+
+                    if (i == m_nT)
+                    {
+                        QWORD& qWord = rgBits[nIndex / BITS_PER_WORD];
+                        QWORD  qMask = static_cast<QWORD>(1) << (nIndex % BITS_PER_WORD);
+
+                        if ((qWord & qMask) == 0)
+                        {
+                            qWord |= qMask;
+                            nCovered++;
+                        }
+                    }
+                }
+
+                rgNumTuples  [nPartition] += nUniverse;
+                rgNumExcluded[nPartition] += nExcluded;
+                rgNumMissing [nPartition] += nUniverse - nCovered;
+
+                std::vector<MISSING_TUPLE>& rgList = rgReported[nPartition];
+
+                for (size_t nIndex = 0; (nCovered < nUniverse) && (nIndex < nBlockSize) && 
+                                        (rgList.size() < nMaxReported); nIndex++)
+                {
+                    if ((rgBits[nIndex / BITS_PER_WORD] & (static_cast<QWORD>(1) << (nIndex % BITS_PER_WORD))) == 0)
+                    {
+                        MISSING_TUPLE tuple = { };
+
+                        std::copy(rgColumns, rgColumns + m_nT, tuple.rgColumns);
+                        GetTupleLevels(rgColumns, nIndex, tuple.rgLevels);
+
+                        rgList.push_back(tuple);
+                    }
+                }
+
+                NextCombination(rgColumns, m_nT, m_nNumFactors);
+            }
+        });
+
+    // partitions cover ascending rank ranges, so the lowest ranked missing 
+    // tuples come first
+    for (unsigned int i = 0; i < nNumThreads; i++)
+    {
+        m_nNumTuples   += rgNumTuples[i];
+        m_nNumExcluded += rgNumExcluded[i];
+        m_nNumMissing  += rgNumMissing[i];
+
+        for (auto& it : rgReported[i])
+        {
+            if (rgMissing.size() < nMaxReported)
+                rgMissing.push_back(it);
+        }
+    }
+
+    return m_nNumMissing;
+}
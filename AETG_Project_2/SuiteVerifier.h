@@ -0,0 +1,173 @@
+/**
+ *  @file       SuiteVerifier.h
+ *  @brief      CSuiteVerifier class interface
+ *
+ *  Provides type definitions for: MISSING_TUPLE, CSuiteVerifier
+ *
+ *  @author     Mark L. Short
+ *  @date       October 18, 2026
+ */
+#pragma once
+
+#if !defined(__SUITE_VERIFIER_H__)
+#define __SUITE_VERIFIER_H__
+
+#ifndef __COMMON_DEF_H__
+    #include "CommonDef.h"
+#endif
+
+#ifndef _LIST_
+    #include <list>
+#endif
+
+#ifndef _VECTOR_
+    #include <vector>
+#endif
+
+#ifndef _UTILITY_
+    #include <utility>
+#endif
+
+#ifndef __TUPLE_SPACE_H__
+    #include "TupleSpace.h"
+#endif
+
+// forward declarations
+class CTestCase;
+
+/**
+  @brief  A t-way tuple not covered by a verified suite
+*/
+struct MISSING_TUPLE
+{
+    FACTOR_T  rgColumns[MAX_T_WAY];  ///< the tuple's column combination
+    LEVEL_T   rgLevels [MAX_T_WAY];  ///< the tuple's global level for each column
+};
+
+/**
+  @brief  Checks the t-way coverage of an existing test suite
+
+  The suite is held column-major as zero based levels, so checking a column 
+  combination is a single pass over t contiguous arrays.  Column combinations
+  are partitioned by rank across worker threads, each marking the tuples of 
+  one combination at a time in a small private bitset, so memory use does not
+  grow with C(k, t) and strengths up to MAX_T_WAY are practical for models 
+  with hundreds of factors.
+
+  Suites are loaded through ReadTestSuite, from either the text formats or 
+  the binary format.  Tuples containing a forbidden tuple can never be 
+  covered by a valid suite, so are left out of the tuple universe.
+*/
+class CSuiteVerifier : public CTupleSpace
+{
+    size_t                m_nNumRows;      ///< number of loaded rows
+    std::vector<LEVEL_T>  m_rgFactorMin;   ///< loaded minimum level, indexed by factor
+    std::vector<LEVEL_T>  m_rgFactorSize;  ///< loaded number of levels, indexed by factor
+    std::vector<LEVEL_T>  m_rgCells;       ///< zero based levels, column-major
+    std::vector<std::vector<std::pair<FACTOR_T, LEVEL_T>>>
+                          m_rgForbidden;   ///< forbidden (factor, zero based level) tuples, factors ascending
+    size_t                m_nNumTuples;    ///< number of t-way tuples, set by Verify
+    size_t                m_nNumExcluded;  ///< number of forbidden t-way tuples, set by Verify
+    size_t                m_nNumMissing;   ///< number of uncovered tuples, set by Verify
+
+public:
+    /// Default Constructor
+    CSuiteVerifier() noexcept
+        : CTupleSpace(),
+          m_nNumRows(0),
+          m_rgFactorMin(),
+          m_rgFactorSize(),
+          m_rgCells(),
+          m_rgForbidden(),
+          m_nNumTuples(0),
+          m_nNumExcluded(0),
+          m_nNumMissing(0)
+    { };
+
+/**
+  @brief  Loads a suite file, detecting its format
+
+  @param [in] szPath         path of the suite file
+  @param [in] rgTextLevels   levels per factor of a text suite; see 
+                             ReadTestSuite
+
+  @retval true               on success
+  @retval false              if the file could not be read or parsed
+*/
+    bool   Load(const TCHAR* szPath, const std::vector<LEVEL_T>& rgTextLevels);
+
+/**
+  @brief  Loads a suite already held in memory
+
+  @param [in] rgMinLevel     minimum level, indexed by factor
+  @param [in] rgNumLevels    number of levels, indexed by factor
+  @param [in] lstTestSuite   the test cases
+
+  @retval true               on success
+  @retval false              if a test case does not match the factors
+*/
+    bool   Load(const std::vector<LEVEL_T>& rgMinLevel, const std::vector<LEVEL_T>& rgNumLevels,
+                const std::list<CTestCase>& lstTestSuite);
+
+/**
+  @brief  Sets the forbidden tuples of the loaded suite's model
+
+  Must follow Load, which clears them, since the global levels are resolved
+  against the loaded factors.
+
+  @param [in] rgTuples       the forbidden tuples, as global levels
+
+  @retval true               on success
+  @retval false              if a level is outside of the loaded factors, or
+                             two levels of a tuple share a factor
+*/
+    bool   SetForbiddenTuples(const std::vector<std::vector<LEVEL_T>>& rgTuples);
+
+/**
+  @brief  Verifies t-way coverage of the loaded suite
+
+  @param [in]  nT            the T-way value, [1..MAX_T_WAY]
+  @param [in]  nMaxReported  maximum number of missing tuples to retrieve
+  @param [out] rgMissing     the lowest ranked missing tuples
+
+  @retval size_t             containing the number of missing tuples
+*/
+    size_t Verify(WORD nT, size_t nMaxReported, std::vector<MISSING_TUPLE>& rgMissing);
+
+// Primitive data accessors
+/**
+  @brief  Returns the number of loaded rows
+
+  @retval size_t             containing the number of rows
+*/
+    inline size_t get_NumRows(void) const noexcept
+    { return m_nNumRows; };
+
+/**
+  @brief  Returns the number of t-way tuples considered by the last Verify
+
+  @retval size_t             containing the number of tuples
+*/
+    inline size_t get_NumTuples(void) const noexcept
+    { return m_nNumTuples; };
+
+/**
+  @brief  Returns the number of t-way tuples the last Verify left out as 
+          forbidden
+
+  @retval size_t             containing the number of forbidden tuples
+*/
+    inline size_t get_NumExcluded(void) const noexcept
+    { return m_nNumExcluded; };
+
+/**
+  @brief  Returns the t-way coverage found by the last Verify
+
+  @retval double             containing the covered percentage
+*/
+    inline double get_CoveragePercent(void) const noexcept
+    { return m_nNumTuples ? 100.0 * (m_nNumTuples - m_nNumMissing) / m_nNumTuples : 0.0; };
+
+};
+
+#endif
@@ -0,0 +1,250 @@
+/**
+ *  @file       SuiteWriter.cpp
+ *  @brief      CSuiteWriter class implementation
+ *  @author     Mark L. Short
+ *  @date       October 18, 2026
+ */
+
+#include "stdafx.h"
+
+#include "TestCase.h"
+
+#include "SuiteWriter.h"
+
+/// upper bound on the characters needed for one cell, separator included
+constexpr const size_t MAX_CELL_CHARS = 24;
+
+CSuiteWriter::~CSuiteWriter()
+{
+    Close( );
+}
+
+bool
+CSuiteWriter::Open(const TCHAR* szPath, SUITE_FORMAT eFormat)
+{
+    Close( );
+
+    if (_tcscmp(szPath, _T("-")) == 0)
+    {
+        m_pFile     = stdout;
+        m_bOwnsFile = false;
+    }
+    else
+    {
+        // the suite is plain ASCII regardless of the character set
+        m_pFile     = _tfopen(szPath, _T("wb"));
+        m_bOwnsFile = true;
+    }
+
+    m_eFormat  = eFormat;
+    m_nUsed    = 0;
+    m_nNumRows = 0;
+    m_rgBuffer.resize(BUFFER_SIZE);
+
+    return (m_pFile != nullptr);
+}
+
+bool
+CSuiteWriter::Close(void)
+{
+    bool bResult = true;
+
+    if (m_pFile)
+    {
+        bResult = Flush( );
+
+        if (m_bOwnsFile)
+            bResult = (fclose(m_pFile) == 0) && bResult;
+        else
+            bResult = (fflush(m_pFile) == 0) && bResult;
+
+        m_pFile = nullptr;
+    }
+
+    return bResult;
+}
+
+bool
+CSuiteWriter::Flush(void)
+{
+    bool bResult = (m_pFile != nullptr);
+
+    if (bResult && (m_nUsed > 0))
+    {
+        bResult = (fwrite(m_rgBuffer.data(), 1, m_nUsed, m_pFile) == m_nUsed) && 
+                  (fflush(m_pFile) == 0);
+        m_nUsed = 0;
+    }
+
+    return bResult;
+}
+
+bool
+CSuiteWriter::Reserve(size_t nLen)
+{
+    bool bResult = true;
+
+    if (m_nUsed + nLen > m_rgBuffer.size())
+    {
+        bResult = Flush( );
+
+        if (nLen > m_rgBuffer.size())
+            m_rgBuffer.resize(nLen);
+    }
+
+    return bResult;
+}
+
+void
+CSuiteWriter::AppendUInt(size_t nValue) noexcept
+{
+    char  szDigits[MAX_CELL_CHARS];
+    char* pEnd = szDigits + _countof(szDigits);
+    char* p    = pEnd;
+
+    do
+    {
+        *--p    = static_cast<char>('0' + nValue % 10);
+        nValue /= 10;
+    } while (nValue);
+
+    while (p < pEnd)
+        m_rgBuffer[m_nUsed++] = *p++;
+}
+
+char
+CSuiteWriter::GetSeparator(void) const noexcept
+{
+    char chResult = ' ';
+
+    if (m_eFormat == SUITE_FORMAT::CSV)
+        chResult = ',';
+    else if (m_eFormat == SUITE_FORMAT::TSV)
+        chResult = '\t';
+
+    return chResult;
+}
+
+bool
+CSuiteWriter::WriteHeader(size_t nNumRows, FACTOR_T nNumFactors)
+{
+    bool bResult = false;
+
+    if (m_pFile)
+    {
+        if (m_eFormat == SUITE_FORMAT::TEXT)
+        {
+            if ((bResult = Reserve(MAX_CELL_CHARS)) == true)
+            {
+                AppendUInt(nNumRows);
+                m_rgBuffer[m_nUsed++] = '\n';
+                m_rgBuffer[m_nUsed++] = '\n';
+            }
+        }
+        else if ((bResult = Reserve(nNumFactors * MAX_CELL_CHARS + 1)) == true)
+        {
+            for (FACTOR_T nCurFactor = 0; nCurFactor < nNumFactors; nCurFactor++)
+            {
+                if (nCurFactor > 0)
+                    m_rgBuffer[m_nUsed++] = GetSeparator( );
+
+                m_rgBuffer[m_nUsed++] = 'f';
+                AppendUInt(nCurFactor);
+            }
+            m_rgBuffer[m_nUsed++] = '\n';
+        }
+    }
+
+    return bResult;
+}
+
+bool
+CSuiteWriter::WriteRow(const CTestCase& TestCase)
+{
+    bool   bResult = false;
+    size_t nSize   = TestCase.get_Size( );
+
+    if (m_pFile && Reserve(nSize * MAX_CELL_CHARS + 1))
+    {
+        char chSeparator = GetSeparator( );
+
+        for (size_t i = 0; i < nSize; i++)
+        {
+            // the delimited formats only separate cells, the text format 
+            // follows each cell with a space
+            if ((i > 0) && (m_eFormat != SUITE_FORMAT::TEXT))
+                m_rgBuffer[m_nUsed++] = chSeparator;
+
+            if (IsValidLevel(TestCase[i]))
+                AppendUInt(TestCase[i]);
+            else
+                m_rgBuffer[m_nUsed++] = '*';
+
+            if (m_eFormat == SUITE_FORMAT::TEXT)
+                m_rgBuffer[m_nUsed++] = chSeparator;
+        }
+        m_rgBuffer[m_nUsed++] = '\n';
+
+        m_nNumRows++;
+        bResult = true;
+    }
+
+    return bResult;
+}
+
+bool
+CSuiteWriter::WriteSuite(const std::list<CTestCase>& lstTestSuite)
+{
+    FACTOR_T nNumFactors = lstTestSuite.empty() ? 0 : 
+                           static_cast<FACTOR_T>(lstTestSuite.front().get_Size());
+
+    bool bResult = WriteHeader(lstTestSuite.size(), nNumFactors);
+
+    for (auto& it : lstTestSuite)
+    {
+        if (bResult)
+            bResult = WriteRow(it);
+    }
+
+    return bResult && Flush( );
+}
+
+bool
+CSuiteWriter::WriteCoverageCurve(const std::vector<size_t>& rgCurve, size_t nNumTuples)
+{
+    static const char szHeader[] = "new,cumulative";
+
+    bool bResult = (m_pFile != nullptr) && Reserve(sizeof(szHeader) + MAX_CELL_CHARS);
+
+    if (bResult)
+    {
+        if (m_eFormat == SUITE_FORMAT::TEXT)
+        {
+            AppendUInt(nNumTuples);
+            m_rgBuffer[m_nUsed++] = '\n';
+        }
+        else
+        {
+            for (const char* p = szHeader; *p; p++)
+                m_rgBuffer[m_nUsed++] = (*p == ',') ? GetSeparator( ) : *p;
+        }
+        m_rgBuffer[m_nUsed++] = '\n';
+    }
+
+    size_t nCumulative = 0;
+
+    for (auto it : rgCurve)
+    {
+        if ((bResult = Reserve(2 * MAX_CELL_CHARS)) == false)
+            break;
+
+        nCumulative += it;
+
+        AppendUInt(it);
+        m_rgBuffer[m_nUsed++] = GetSeparator( );
+        AppendUInt(nCumulative);
+        m_rgBuffer[m_nUsed++] = '\n';
+    }
+
+    return bResult && Flush( );
+}
@@ -0,0 +1,191 @@
+/**
+ *  @file       SuiteWriter.h
+ *  @brief      CSuiteWriter class interface
+ *
+ *  Provides type definitions for: SUITE_FORMAT, CSuiteWriter
+ *
+ *  @author     Mark L. Short
+ *  @date       October 18, 2026
+ */
+#pragma once
+
+#if !defined(__SUITE_WRITER_H__)
+#define __SUITE_WRITER_H__
+
+#ifndef __COMMON_DEF_H__
+    #include "CommonDef.h"
+#endif
+
+#ifndef _LIST_
+    #include <list>
+#endif
+
+#ifndef _VECTOR_
+    #include <vector>
+#endif
+
+// forward declarations
+class CTestCase;
+
+/**
+  @brief  Output formats supported by CSuiteWriter
+*/
+enum class SUITE_FORMAT
+{
+    TEXT,       ///< row count, blank line, space separated rows (the Data/ format)
+    CSV,        ///< factor header line, comma separated rows
+    TSV         ///< factor header line, tab separated rows
+};
+
+/**
+  @brief  A buffered test suite writer
+
+  Rows are formatted directly into a large output buffer, without locales or
+  stream state, and the buffer is only handed to the C runtime once full or 
+  when explicitly flushed.  Don't-care cells are written as '*'.
+
+  The writer may target a file or stdout, in which case rows can be streamed 
+  to a pipe as they are generated.  A streamed text suite carries no row count
+  header, since the count is not known in advance.
+*/
+class CSuiteWriter
+{
+    FILE*              m_pFile;        ///< destination stream
+    bool               m_bOwnsFile;    ///< whether m_pFile is to be closed
+    SUITE_FORMAT       m_eFormat;      ///< output format
+    std::vector<char>  m_rgBuffer;     ///< pending output
+    size_t             m_nUsed;        ///< bytes of m_rgBuffer in use
+    size_t             m_nNumRows;     ///< number of rows written
+
+public:
+    /// size of the output buffer, in bytes
+    static constexpr const size_t BUFFER_SIZE = 1 << 20;
+
+    /// Default Constructor
+    CSuiteWriter() noexcept
+        : m_pFile(nullptr),
+          m_bOwnsFile(false),
+          m_eFormat(SUITE_FORMAT::TEXT),
+          m_rgBuffer(),
+          m_nUsed(0),
+          m_nNumRows(0)
+    { };
+
+    /// Destructor, flushes and closes the destination
+    ~CSuiteWriter();
+
+    CSuiteWriter(const CSuiteWriter&)            = delete;
+    CSuiteWriter& operator=(const CSuiteWriter&) = delete;
+
+/**
+  @brief  Opens a destination file
+
+  @param [in] szPath         destination path, "-" denoting stdout
+  @param [in] eFormat        output format
+
+  @retval true               on success
+  @retval false              if the file could not be created
+*/
+    bool   Open(const TCHAR* szPath, SUITE_FORMAT eFormat);
+
+/**
+  @brief  Flushes and closes the destination
+
+  @retval true               on success
+  @retval false              if any pending output could not be written
+*/
+    bool   Close(void);
+
+/**
+  @brief  Writes the format's header
+
+  @param [in] nNumRows       number of rows to follow, written in the text 
+                             format only
+  @param [in] nNumFactors    number of factors, naming the CSV/TSV columns
+
+  @retval true               on success
+  @retval false              on error
+*/
+    bool   WriteHeader(size_t nNumRows, FACTOR_T nNumFactors);
+
+/**
+  @brief  Writes a single row
+
+  @param [in] TestCase       target CTestCase object
+
+  @retval true               on success
+  @retval false              on error
+*/
+    bool   WriteRow(const CTestCase& TestCase);
+
+/**
+  @brief  Writes a complete suite, header included, and flushes it
+
+  @param [in] lstTestSuite   target collection of test cases
+
+  @retval true               on success
+  @retval false              on error
+*/
+    bool   WriteSuite(const std::list<CTestCase>& lstTestSuite);
+
+/**
+  @brief  Writes a coverage curve, and flushes it
+
+  The text format starts with the total number of tuples and a blank line,
+  the delimited formats with a column header line.  Each following line 
+  holds the tuples newly covered by a row and the cumulative number covered.
+
+  @param [in] rgCurve        newly covered tuples, indexed by row
+  @param [in] nNumTuples     total number of tuples
+
+  @retval true               on success
+  @retval false              on error
+*/
+    bool   WriteCoverageCurve(const std::vector<size_t>& rgCurve, size_t nNumTuples);
+
+/**
+  @brief  Hands all pending output to the destination
+
+  @retval true               on success
+  @retval false              on error
+*/
+    bool   Flush(void);
+
+// Primitive data accessors
+/**
+  @brief  Returns the number of rows written
+
+  @retval size_t             containing the number of rows
+*/
+    inline size_t get_NumRows(void) const noexcept
+    { return m_nNumRows; };
+
+/**
+  @brief  Indicates whether a destination is open
+
+  @retval bool               true if the writer has a destination
+*/
+    inline bool   IsOpen(void) const noexcept
+    { return m_pFile != nullptr; };
+
+private:
+/**
+  @brief  Ensures that the buffer has room for nLen more bytes
+
+  @retval true               on success
+  @retval false              if pending output could not be written
+*/
+    bool   Reserve(size_t nLen);
+
+/**
+  @brief  Appends an unsigned integer in decimal, without reserving space
+*/
+    void   AppendUInt(size_t nValue) noexcept;
+
+/**
+  @brief  Returns the cell separator of the current format
+*/
+    char   GetSeparator(void) const noexcept;
+};
+
+#endif
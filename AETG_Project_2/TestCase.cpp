@@ -10,8 +10,14 @@
 
 tostream& operator <<(tostream& os, const CTestCase& rhs)
 {
+    // don't-care cells are written as '*'
     for (auto& it : rhs)
-        os << it << _T(" ");
+    {
+        if (IsValidLevel(it))
+            os << it << _T(" ");
+        else
+            os << _T("* ");
+    }
 
     return os;
 }
@@ -40,7 +46,10 @@ CTestCase::ToString(TCHAR* szDest, size_t cchLen) const noexcept
     {
         for (auto& it : m_rgData)
         {
-            nLen += _sntprintf(&szDest[nLen], cchLen - nLen, _T("%u "), it);
+            if (IsValidLevel(it))
+                nLen += _sntprintf(&szDest[nLen], cchLen - nLen, _T("%u "), it);
+            else
+                nLen += _sntprintf(&szDest[nLen], cchLen - nLen, _T("* "));
         }
     }
 
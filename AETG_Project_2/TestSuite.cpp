@@ -7,27 +7,52 @@
 
 #include "stdafx.h"
 
-#include <random>
+#include <algorithm>
 #include "ComponentSystem.h"
+#include "Construction.h"
+#include "CoverageCount.h"
 #include "DebugUtility.h"
 #include "MathUtility.h"
+#include "ParallelUtility.h"
 
 #include "TestSuite.h"
 
-/// @todo refactor this
-extern std::mt19937       g_mt;
-/// @todo make this configurable
-const  int  T_WAY = 3;
+/**
+  @brief  Gathers the level ranges of a subset of the system's factors
+
+  @param [in]  system        CComponentSystem object, containing the inputs
+  @param [in]  rgFactors     the factors
+  @param [out] rgMinLevel    minimum level, indexed by position in rgFactors
+  @param [out] rgNumLevels   number of levels, indexed by position in rgFactors
+*/
+static void GetFactorLevels(const CComponentSystem& system, const std::vector<FACTOR_T>& rgFactors,
+                            std::vector<LEVEL_T>& rgMinLevel, std::vector<LEVEL_T>& rgNumLevels)
+{
+    rgMinLevel.clear();
+    rgNumLevels.clear();
+
+    for (auto nCurFactor : rgFactors)
+    {
+        rgMinLevel.push_back(system.GetMinLevel(nCurFactor));
+        rgNumLevels.push_back(system.GetNumLevels(nCurFactor));
+    }
+}
 
 /**
-  @brief  Returns the index of the largest level of a sequence
-  
-  @param [in] vLevels        target sequence of level values
+  @brief  Projects a test case onto a subset of its factors
 
-  @retval LEVEL_T            on success containing the index value 
-  @retval LEVEL_INVALID      on error
+  @param [in]  TestCase      the test case
+  @param [in]  rgFactors     the factors to keep
+  @param [out] Projected     the test case's levels of rgFactors, in order
 */
-LEVEL_T FindGreatestOccuringLevel(const std::vector<LEVEL_T>& vLevels);
+static void ProjectTestCase(const CTestCase& TestCase, const std::vector<FACTOR_T>& rgFactors,
+                            CTestCase& Projected)
+{
+    Projected.Init(rgFactors.size());
+
+    for (size_t i = 0; i < rgFactors.size(); i++)
+        Projected[i] = TestCase[rgFactors[i]];
+}
 
 CTestSuite::~CTestSuite( )
 {
@@ -38,12 +63,36 @@ CTestSuite::Init(const CComponentSystem& system)
 {
     m_nMaxSystemLevel = system.GetMaxSystemLevel( );
     m_nNumFactors     = system.get_NumFactors( );
+    m_nT              = system.get_Strength( );
 
     m_rgLevelCount.assign(m_nMaxSystemLevel + 1, 0);
 
     m_setUncoveredT2Tuples.clear();
-    m_setUncoveredT3Tuples.clear();
+    m_bmpUncoveredT3Tuples.Init(system, m_nT, !m_fnBaseline);
+
+    // a sub-relation no stronger than the base strength is covered anyway
+    m_rgRelations.clear();
+
+    for (auto& it : system.get_Relations())
+    {
+        if (it.nT <= m_nT)
+            continue;
+
+        std::vector<LEVEL_T> rgMinLevel;
+        std::vector<LEVEL_T> rgNumLevels;
+
+        GetFactorLevels(system, it.rgFactors, rgMinLevel, rgNumLevels);
+
+        m_rgRelations.emplace_back();
+        m_rgRelations.back().rgFactors = it.rgFactors;
+
+        if (m_rgRelations.back().bmpUncovered.Init(rgMinLevel, rgNumLevels, it.nT) == false)
+            m_rgRelations.pop_back();
+    }
     m_lstTestSuite.clear();
+    m_rgCoverageCurve.clear();
+    m_rgSeedRows.clear();
+    m_nNumSeedFactors = 0;
 };
 
 size_t 
@@ -78,52 +127,87 @@ CTestSuite::GenerateUncoveredT2Tuples(const CComponentSystem& system)
 size_t 
 CTestSuite::GenerateUncoveredT3Tuples(const CComponentSystem& system)
 {
-    m_setUncoveredT3Tuples.clear();
+    size_t nResult = 0;
 
-    m_rgLevelCount.assign(m_nMaxSystemLevel + 1, 0);
+    if (m_fnBaseline && AttachBaseline())
+    {
+        nResult = m_bmpUncoveredT3Tuples.get_NumUncovered( );
+    }
+    else
+    {
+        // the bitmap layout is calculated once by Init, it only needs to be refilled
+        if (m_bmpUncoveredT3Tuples.get_NumCombinations( ) == 0)
+            m_bmpUncoveredT3Tuples.Init(system, m_nT);
 
-    std::vector<FACTOR_T> vColumns(T_WAY);
+        m_bmpUncoveredT3Tuples.Detach( );
 
-    FACTOR_T colFactor = 0;
-    for (auto& it : vColumns)
-        it = colFactor++;
+        nResult = m_bmpUncoveredT3Tuples.Fill(m_rgLevelCount);
 
-    bool bMoreCombinations = true;
-    while( bMoreCombinations )
-    {    
-        TRange<LEVEL_T> FactorRange[T_WAY];
+        if (system.HasConstraints())
+            nResult -= ExcludeForbiddenTuples(system);
+    }
 
-        for (int i = 0; i < T_WAY; i++)
-        {
-            FactorRange[i].set_Min(system.GetMinLevel(vColumns[i]));
-            FactorRange[i].set_Max(system.GetMaxLevel(vColumns[i]));
-        }
+    // sub-relations add their own tuples to the per-level counts
+    std::vector<size_t> rgLevelCount;
 
-        for (LEVEL_T j0 = FactorRange[0].get_Min(); j0 <= FactorRange[0].get_Max(); j0++)
-        {
-            for (LEVEL_T j1 = FactorRange[1].get_Min(); j1 <= FactorRange[1].get_Max(); j1++)
-            {
-                for (LEVEL_T j2 = FactorRange[2].get_Min(); j2 <= FactorRange[2].get_Max(); j2++)
-                {
-                    auto tuple = std::make_tuple(j0, j1, j2);
+    for (auto& it : m_rgRelations)
+    {
+        nResult += it.bmpUncovered.Fill(rgLevelCount);
 
-                    auto result = m_setUncoveredT3Tuples.insert(tuple);
-#ifdef _DEBUG
-                    if (result.second == false)
-                        DebugTrace(_T("*** Attempt to insert duplicate tuple *** \n") );
-#endif
-                    m_rgLevelCount[j0] ++;
-                    m_rgLevelCount[j1] ++;
-                    m_rgLevelCount[j2] ++;
+        for (size_t n = 0; n < rgLevelCount.size(); n++)
+            m_rgLevelCount[n] += rgLevelCount[n];
+    }
 
-                }
-            }
-        }
+    return nResult;
+}
 
-        bMoreCombinations = NextCombination( vColumns.data(), vColumns.size(), m_nNumFactors);
-    }
+size_t
+CTestSuite::GetBaselineSize(void) const noexcept
+{
+    return sizeof(QWORD) * (2 + m_rgLevelCount.size() + m_bmpUncoveredT3Tuples.get_NumWords());
+}
+
+bool
+CTestSuite::WriteBaseline(const CComponentSystem& system, void* pImage, size_t cbImage)
+{
+    // a spilled bitmap is too large to be imaged
+    if (m_fnBaseline || m_bmpUncoveredT3Tuples.IsSpilled() || (pImage == nullptr) || 
+        (cbImage < GetBaselineSize()))
+        return false;
+
+    m_bmpUncoveredT3Tuples.Fill(m_rgLevelCount);
+
+    if (system.HasConstraints())
+        ExcludeForbiddenTuples(system);
 
-    return m_setUncoveredT3Tuples.size();
+    // the uncovered count and the number of level counts, the level counts
+    // and then the bitmap words
+    QWORD* pWords = static_cast<QWORD*>(pImage);
+
+    pWords[0] = m_bmpUncoveredT3Tuples.get_NumUncovered( );
+    pWords[1] = m_rgLevelCount.size( );
+
+    std::copy(m_rgLevelCount.begin(), m_rgLevelCount.end(), pWords + 2);
+    std::copy(m_bmpUncoveredT3Tuples.get_Bits(), 
+              m_bmpUncoveredT3Tuples.get_Bits() + m_bmpUncoveredT3Tuples.get_NumWords(), 
+              pWords + 2 + m_rgLevelCount.size());
+
+    return true;
+}
+
+bool
+CTestSuite::AttachBaseline(void)
+{
+    QWORD* pWords = static_cast<QWORD*>(m_fnBaseline());
+
+    if ((pWords == nullptr) || (pWords[1] != m_rgLevelCount.size()))
+        return false;
+
+    std::copy(pWords + 2, pWords + 2 + m_rgLevelCount.size(), m_rgLevelCount.begin());
+
+    return m_bmpUncoveredT3Tuples.Attach(pWords + 2 + m_rgLevelCount.size(), 
+                                         m_bmpUncoveredT3Tuples.get_NumWords(),
+                                         static_cast<size_t>(pWords[0]));
 }
 
 size_t 
@@ -161,43 +245,6 @@ CTestSuite::GenerateTestCaseT2Tuples(const CTestCase& TestCase)
     return nResult;
 }
 
-size_t 
-CTestSuite::GenerateTestCaseT3Tuples(const CTestCase& TestCase)
-{
-    m_rgTestCaseT3Tuples.clear();
-    
-    if (TestCase.GetNumValidFactors() >= T_WAY) // need at least T_WAY valid factors in the test case
-    {
-        std::vector<FACTOR_T> vColumns(T_WAY);
-        FACTOR_T colFactor = 0;
-        for (auto& it : vColumns)
-            it = colFactor++;
-
-        bool bMoreCombinations = true;
-        while (bMoreCombinations)
-        {
-            LEVEL_T nLevel1 = TestCase[vColumns[0]];
-            if (IsValidLevel(nLevel1))
-            {
-                LEVEL_T nLevel2 = TestCase[vColumns[1]];
-                if (IsValidLevel(nLevel2))
-                {
-                    LEVEL_T nLevel3 = TestCase[vColumns[2]];
-                    if (IsValidLevel(nLevel3))
-                    {
-                        auto tuple = std::make_tuple(nLevel1, nLevel2, nLevel3);
-                        m_rgTestCaseT3Tuples.push_back(tuple);
-                    }
-                }
-            }
-            bMoreCombinations = NextCombination(vColumns.data(), vColumns.size(), m_nNumFactors);
-//            bMoreCombinations = NextCombination(vColumns.data(), vColumns.size(), nNumFactors);
-        }
-    }
-
-    return m_rgTestCaseT3Tuples.size();
-}
-
 size_t 
 CTestSuite::CalculateT2TestCaseCoverage(const CTestCase& TestCase)
 {
@@ -219,12 +266,19 @@ CTestSuite::CalculateT3TestCaseCoverage(const CTestCase& TestCase)
 {
     size_t nResult = 0;
 
-    if (GenerateTestCaseT3Tuples(TestCase))
+    if (TestCase.GetNumValidFactors() >= m_nT) // need at least m_nT valid factors in the test case
     {
-        for (auto& it : m_rgTestCaseT3Tuples)
+        nResult = m_bmpUncoveredT3Tuples.CountUncovered(TestCase);
+
+        if (m_rgRelations.empty() == false)
         {
-            if (m_setUncoveredT3Tuples.find(it) != m_setUncoveredT3Tuples.end( ))
-                nResult++;
+            CTestCase Projected;
+
+            for (auto& it : m_rgRelations)
+            {
+                ProjectTestCase(TestCase, it.rgFactors, Projected);
+                nResult += it.bmpUncovered.CountUncovered(Projected);
+            }
         }
     }
     else
@@ -269,26 +323,27 @@ CTestSuite::AddToT3TestSuite(const CTestCase& TestCase)
 {
     size_t nResult = 0;
 
-    if (GenerateTestCaseT3Tuples(TestCase))
+    if (TestCase.GetNumValidFactors() >= m_nT) // need at least m_nT valid factors in the test case
     {
-        // iterate over the test case tuples and remove them from the 
-        // uncovered tuple set
-        for (auto& it : m_rgTestCaseT3Tuples)
-        {
-            if (m_setUncoveredT3Tuples.erase(it) > 0)
-            {
-                int iLvl = std::get<0>(it);
-                m_rgLevelCount[iLvl] --;
+        // clear the test case tuples from the uncovered tuple bitmap
+        size_t nCovered = m_bmpUncoveredT3Tuples.Cover(TestCase, m_rgLevelCount);
 
-                iLvl = std::get<1>(it);
-                m_rgLevelCount[iLvl] --;
+        if (m_rgRelations.empty() == false)
+        {
+            CTestCase Projected;
 
-                iLvl = std::get<2>(it);
-                m_rgLevelCount[iLvl] --;
+            for (auto& it : m_rgRelations)
+            {
+                ProjectTestCase(TestCase, it.rgFactors, Projected);
+                nCovered += it.bmpUncovered.Cover(Projected, m_rgLevelCount);
             }
         }
 
         m_lstTestSuite.push_back(TestCase);
+        m_rgCoverageCurve.push_back(nCovered);
+
+        if (m_fnRowSink && !m_bAbandoned && (m_fnRowSink(TestCase) == false))
+            m_bAbandoned = true;
         nResult = m_lstTestSuite.size();
     }
 
@@ -296,291 +351,941 @@ CTestSuite::AddToT3TestSuite(const CTestCase& TestCase)
 }
 
 
-LEVEL_T 
-FindGreatestOccuringLevel(const std::vector<LEVEL_T>& vLevels)
+size_t
+CTestSuite::SetSeedSuite(const CComponentSystem& system, const std::vector<LEVEL_T>& rgMinLevel,
+                         const std::vector<LEVEL_T>& rgNumLevels, 
+                         const std::list<CTestCase>& lstSeedSuite)
+{
+    m_rgSeedRows.clear();
+    m_nNumSeedFactors = static_cast<FACTOR_T>(std::min<size_t>(rgMinLevel.size(), m_nNumFactors));
+
+    for (auto& it : lstSeedSuite)
+    {
+        CTestCase TestCase;
+        TestCase.Init(m_nNumFactors);
+
+        FACTOR_T nNumFactors = static_cast<FACTOR_T>(std::min<size_t>(m_nNumSeedFactors, it.get_Size()));
+
+        for (FACTOR_T nCurFactor = 0; nCurFactor < nNumFactors; nCurFactor++)
+        {
+            LEVEL_T nLevel = it[nCurFactor];
+
+            if (IsValidLevel(nLevel) && (nLevel >= rgMinLevel[nCurFactor]))
+            {
+                // the level is carried over by its position within the factor
+                LEVEL_T nOffset   = nLevel - rgMinLevel[nCurFactor];
+                LEVEL_T nNewLevel = system.GetMinLevel(nCurFactor) + nOffset;
+
+                if ((nOffset < rgNumLevels[nCurFactor]) && (nNewLevel <= system.GetMaxLevel(nCurFactor)))
+                    TestCase[nCurFactor] = nNewLevel;
+            }
+        }
+
+        // a seed test case holding a forbidden tuple gives up one of its cells
+        system.get_Constraints().ReleaseForbidden(TestCase);
+
+        m_rgSeedRows.push_back(TestCase);
+    }
+
+    return m_rgSeedRows.size();
+}
+
+size_t
+CTestSuite::GenerateTestSuite(const CComponentSystem& system)
+{
+    CTestCase Candidate;
+
+    ClearTestSuite( );
+    GenerateUncoveredT3Tuples(system);
+
+    // a construction leaves at most a few tuples for the search to top up
+    if (AddConstructedTestCases(system) > 0)
+    {
+        CoverRemainingTuples(system);
+        return get_TestSuiteSize( );
+    }
+
+#ifdef _DEBUG
+    TCHAR szBuffer[256] = { 0 };
+#endif
+
+    const CConstraintSet& constraints = system.get_Constraints( );
+
+    if (m_rgSeedRows.empty( ) == false)
+    {
+        AddSeedTestCases(system);
+    }
+    else
+    {
+        // either of the extreme test cases may well be forbidden
+        GenerateMinLevelCandidate(system, Candidate);
+#ifdef _DEBUG
+        DebugTrace(_T(" Min) Best ( %s), UC Tuples Covered: %d \n"),
+                   Candidate.ToString(szBuffer, _countof(szBuffer)),
+                   CalculateT3TestCaseCoverage(Candidate));
+#endif
+        if (constraints.IsForbidden(Candidate) == false)
+            AddToT3TestSuite(Candidate);
+
+        GenerateMaxLevelCandidate(system, Candidate);
+#ifdef _DEBUG
+        DebugTrace(_T(" Max) Best ( %s), UC Tuples Covered: %d \n"),
+                   Candidate.ToString(szBuffer, _countof(szBuffer)),
+                   CalculateT3TestCaseCoverage(Candidate));
+#endif
+        if (constraints.IsForbidden(Candidate) == false)
+            AddToT3TestSuite(Candidate);
+    }
+
+    CoverRemainingTuples(system);
+
+    return get_TestSuiteSize( );
+}
+
+size_t
+CTestSuite::CoverRemainingTuples(const CComponentSystem& system)
+{
+    size_t    nResult = 0;
+    CTestCase Candidate;
+
+#ifdef _DEBUG
+    TCHAR szBuffer[256] = { 0 };
+#endif
+
+    while ((get_NumUncoveredT3Tuples() > 0) && (IsAbandoned() == false))
+    {
+        size_t nCoverage = GenerateTestCase(system, Candidate);
+
+        // an engine's candidate may cover nothing, and under constraints or
+        // sub-relations may leave factors unassigned, break a constraint or 
+        // cover only the tuples the engine doesn't look at, in which case it
+        // is rebuilt around an uncovered tuple
+        if ((nCoverage == 0) ||
+            ((system.HasConstraints() || (m_rgRelations.empty() == false)) && 
+             ((Candidate.GetNumValidFactors() < m_nNumFactors) || 
+              system.get_Constraints().IsForbidden(Candidate))))
+        {
+            nCoverage = GenerateFeasibleTestCase(system, Candidate);
+
+            if (nCoverage == 0)
+                continue;       // only tuples no valid test case can hold were left
+        }
+
+        AddToT3TestSuite(Candidate);
+        nResult++;
+
+        if (m_fnCheckpoint)
+            m_fnCheckpoint( );
+
+#ifdef _DEBUG
+        DebugTrace(_T("Best ( %s), UC Tuples Covered: %d Remaining: %d SuiteSize: %d\n"), 
+                   Candidate.ToString(szBuffer, _countof(szBuffer)),
+                   nCoverage, 
+                   get_NumUncoveredT3Tuples(), 
+                   get_TestSuiteSize() );
+#else
+        (void) nCoverage;
+#endif
+    }
+
+    return nResult;
+}
+
+void
+CTestSuite::SaveState(GENERATION_STATE& state) const
+{
+    state.lstTestSuite    = m_lstTestSuite;
+    state.rgCoverageCurve = m_rgCoverageCurve;
+    state.rgLevelCount    = m_rgLevelCount;
+    state.nNumUnresolved  = m_nNumUnresolved;
+
+    state.rgNumUncovered.assign(1, m_bmpUncoveredT3Tuples.get_NumUncovered( ));
+    state.rgRuns.resize(m_rgRelations.size() + 1);
+
+    m_bmpUncoveredT3Tuples.EncodeRuns(state.rgRuns[0]);
+
+    for (size_t n = 0; n < m_rgRelations.size(); n++)
+    {
+        state.rgNumUncovered.push_back(m_rgRelations[n].bmpUncovered.get_NumUncovered( ));
+        m_rgRelations[n].bmpUncovered.EncodeRuns(state.rgRuns[n + 1]);
+    }
+}
+
+bool
+CTestSuite::ResumeTestSuite(const CComponentSystem& system, const GENERATION_STATE& state)
+{
+    ClearTestSuite( );
+
+    // the bitmaps are filled first, so that they hold storage to decode into
+    GenerateUncoveredT3Tuples(system);
+
+    bool bResult = (state.rgLevelCount.size()    == m_rgLevelCount.size()) &&
+                   (state.rgRuns.size()          == m_rgRelations.size() + 1) &&
+                   (state.rgNumUncovered.size()  == state.rgRuns.size()) &&
+                   (state.rgCoverageCurve.size() == state.lstTestSuite.size()) &&
+                   m_bmpUncoveredT3Tuples.DecodeRuns(state.rgRuns[0], state.rgNumUncovered[0]);
+
+    for (size_t n = 0; bResult && (n < m_rgRelations.size()); n++)
+        bResult = m_rgRelations[n].bmpUncovered.DecodeRuns(state.rgRuns[n + 1], state.rgNumUncovered[n + 1]);
+
+    for (auto it = state.lstTestSuite.begin(); bResult && (it != state.lstTestSuite.end()); ++it)
+        bResult = (it->get_Size() == m_nNumFactors);
+
+    if (bResult == false)
+    {
+        GenerateUncoveredT3Tuples(system);
+        return false;
+    }
+
+    m_rgLevelCount    = state.rgLevelCount;
+    m_nNumUnresolved  = state.nNumUnresolved;
+    m_lstTestSuite    = state.lstTestSuite;
+    m_rgCoverageCurve = state.rgCoverageCurve;
+
+    CoverRemainingTuples(system);
+
+    return true;
+}
+
+size_t
+CTestSuite::ReduceTestSuite(const CComponentSystem& system)
 {
-    LEVEL_T nResult        = LEVEL_INVALID;
+    typedef std::list<CTestCase>::iterator TEST_CASE_ITER;
+
+    size_t         nResult = 0;
+    CCoverageCount cntTuples;
 
-    int     iMaxLevelCount = 0;
-    int     iNumLevels     = vLevels.size();
-    int     iRandomMod     = 2;
+    // sub-relations are counted over their own factors, each test case being
+    // projected onto them
+    std::vector<CCoverageCount> rgRelationCounts(m_rgRelations.size());
+    CTestCase                   Projected;
 
-    for (int i = 0; i < iNumLevels; i++)
+    for (size_t n = 0; n < m_rgRelations.size(); n++)
     {
-        if (vLevels[i] > iMaxLevelCount)
+        std::vector<LEVEL_T> rgMinLevel;
+        std::vector<LEVEL_T> rgNumLevels;
+
+        GetFactorLevels(system, m_rgRelations[n].rgFactors, rgMinLevel, rgNumLevels);
+        rgRelationCounts[n].Init(rgMinLevel, rgNumLevels, m_rgRelations[n].bmpUncovered.get_T());
+    }
+
+    auto IsRedundant = [&](const CTestCase& TestCase, size_t* pNumCritical) -> bool
+    {
+        bool bResult = cntTuples.IsRedundant(TestCase, pNumCritical);
+
+        for (size_t n = 0; (n < m_rgRelations.size()) && bResult; n++)
         {
-            iMaxLevelCount = vLevels[i];
-            nResult        = i;
+            size_t nNumCritical = 0;
+
+            ProjectTestCase(TestCase, m_rgRelations[n].rgFactors, Projected);
+            bResult = rgRelationCounts[n].IsRedundant(Projected, &nNumCritical);
+
+            if (pNumCritical)
+                *pNumCritical += nNumCritical;
+        }
+
+        return bResult;
+    };
+
+    if (cntTuples.Init(system, m_nT))
+    {
+        for (auto& it : m_lstTestSuite)
+        {
+            cntTuples.Add(it);
+
+            for (size_t n = 0; n < m_rgRelations.size(); n++)
+            {
+                ProjectTestCase(it, m_rgRelations[n].rgFactors, Projected);
+                rgRelationCounts[n].Add(Projected);
+            }
+        }
+
+        std::vector<std::pair<size_t, TEST_CASE_ITER>> rgCandidates;
+
+        // seed test cases keep their place at the start of the suite
+        auto itFirst = m_lstTestSuite.begin();
+        std::advance(itFirst, std::min(m_nNumSeedRowsAdded, m_lstTestSuite.size()));
+
+        for (auto it = itFirst; it != m_lstTestSuite.end(); ++it)
+        {
+            size_t nNumCritical = 0;
+
+            if (IsRedundant(*it, &nNumCritical))
+                rgCandidates.emplace_back(nNumCritical, it);
         }
-        else if ((vLevels[i] == iMaxLevelCount) && (vLevels[i] > 0))
-        {   // some level of randomization to mix things up a bit
-            if ((rand() % iRandomMod) == 0)
+
+        // removing the candidates with the fewest critical tuples first 
+        // leaves the most room for the remaining candidates
+        std::stable_sort(rgCandidates.begin(), rgCandidates.end(),
+                         [](const std::pair<size_t, TEST_CASE_ITER>& lhs, 
+                            const std::pair<size_t, TEST_CASE_ITER>& rhs)
+                         { return lhs.first < rhs.first; });
+
+        for (auto& it : rgCandidates)
+        {
+            if (IsRedundant(*it.second, nullptr))
             {
-                nResult = i;
-                iRandomMod ++;
+                cntTuples.Remove(*it.second);
+
+                for (size_t n = 0; n < m_rgRelations.size(); n++)
+                {
+                    ProjectTestCase(*it.second, m_rgRelations[n].rgFactors, Projected);
+                    rgRelationCounts[n].Remove(Projected);
+                }
+
+                m_lstTestSuite.erase(it.second);
+                nResult++;
             }
         }
+
+        if (nResult > 0)
+            RecalcCoverageCurve(system);
     }
 
     return nResult;
 }
 
-/**
-    In AETG, covering arrays are constructed one row at a time. To generate a 
-    row, the first t-tuple is selected based on the one involved in most uncovered
-    pairs. Remaining factors are assigned levels in a random order. Levels are
-    selected based on the one that covers the most new t-tuples. For each row that 
-    is actually added to the covering array, there are a number, M, candidate rows 
-    that are generated and only a candidate that covers the most new t-tuples is 
-    added to the covering array. Once a covering is constructed, a number, R, of 
-    test suites are generated and the smallest test suite generated is reported. 
-    This process continues until all pairs are covered.
-
-<b> AETG Example 1: </b>
-
-1 begin
-2   set MinArray to ∞
-3   for i ← 1 to R [number of test suites] do
-4       start with no tests in T
-5       N ← ∞
-6       while there are uncovered t-tuples in T do
-7           start with an empty test C and an empty test BestCandidate
-8           for j ← 1 to M [candidate rows] do
-9               select the first pair that appears in the largest number of uncovered pairs
-10              while free factors remain do
-11                  randomly select a factor f
-12                  select a level v that is in the largest number of uncovered pairs with uniform factors
-13              end while
-14              if C covers more t-tuples than BestCandidate then
-15                  BestCandidate ← C
-16              end if
-17          end for
-18          add test BestCandidate to T
-19          N ← N + 1
-20      end while
-21      if T has N < MinArray tests then
-22          MinArray ← N
-23          BestArray ← T
-24      end if
-25  end for
-26 end
-
-<b> AETG Example 2: </b>
-
-1. initialize test set TS to be an empty set
-2. let UC be the set of all t-way combinations to be covered
-3. while (UC is not empty) 
-    {
-4.    let p,v be the parameter value that appears the most number of times in UC
-5.    // generate m candidates
-6.    for (int i = 0; i < m; i++) 
+size_t
+CTestSuite::MergeTestSuite(const CComponentSystem& system)
+{
+    size_t         nResult = 0;
+    CCoverageCount cntTuples;
+
+    // a cell would have to be checked against every sub-relation it is part
+    // of as well, which is not supported
+    if (m_rgRelations.empty() && cntTuples.Init(system, m_nT))
+    {
+        for (auto& it : m_lstTestSuite)
+            cntTuples.Add(it);
+
+        for (auto it = m_lstTestSuite.begin(); it != m_lstTestSuite.end(); )
         {
-7.        let p be the 1st parameter, and reorder all other parameters randomly,
-              denote the reordered parameters as p1, p2, ... pk.
-8.        // select values for each candidate
-9.        for (int j = 1; j <= k; j++) 
-              {
-10.          select a value for the j-th parameter pj such that the most uncovered
-               combinations can be covered
-11.           }
-12.       }
-13. select a test r from m candidates such that it covers the most uncovered combinations
-14. add r into ts and remove from UC the set of combinations covered by r
-15. }
-16. return ts
+            CTestCase& TestCase = *it;
 
-*/
-size_t 
-CTestSuite::GenerateT2TestCaseCandidate(const CComponentSystem& system, CTestCase& Candidate)
+            for (FACTOR_T nCurFactor = 0; nCurFactor < m_nNumFactors; nCurFactor++)
+            {
+                if (IsValidLevel(TestCase[nCurFactor]) == false)
+                    continue;
+
+                bool bRequired = false;
+
+                cntTuples.ForEachCombination(nCurFactor, [&](const FACTOR_T* rgColumns)
+                    {
+                        size_t nPos = 0;
+
+                        if (!bRequired && cntTuples.GetTuplePos(rgColumns, TestCase, nPos))
+                            bRequired = (cntTuples.GetCount(nPos) <= 1);
+                    });
+
+                // under constraints, a don't-care must admit every level, 
+                // since whoever runs the test may pick any of them
+                if (bRequired ||
+                    (system.HasConstraints() &&
+                     !system.get_Constraints().CanRelease(TestCase, nCurFactor, 
+                                                          system.GetMinLevel(nCurFactor),
+                                                          system.GetNumLevels(nCurFactor))))
+                    continue;
+
+                // release the cell, which drops every tuple it takes part in
+                cntTuples.ForEachCombination(nCurFactor, [&](const FACTOR_T* rgColumns)
+                    {
+                        size_t nPos = 0;
+
+                        if (cntTuples.GetTuplePos(rgColumns, TestCase, nPos))
+                            cntTuples.Decrement(nPos);
+                    });
+
+                TestCase[nCurFactor] = LEVEL_INVALID;
+            }
+
+            if (TestCase.GetNumValidFactors( ) == 0)
+            {
+                it = m_lstTestSuite.erase(it);
+                nResult++;
+            }
+            else
+                ++it;
+        }
+
+        for (auto itDest = m_lstTestSuite.begin(); itDest != m_lstTestSuite.end(); ++itDest)
+        {
+            auto it = std::next(itDest);
+
+            while (it != m_lstTestSuite.end())
+            {
+                if (IsCompatible(*itDest, *it) && 
+                    (!system.HasConstraints() || IsMergeFeasible(system, *itDest, *it)))
+                {
+                    for (FACTOR_T nCurFactor = 0; nCurFactor < m_nNumFactors; nCurFactor++)
+                    {
+                        if (IsValidLevel((*it)[nCurFactor]))
+                            (*itDest)[nCurFactor] = (*it)[nCurFactor];
+                    }
+
+                    it = m_lstTestSuite.erase(it);
+                    nResult++;
+                }
+                else
+                    ++it;
+            }
+        }
+
+        RecalcCoverageCurve(system);
+    }
+
+    return nResult;
+}
+
+size_t
+CTestSuite::CoverNewTuples(const CTestCase& TestCase, FACTOR_T nFactor)
 {
     size_t   nResult = 0;
 
-    if (m_nNumFactors > 1) // no reason to go further if we don't have at least 2 factors
+    FACTOR_T rgOthers [MAX_T_WAY];
+    FACTOR_T rgColumns[MAX_T_WAY];
+    LEVEL_T  rgLevels [MAX_T_WAY];
+
+    ResetOthers(rgOthers);
+    do
     {
-        // initialize the candidate
-        Candidate.Init(m_nNumFactors);
+        MakeColumns(rgOthers, nFactor, rgColumns);
+
+        bool bValid = true;
+        for (WORD i = 0; (i < m_nT) && bValid; i++)
+        {
+            rgLevels[i] = TestCase[rgColumns[i]];
+            bValid      = IsValidLevel(rgLevels[i]);
+        }
+
+        if (bValid && m_bmpUncoveredT3Tuples.CoverTuple(rgColumns, rgLevels, m_rgLevelCount))
+            nResult++;
+
+    } while (NextCombination(rgOthers, m_nT - 1, nFactor));
+
+    return nResult;
+}
+
+LEVEL_T
+CTestSuite::ScoreTestCase(const CComponentSystem& system, const CTestCase& TestCase, 
+                          FACTOR_T nFactor, LEVEL_T nMinLevel, LEVEL_T nNumLevels, 
+                          size_t& nBestCoverage) const
+{
+    LEVEL_T             nResult = LEVEL_INVALID;
+    std::vector<size_t> rgCounts(nNumLevels, 0);
+
+    FACTOR_T rgOthers [MAX_T_WAY];
+    FACTOR_T rgColumns[MAX_T_WAY];
+
+    ResetOthers(rgOthers);
+    do
+    {
+        MakeColumns(rgOthers, nFactor, rgColumns);
+        m_bmpUncoveredT3Tuples.CountLastColumnLevels(rgColumns, TestCase, rgCounts);
+
+    } while (NextCombination(rgOthers, m_nT - 1, nFactor));
+
+    // the lowest level wins any ties, and a test case which can't cover 
+    // anything is left as a don't-care for vertical growth to make use of
+    nBestCoverage = 0;
+
+    const CConstraintSet& constraints = system.get_Constraints( );
+    std::vector<QWORD>    rgBlocking;
+
+    if (system.HasConstraints())
+        constraints.GetBlockingMask(TestCase, nFactor, rgBlocking);
+
+    for (LEVEL_T n = 0; n < nNumLevels; n++)
+    {
+        if (system.HasConstraints() && !constraints.IsFeasible(rgBlocking, nMinLevel + n))
+            continue;
+
+        if (rgCounts[n] > nBestCoverage)
+        {
+            nBestCoverage = rgCounts[n];
+            nResult       = nMinLevel + n;
+        }
+    }
 
-        //  1. Choose a parameter f and a value l for f such that that parameter 
-        //     value appears in the greatest number of uncovered pairs.
+    return nResult;
+}
 
-        LEVEL_T  nBestLevel  = FindGreatestOccuringLevel(m_rgLevelCount);
-        FACTOR_T nCurFactor  = system.GetFactor(nBestLevel);
-        //   DebugTrace (_T("Greatest Occuring (Factor,Level): (%d, %d) \n"), nFactor, nLevel);
-        Candidate[nCurFactor]  = nBestLevel;
+size_t
+CTestSuite::CountNewTuples(const CTestCase& TestCase, FACTOR_T nFactor) const
+{
+    size_t   nResult = 0;
 
-        //  2. Let f1 = f. Then choose a random order for the remaining parameters. 
-        //     Then we have an order for all k parameters f1, ... fk.
+    FACTOR_T rgOthers [MAX_T_WAY];
+    FACTOR_T rgColumns[MAX_T_WAY];
+    LEVEL_T  rgLevels [MAX_T_WAY];
 
-        std::vector<FACTOR_T> vFactorOrder;
-        //  randomize factor order
-        system.GetShuffledFactors(vFactorOrder);
+    ResetOthers(rgOthers);
+    do
+    {
+        MakeColumns(rgOthers, nFactor, rgColumns);
 
-        for (size_t i = 0; i < vFactorOrder.size( ); i++)
+        bool bValid = true;
+        for (WORD i = 0; (i < m_nT) && bValid; i++)
         {
-            nCurFactor = vFactorOrder[i];
-            // verify to make sure we have not already included it in our candidate
-            if (IsValidLevel(Candidate[nCurFactor]) == false)
+            rgLevels[i] = TestCase[rgColumns[i]];
+            bValid      = IsValidLevel(rgLevels[i]);
+        }
+
+        if (bValid && m_bmpUncoveredT3Tuples.IsUncovered(rgColumns, rgLevels))
+            nResult++;
+
+    } while (NextCombination(rgOthers, m_nT - 1, nFactor));
+
+    return nResult;
+}
+
+size_t
+CTestSuite::ExtendHorizontal(const CComponentSystem& system, FACTOR_T nFactor,
+                             std::vector<CTestCase>& rgRows)
+{
+    size_t  nResult    = 0;
+    LEVEL_T nMinLevel  = system.GetMinLevel(nFactor);
+    LEVEL_T nNumLevels = system.GetMaxLevel(nFactor) - nMinLevel + 1;
+
+    // only test cases with a don't-care level for the factor are extended, 
+    // leaving the levels of a seed suite as they are
+    std::vector<size_t> rgOpenRows;
+
+    for (size_t nRow = 0; nRow < rgRows.size( ); nRow++)
+    {
+        if (IsValidLevel(rgRows[nRow][nFactor]) == false)
+            rgOpenRows.push_back(nRow);
+    }
+
+    size_t nNumRows = rgOpenRows.size( );
+
+    // test cases in a batch are scored concurrently against the same snapshot
+    // of the uncovered tuples, then committed in order.  With a single worker
+    // thread this reduces to the classic sequential IPOG.
+    size_t               nBatchSize = GetNumWorkerThreads( );
+    std::vector<LEVEL_T> rgChoice  (nBatchSize, LEVEL_INVALID);
+    std::vector<size_t>  rgCoverage(nBatchSize, 0);
+
+    for (size_t nFirst = 0; nFirst < nNumRows; nFirst += nBatchSize)
+    {
+        size_t nLast = std::min(nNumRows, nFirst + nBatchSize);
+
+        ParallelForRange(nFirst, nLast, 1, 
+            [&](size_t nBegin, size_t nEnd, unsigned int /* nPartition */)
             {
-                // now we need to determine which of the levels for this factor
-                // will cover the greatest number of uncovered t-tuples
-                LEVEL_T nMinFactorLevel = system.GetMinLevel(nCurFactor);
-                LEVEL_T nMaxFactorLevel = system.GetMaxLevel(nCurFactor);
+                for (size_t n = nBegin; n < nEnd; n++)
+                    rgChoice[n - nFirst] = ScoreTestCase(system, rgRows[rgOpenRows[n]], nFactor, 
+                                                         nMinLevel, nNumLevels, rgCoverage[n - nFirst]);
+            });
 
-                nBestLevel = LEVEL_INVALID;
-                size_t nCoverage     = 0;
-                size_t nBestCoverage = 0;
-                int    iRandomMod    = 2;
+        for (size_t n = nFirst; n < nLast; n++)
+        {
+            CTestCase& TestCase = rgRows[rgOpenRows[n]];
+            LEVEL_T    nLevel   = rgChoice[n - nFirst];
+
+            if (IsValidLevel(nLevel))
+            {
+                TestCase[nFactor] = nLevel;
 
-                for (int j = nMinFactorLevel; j <= nMaxFactorLevel; j++)
+                // an earlier test case of the batch may have covered some of
+                // the same tuples, in which case the score is stale
+                if (CountNewTuples(TestCase, nFactor) < rgCoverage[n - nFirst])
                 {
-                    Candidate[nCurFactor] = j;
-                    nCoverage = CalculateT2TestCaseCoverage(Candidate);
+                    size_t nCoverage  = 0;
 
-                    if (nCoverage > nBestCoverage)
-                    {
-                        nBestCoverage = nCoverage;
-                        nBestLevel    = j;         // identify the level with the best coverage
-                        nResult       = nCoverage; // return best coverage value to caller
-                    }
-                    else if (nCoverage == nBestCoverage)
-                    {  // let's randomly determine who is going to be considered the highest
-                        if (( rand( ) % iRandomMod ) == 0)
-                        {
-                            nBestLevel = j;
-                            iRandomMod++;
-                        }
-                    }
+                    TestCase[nFactor] = LEVEL_INVALID;
+                    TestCase[nFactor] = ScoreTestCase(system, TestCase, nFactor, nMinLevel, 
+                                                      nNumLevels, nCoverage);
                 }
 
-                // if we didn't find a level needing to be covered, go
-                // ahead and assign something reasonable for the level
-                if (IsValidLevel(nBestLevel) == false)
-                    nBestLevel = nMinFactorLevel;
+                if (IsValidLevel(TestCase[nFactor]))
+                    nResult += CoverNewTuples(TestCase, nFactor);
+            }
+        }
+    }
+
+    return nResult;
+}
+
+bool
+CTestSuite::CanConstructTestSuite(const CComponentSystem& system) const
+{
+    if (!m_bUseConstructions || !m_rgSeedRows.empty( ))
+        return false;
+
+    // a recursive construction is complete, but no better than a search
+    return CanConstructOrthogonalArray(system);
+}
+
+size_t
+CTestSuite::AddConstructedTestCases(const CComponentSystem& system)
+{
+    std::vector<CTestCase> rgRows;
+
+    if (!m_bUseConstructions || !m_rgSeedRows.empty( ))
+        return 0;
+
+    if (ConstructOrthogonalArray(system, rgRows) > 0)
+    {
+        for (const auto& it : rgRows)
+            AddToT3TestSuite(it);
+
+        return rgRows.size();
+    }
+
+    if (!m_bUseRecursive || (m_Construction.Construct(system, rgRows) == 0))
+        return 0;
 
-                Candidate[nCurFactor] = nBestLevel;
+    // under constraints the cells of forbidden tuples are released, to be 
+    // searched for again along with any factors the construction left over
+    if (system.HasConstraints())
+    {
+        for (auto& it : rgRows)
+            system.get_Constraints().ReleaseForbidden(it);
+    }
+
+    return ExtendTestCases(system, rgRows, false);
+}
+
+size_t
+CTestSuite::AddSeedTestCases(const CComponentSystem& system)
+{
+    m_nNumSeedRowsAdded = ExtendTestCases(system, m_rgSeedRows, true);
+
+    return m_nNumSeedRowsAdded;
+}
+
+size_t
+CTestSuite::ExtendTestCases(const CComponentSystem& system, std::vector<CTestCase> rgRows,
+                            bool bKeepIncomplete)
+{
+    // the tuples of the seed are covered in bulk, after which each new factor
+    // is added to every test case in turn.  Any level still undecided, be it 
+    // one the system no longer has or one which covers nothing new, becomes 
+    // the factor's minimum level, or under constraints any feasible level.
+    for (auto& it : rgRows)
+        m_bmpUncoveredT3Tuples.Cover(it, m_rgLevelCount);
+
+    for (FACTOR_T nCurFactor = 0; nCurFactor < m_nNumFactors; nCurFactor++)
+    {
+        if (nCurFactor >= m_nT - 1)
+            ExtendHorizontal(system, nCurFactor, rgRows);
+
+        for (auto& it : rgRows)
+        {
+            if (!system.HasConstraints() && (IsValidLevel(it[nCurFactor]) == false))
+                it[nCurFactor] = system.GetMinLevel(nCurFactor);
+        }
+    }
+
+    // a seed test case which can not be completed keeps its don't-care levels,
+    // any other is dropped
+    if (system.HasConstraints())
+    {
+        size_t nNumKept = 0;
+
+        for (size_t n = 0; n < rgRows.size(); n++)
+        {
+            if ((CompleteTestCase(system, rgRows[n]) == COMPLETION_RESULT::FOUND) || bKeepIncomplete)
+            {
+                if (nNumKept != n)
+                    rgRows[nNumKept] = std::move(rgRows[n]);
+                nNumKept++;
             }
         }
+
+        rgRows.resize(nNumKept);
+    }
+
+    // the coverage bookkeeping is rebuilt as the completed test cases are 
+    // added, so the coverage curve reflects each one in turn
+    GenerateUncoveredT3Tuples(system);
+
+    size_t nResult = 0;
+
+    for (auto& it : rgRows)
+    {
+        if (AddToT3TestSuite(it) > 0)
+            nResult++;
     }
 
     return nResult;
 }
 
-size_t 
-CTestSuite::GenerateT3TestCaseCandidate(const CComponentSystem& system, CTestCase& Candidate)
+void
+CTestSuite::RecalcCoverageCurve(const CComponentSystem& system)
 {
-    size_t   nResult = 0;
+    GenerateUncoveredT3Tuples(system);
 
-    if (m_nNumFactors > 2) // no reason to go further if we don't have at least 3 factors
+    m_rgCoverageCurve.clear();
+    m_rgCoverageCurve.reserve(m_lstTestSuite.size());
+
+    CTestCase Projected;
+
+    for (auto& it : m_lstTestSuite)
     {
-        // initialize the candidate
-        Candidate.Init(m_nNumFactors);
+        size_t nCovered = m_bmpUncoveredT3Tuples.Cover(it, m_rgLevelCount);
 
-        //  1. Choose a parameter f and a value l for f such that that parameter value appears 
-        //     in the greatest number of uncovered pairs.
+        for (auto& itRelation : m_rgRelations)
+        {
+            ProjectTestCase(it, itRelation.rgFactors, Projected);
+            nCovered += itRelation.bmpUncovered.Cover(Projected, m_rgLevelCount);
+        }
 
-        LEVEL_T  nBestLevel = FindGreatestOccuringLevel(m_rgLevelCount);
+        m_rgCoverageCurve.push_back(nCovered);
+    }
+}
 
-#ifdef _DEBUG
-        if (IsValidLevel(nBestLevel) == false)
-            DebugTrace (_T("*** FindGreatestOccuringLevel - LEVEL_INVALID \n") );
-#endif
-        FACTOR_T nCurFactor = system.GetFactor(nBestLevel);
+size_t
+CTestSuite::ExcludeForbiddenTuples(const CComponentSystem& system)
+{
+    size_t                nResult     = 0;
+    const CConstraintSet& constraints = system.get_Constraints( );
 
-#ifdef _DEBUG
-//      DebugTrace (_T("  Greatest Occuring (Factor,Level): (%d, %d) \n"), nCurFactor, nBestLevel);
-#endif
-        Candidate[nCurFactor] = nBestLevel;
+    FACTOR_T rgPick   [MAX_T_WAY];
+    FACTOR_T rgColumns[MAX_T_WAY];
+    LEVEL_T  rgLevels [MAX_T_WAY];
+    bool     rgIsFree [MAX_T_WAY];
+
+    for (size_t nTuple = 0; nTuple < constraints.get_NumTuples( ); nTuple++)
+    {
+        // a forbidden tuple of higher arity rules out test cases, not t-way tuples
+        size_t nArity = constraints.GetArity(nTuple);
+
+        if (nArity > m_nT)
+            continue;
+
+        const FACTOR_T* rgFixed       = constraints.GetFactors(nTuple);
+        const LEVEL_T*  rgFixedLevels = constraints.GetLevels(nTuple);
+
+        // the remaining columns of each t-way tuple are drawn from the other 
+        // factors, taking every combination of their levels
+        std::vector<FACTOR_T> rgOthers;
 
-        //  2. Let f1 = f. Then choose a random order for the remaining parameters. Then we have 
-        //     an order for all k parameters f1, ... fk.
+        for (FACTOR_T nCurFactor = 0; nCurFactor < m_nNumFactors; nCurFactor++)
+        {
+            if (std::find(rgFixed, rgFixed + nArity, nCurFactor) == rgFixed + nArity)
+                rgOthers.push_back(nCurFactor);
+        }
+
+        WORD nFree = static_cast<WORD>(m_nT - nArity);
 
-        std::vector<FACTOR_T> vFactorOrder;
-        //  randomize factor order
-        system.GetShuffledFactors(vFactorOrder);
+        if (rgOthers.size() < nFree)
+            continue;
 
-        for (size_t i = 0; i < vFactorOrder.size(); i++)
+        for (WORD i = 0; i < nFree; i++)
+            rgPick[i] = i;
+
+        do
         {
-            nCurFactor = vFactorOrder[i];
-            // verify to make sure we have not already included it in our candidate
-            if (IsValidLevel(Candidate[nCurFactor]) == false)
+            for (size_t i = 0, j = 0, n = 0; n < m_nT; n++)
             {
-                // now we need to determine which of the levels for this factor
-                // will cover the greatest number of uncovered t-tuples
-                LEVEL_T nMinFactorLevel = system.GetMinLevel(nCurFactor);
-                LEVEL_T nMaxFactorLevel = system.GetMaxLevel(nCurFactor);
-                size_t  nCoverage       = 0;
-                size_t  nBestCoverage   = 0;
-                int     iRandomMod      = 2;
-                nBestLevel     = LEVEL_INVALID;
-                // Check to see if the Candidate has T_WAY-1 number of valid factors assigned
-                if (Candidate.GetNumValidFactors() < T_WAY-1)
-                {  // no?
-                   // then just iterate over the min..max levels for the factor
-                   // and assign the one that has the highest level count
-                    
-                    for (int n = nMinFactorLevel; n < nMaxFactorLevel; n++)
-                    {
-                        if (m_rgLevelCount[n] > nBestCoverage)
-                        {
-                            nBestLevel    = n;
-                            nBestCoverage = m_rgLevelCount[nBestLevel];
-                        }
-                        else if ((m_rgLevelCount[n] == nBestCoverage) && (nBestCoverage > 0))
-                        {// let's randomly determine who is going to be considered the highest
-                            if (( rand() % iRandomMod ) == 0)
-                            {
-                                nBestLevel = n;
-                                iRandomMod++;
-                            }
-                        }
-                    }
-                    if (IsValidLevel(nBestLevel) == false)
-                    {
-                        std::uniform_int_distribution<LEVEL_T>  dist(nMinFactorLevel, nMaxFactorLevel);
-                        nBestLevel = dist(g_mt);
-                    }
+                rgIsFree[n]  = (j < nFree) && ((i == nArity) || (rgOthers[rgPick[j]] < rgFixed[i]));
+                rgColumns[n] = rgIsFree[n] ? rgOthers[rgPick[j++]] : rgFixed[i];
+                rgLevels [n] = rgIsFree[n] ? system.GetMinLevel(rgColumns[n]) : rgFixedLevels[i++];
+            }
 
-                    Candidate[nCurFactor] = nBestLevel;
-                }
-                else
+            for (;;)
+            {
+                if (m_bmpUncoveredT3Tuples.CoverTuple(rgColumns, rgLevels, m_rgLevelCount))
+                    nResult++;
+
+                // advance the free columns to their next level combination
+                int n = m_nT - 1;
+                for ( ; n >= 0; n--)
                 {
-                    for (int j = nMinFactorLevel; j <= nMaxFactorLevel; j++)
+                    if (rgIsFree[n] == false)
+                        continue;
+
+                    if (rgLevels[n] < system.GetMaxLevel(rgColumns[n]))
                     {
-                        Candidate[nCurFactor] = j;
-
-                        nCoverage = CalculateT3TestCaseCoverage(Candidate);
-
-                        if (nCoverage > nBestCoverage)
-                        {
-                            nBestCoverage = nCoverage;
-                            nBestLevel    = j;         // identify the level with the best coverage
-                            nResult       = nCoverage; // return best coverage value to caller
-                        }
-                        else if ((nCoverage == nBestCoverage) && (nCoverage > 0))
-                        {  // let's randomly determine who is going to be considered the highest
-                            if (( rand( ) % iRandomMod ) == 0)
-                            {
-                                nBestLevel = j;
-                                iRandomMod++;
-                            }
-                        }
+                        rgLevels[n]++;
+                        break;
                     }
+                    rgLevels[n] = system.GetMinLevel(rgColumns[n]);
                 }
+                if (n < 0)
+                    break;
+            }
 
-                // if we didn't find a level needing to be covered, go
-                // ahead and assign something reasonable for the level
-                if (IsValidLevel(nBestLevel) == false)
-                {
-                    std::uniform_int_distribution<LEVEL_T>  dist(nMinFactorLevel, nMaxFactorLevel);
-                    nBestLevel = dist(g_mt);
-                }
+        } while ((nFree > 0) && NextCombination(rgPick, nFree, rgOthers.size()));
+    }
 
-                Candidate[nCurFactor] = nBestLevel;
-            }
+    return nResult;
+}
+
+/**
+  @brief  Assigns the open factors of a test case by depth-first search
+
+  @param [in]     system        target CComponentSystem
+  @param [in]     rgLevelCount  current count of uncovered tuple levels
+  @param [in,out] TestCase      the [partial] test case
+  @param [in]     rgOpen        the factors to be assigned
+  @param [in]     nDepth        index of the next open factor
+  @param [in,out] nBudget       remaining number of search nodes
+
+  @retval COMPLETION_RESULT     FOUND if every open factor was assigned,
+                                INFEASIBLE if no assignment exists, EXHAUSTED
+                                if the budget ran out before either was shown
+*/
+static COMPLETION_RESULT CompleteFactors(const CComponentSystem& system, 
+                                         const std::vector<size_t>& rgLevelCount,
+                                         CTestCase& TestCase, const std::vector<FACTOR_T>& rgOpen, 
+                                         size_t nDepth, size_t& nBudget)
+{
+    if (nDepth == rgOpen.size())
+        return COMPLETION_RESULT::FOUND;
+
+    if (nBudget == 0)
+        return COMPLETION_RESULT::EXHAUSTED;
+
+    nBudget--;
+
+    FACTOR_T             nFactor = rgOpen[nDepth];
+    std::vector<QWORD>   rgBlocking;
+    std::vector<LEVEL_T> rgCandidates;
+
+    system.get_Constraints().GetBlockingMask(TestCase, nFactor, rgBlocking);
+
+    for (LEVEL_T n = system.GetMinLevel(nFactor); n <= system.GetMaxLevel(nFactor); n++)
+    {
+        if (system.get_Constraints().IsFeasible(rgBlocking, n))
+            rgCandidates.push_back(n);
+    }
+
+    // the levels appearing in the most uncovered tuples are tried first
+    std::stable_sort(rgCandidates.begin(), rgCandidates.end(),
+                     [&rgLevelCount](LEVEL_T a, LEVEL_T b)
+                     { return rgLevelCount[a] > rgLevelCount[b]; });
+
+    COMPLETION_RESULT eResult = COMPLETION_RESULT::INFEASIBLE;
+
+    for (auto nLevel : rgCandidates)
+    {
+        TestCase[nFactor] = nLevel;
+
+        eResult = CompleteFactors(system, rgLevelCount, TestCase, rgOpen, nDepth + 1, nBudget);
+
+        // once the budget is spent, what is left of the search is unknown
+        if (eResult != COMPLETION_RESULT::INFEASIBLE)
+            break;
+    }
+
+    if (eResult != COMPLETION_RESULT::FOUND)
+        TestCase[nFactor] = LEVEL_INVALID;
+
+    return eResult;
+}
+
+COMPLETION_RESULT
+CTestSuite::CompleteTestCase(const CComponentSystem& system, CTestCase& TestCase, size_t nBudget) const
+{
+    std::vector<FACTOR_T> rgOpen;
+
+    for (FACTOR_T nCurFactor = 0; nCurFactor < m_nNumFactors; nCurFactor++)
+    {
+        if (IsValidLevel(TestCase[nCurFactor]) == false)
+            rgOpen.push_back(nCurFactor);
+    }
+
+    if (system.get_Constraints().IsForbidden(TestCase))
+        return COMPLETION_RESULT::INFEASIBLE;
+
+    return CompleteFactors(system, m_rgLevelCount, TestCase, rgOpen, 0, nBudget);
+}
+
+size_t
+CTestSuite::GenerateFeasibleTestCase(const CComponentSystem& system, CTestCase& TestCase)
+{
+    FACTOR_T rgColumns[MAX_T_WAY];
+    LEVEL_T  rgLevels [MAX_T_WAY];
+
+    while (m_bmpUncoveredT3Tuples.FindFirstUncovered(rgColumns, rgLevels))
+    {
+        TestCase.Init(m_nNumFactors);
+
+        for (WORD i = 0; i < m_nT; i++)
+            TestCase[rgColumns[i]] = rgLevels[i];
+
+        if (CompleteUncoveredTuple(system, TestCase))
+            return CalculateT3TestCaseCoverage(TestCase);
+
+        // the tuple can't be part of any valid test case, or one couldn't be
+        // found in time, so it is dropped from the tuples to be covered
+        m_bmpUncoveredT3Tuples.CoverTuple(rgColumns, rgLevels, m_rgLevelCount);
+    }
+
+    for (auto& it : m_rgRelations)
+    {
+        while (it.bmpUncovered.FindFirstUncovered(rgColumns, rgLevels))
+        {
+            TestCase.Init(m_nNumFactors);
+
+            for (WORD i = 0; i < it.bmpUncovered.get_T(); i++)
+                TestCase[it.rgFactors[rgColumns[i]]] = rgLevels[i];
+
+            if (CompleteUncoveredTuple(system, TestCase))
+                return CalculateT3TestCaseCoverage(TestCase);
+
+            it.bmpUncovered.CoverTuple(rgColumns, rgLevels, m_rgLevelCount);
         }
     }
 
-    return nResult;
+    return 0;
+}
+
+bool
+CTestSuite::CompleteUncoveredTuple(const CComponentSystem& system, CTestCase& TestCase)
+{
+    COMPLETION_RESULT eResult = CompleteTestCase(system, TestCase);
+
+    if (eResult == COMPLETION_RESULT::EXHAUSTED)
+        eResult = CompleteTestCase(system, TestCase, COMPLETION_RETRY_BUDGET);
+
+    // a tuple which may yet be feasible is not quietly taken for infeasible
+    if (eResult == COMPLETION_RESULT::EXHAUSTED)
+        m_nNumUnresolved++;
+
+    return (eResult == COMPLETION_RESULT::FOUND);
+}
+
+bool
+CTestSuite::IsMergeFeasible(const CComponentSystem& system, const CTestCase& lhs, 
+                            const CTestCase& rhs) const
+{
+    CTestCase Merged(lhs);
+
+    for (FACTOR_T nCurFactor = 0; nCurFactor < m_nNumFactors; nCurFactor++)
+    {
+        if (IsValidLevel(rhs[nCurFactor]))
+            Merged[nCurFactor] = rhs[nCurFactor];
+    }
+
+    if (system.get_Constraints().IsForbidden(Merged))
+        return false;
+
+    // the merged cells may rule out levels of a don't-care left in either
+    for (FACTOR_T nCurFactor = 0; nCurFactor < m_nNumFactors; nCurFactor++)
+    {
+        if ((IsValidLevel(Merged[nCurFactor]) == false) &&
+            !system.get_Constraints().CanRelease(Merged, nCurFactor, system.GetMinLevel(nCurFactor),
+                                                 system.GetNumLevels(nCurFactor)))
+            return false;
+    }
+
+    return true;
+}
+
+bool
+CTestSuite::IsCompatible(const CTestCase& lhs, const CTestCase& rhs) const noexcept
+{
+    for (FACTOR_T nCurFactor = 0; nCurFactor < m_nNumFactors; nCurFactor++)
+    {
+        if (IsValidLevel(lhs[nCurFactor]) && IsValidLevel(rhs[nCurFactor]) && 
+            (lhs[nCurFactor] != rhs[nCurFactor]))
+            return false;
+    }
+
+    return true;
 }
 
 bool
@@ -634,5 +1339,29 @@ size_t
 CTestSuite::ClearTestSuite(void) noexcept
 {
     m_lstTestSuite.clear();
+    m_rgCoverageCurve.clear();
+    m_bAbandoned        = false;
+    m_nNumUnresolved    = 0;
+    m_nNumSeedRowsAdded = 0;
     return m_lstTestSuite.size();
 }
+
+void
+CTestSuite::SetSuiteWriter(CSuiteWriter* pWriter)
+{
+    if (pWriter)
+    {
+        // a failed write leaves the file short, but generation carries on;
+        // each row is handed on at once, for a reader consuming the stream
+        m_fnRowSink = [pWriter](const CTestCase& TestCase)
+            {
+                if (pWriter->WriteRow(TestCase))
+                    pWriter->Flush( );
+                return true;
+            };
+    }
+    else
+    {
+        m_fnRowSink = nullptr;
+    }
+}
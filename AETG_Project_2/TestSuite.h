@@ -17,6 +17,14 @@
     #include "CommonDef.h"
 #endif
 
+#ifndef _CHRONO_
+    #include <chrono>
+#endif
+
+#ifndef _FUNCTIONAL_
+    #include <functional>
+#endif
+
 #ifndef _LIST_
     #include <list>
 #endif
@@ -25,6 +33,10 @@
     #include <unordered_set>
 #endif
 
+#ifndef __CONSTRUCTION_H__
+    #include "Construction.h"
+#endif
+
 #ifndef __TEST_CASE_H__
     #include "TestCase.h"
 #endif
@@ -33,11 +45,92 @@
     #include "Tuple.h"
 #endif
 
+#ifndef __COVERAGE_MAP_H__
+    #include "CoverageMap.h"
+#endif
+
+#ifndef __SUITE_WRITER_H__
+    #include "SuiteWriter.h"
+#endif
+
+#ifndef __COMPONENT_SYSTEM_H__
+    #include "ComponentSystem.h"
+#endif
+
 /// Global predetermined test case candidate generation
-constexpr const int TEST_CASE_CANDIDATES = 50;
+constexpr const int  TEST_CASE_CANDIDATES = 50;
+
+/// Default interaction strength used for test case generation, see 
+/// CComponentSystem::SetStrength
+constexpr const WORD T_WAY                = DEFAULT_T_WAY;
+
+/// maximum number of search nodes spent completing a constrained test case
+constexpr const size_t COMPLETION_BUDGET       = 1 << 16;
 
-// forward declaration
-class CComponentSystem;
+/// maximum number of search nodes of the second, last attempt at completing
+/// an uncovered tuple
+constexpr const size_t COMPLETION_RETRY_BUDGET = 1 << 22;
+
+/**
+  @brief  Outcome of the search for a valid completion of a test case
+*/
+enum class COMPLETION_RESULT
+{
+    FOUND,              ///< every open factor was assigned
+    INFEASIBLE,         ///< the search proved no valid assignment exists
+    EXHAUSTED           ///< the search ran out of nodes first
+};
+
+/**
+  @brief  The uncovered tuples of a sub-relation of a variable-strength system
+
+  The bitmap's factors are the relation's factors, in order, and test cases 
+  are projected onto them before being scored or covered.  Levels keep their
+  global values, so the relation shares the suite's per-level counts.
+*/
+struct RELATION_COVERAGE
+{
+    std::vector<FACTOR_T>  rgFactors;      ///< factors of the relation, ascending
+    CCoverageMap           bmpUncovered;   ///< bitmap of the relation's uncovered tuples
+};
+
+/**
+  @brief  Receives each test case as it is added to a suite
+
+  Returning false abandons the generation, which is then left incomplete.
+*/
+typedef std::function<bool(const CTestCase&)> ROW_SINK;
+
+/**
+  @brief  Supplies a fresh copy-on-write view of a baseline coverage image, 
+          as written by CTestSuite::WriteBaseline
+
+  Each call may release the view returned by the previous one.  Returning 
+  nullptr falls back to filling the coverage bitmap.
+*/
+typedef std::function<void*(void)> BASELINE_SOURCE;
+
+/**
+  @brief  Called between the test cases of a generation, at a point from which
+          CTestSuite::ResumeTestSuite can carry on with the generation
+*/
+typedef std::function<void(void)> CHECKPOINT_SINK;
+
+/**
+  @brief  The state of a generation part way through, as saved by 
+          CTestSuite::SaveState
+*/
+struct GENERATION_STATE
+{
+    std::list<CTestCase>             lstTestSuite;     ///< test cases generated so far
+    std::vector<size_t>              rgCoverageCurve;  ///< newly covered tuples, indexed by row
+    std::vector<size_t>              rgLevelCount;     ///< uncovered tuple count, indexed by level
+    std::vector<size_t>              rgNumUncovered;   ///< uncovered tuples of the base bitmap, then
+                                                       ///< of each sub-relation
+    std::vector<std::vector<QWORD>>  rgRuns;           ///< the bitmaps, likewise, as encoded by 
+                                                       ///< CCoverageMap::EncodeRuns
+    size_t                           nNumUnresolved;   ///< see CTestSuite::get_NumUnresolvedTuples
+};
 
 /**
   @brief  A hash set type definition based on a T2_TUPLE hash algorithm
@@ -49,20 +142,41 @@ typedef std::unordered_set<T2_TUPLE, T2_TUPLE_HASH> T2_TUPLE_HASHSET;
 */
 typedef std::unordered_set<T3_TUPLE, T3_TUPLE_HASH> T3_TUPLE_HASHSET;
 
-/// @todo need to re-factor CTestSuite into a class hierarchy
 /** 
   @brief  Manages test case generation and the and the collection of test cases
+
+  CTestSuite is the abstract base of the test case generation engines.  It owns
+  the uncovered tuple bookkeeping and the resultant collection of test cases, 
+  and drives suite generation one test case at a time, leaving the choice of 
+  each new test case to the derived engine.
+
+  @sa CAETGTestSuite, CDensityTestSuite, CIPOGTestSuite
 */
 class CTestSuite
 {
+protected:
     FACTOR_T               m_nNumFactors;          ///< number of configured system factors
+    WORD                   m_nT;                   ///< base interaction strength t
     LEVEL_T                m_nMaxSystemLevel;      ///< maximum system level of any factor
-    std::vector<LEVEL_T>   m_rgLevelCount;         ///< current count of uncovered tuple levels
+    std::vector<size_t>    m_rgLevelCount;         ///< current count of uncovered tuple levels
     std::vector<T2_TUPLE>  m_rgTestCaseT2Tuples;   ///< working set of possible T2 tuple coverages
-    std::vector<T3_TUPLE>  m_rgTestCaseT3Tuples;   ///< working set of possible T3 tuple coverages
     T2_TUPLE_HASHSET       m_setUncoveredT2Tuples; ///< collection of uncovered T2 tuples
-    T3_TUPLE_HASHSET       m_setUncoveredT3Tuples; ///< collection of uncovered T3 tuples
+    CCoverageMap           m_bmpUncoveredT3Tuples; ///< bitmap of uncovered base strength tuples
+    std::vector<RELATION_COVERAGE> m_rgRelations;  ///< uncovered tuples of each higher strength sub-relation
     std::list<CTestCase>   m_lstTestSuite;         ///< collection of test cases
+    ROW_SINK               m_fnRowSink;            ///< optional sink for rows as they are added
+    BASELINE_SOURCE        m_fnBaseline;           ///< optional source of the initial coverage bitmap
+    CHECKPOINT_SINK        m_fnCheckpoint;         ///< optional sink called between generated rows
+    bool                   m_bAbandoned;           ///< set once the row sink has declined a row
+    size_t                 m_nNumUnresolved;       ///< tuples dropped without being proven infeasible
+    std::vector<size_t>    m_rgCoverageCurve;      ///< newly covered 3-way tuples, indexed by row
+    std::vector<CTestCase> m_rgSeedRows;           ///< test cases of an existing suite to be extended
+    FACTOR_T               m_nNumSeedFactors;      ///< number of factors of the seed suite
+    size_t                 m_nNumSeedRowsAdded;    ///< seed test cases which made it into the suite
+    bool                   m_bUseConstructions;    ///< consult direct constructions before searching
+    bool                   m_bUseRecursive;        ///< compose covering arrays from smaller ones
+    CRecursiveConstruction m_Construction;         ///< cache of the composed covering arrays
+    std::chrono::steady_clock::time_point m_tpDeadline; ///< time by which generation is to give up
 
 public:
     typedef std::list<CTestCase>::const_iterator const_iterator; ///< exposes the underlying typedef
@@ -70,17 +184,31 @@ public:
     /// Default Constructor
     CTestSuite( ) noexcept
         : m_nNumFactors(0),
+          m_nT(T_WAY),
           m_nMaxSystemLevel(LEVEL_INVALID),
           m_rgLevelCount(),
           m_rgTestCaseT2Tuples(),
-          m_rgTestCaseT3Tuples(),
           m_setUncoveredT2Tuples(),
-          m_setUncoveredT3Tuples(),
-          m_lstTestSuite()
+          m_bmpUncoveredT3Tuples(),
+          m_rgRelations(),
+          m_lstTestSuite(),
+          m_fnRowSink(),
+          m_fnBaseline(),
+          m_fnCheckpoint(),
+          m_bAbandoned(false),
+          m_nNumUnresolved(0),
+          m_rgCoverageCurve(),
+          m_rgSeedRows(),
+          m_nNumSeedFactors(0),
+          m_nNumSeedRowsAdded(0),
+          m_bUseConstructions(true),
+          m_bUseRecursive(false),
+          m_Construction(),
+          m_tpDeadline(std::chrono::steady_clock::time_point::max())
     { };
 
     /// Default Destructor
-    ~CTestSuite( );
+    virtual ~CTestSuite( );
 
 /**
     @brief class initializer
@@ -100,7 +228,13 @@ public:
     size_t GenerateUncoveredT2Tuples(const CComponentSystem& system);
 
 /**
-  @brief  Generates the uncovered 3-way tuple set
+  @brief  Generates the uncovered t-way tuple set
+
+  The uncovered tuple bitmap and the per-level counts are filled in parallel, 
+  partitioned by column combination rank, rather than enumerated one tuple at 
+  a time.  Tuples holding one of the system's forbidden tuples are then 
+  removed, as no valid test case could cover them.  For a variable-strength
+  system the tuples of every sub-relation are added to the set.
 
   @param [in] system         target CComponentSystem
 
@@ -122,9 +256,12 @@ public:
 /**
   @brief  Calculates a coverage value for a given CTestCase object
 
+  Every uncovered tuple counts once, be it of the base strength or of a 
+  sub-relation.
+
   @param [in] TestCase       target CTestCase object
 
-  @retval size_t             number of 3-way tuples covered in 
+  @retval size_t             number of uncovered tuples covered in 
                              the [partial] test case
 */
     size_t CalculateT3TestCaseCoverage(const CTestCase& TestCase);
@@ -158,24 +295,127 @@ public:
     bool   GenerateMaxLevelCandidate(const CComponentSystem& system, CTestCase& Candidate) const;
 
 /**
-  @brief  Generates a 2-way test case candidate
+  @brief  Generates the next test case to be added to the suite
+
+  Implemented by each generation engine, the resultant test case is expected
+  to cover at least one of the currently uncovered 3-way tuples.
 
   @param [in]   system       CComponentSystem object, containing the inputs
-  @param [out]  Candidate    the resultant CTestCase object
+  @param [out]  TestCase     the resultant CTestCase object
+
+  @retval size_t             containing the number of uncovered 3-way tuples
+                             covered by the test case
+*/
+    virtual size_t GenerateTestCase(const CComponentSystem& system, CTestCase& TestCase) = 0;
+
+/**
+  @brief  Indicates whether the engine always generates the same suite
+
+  A deterministic engine produces an identical test suite on every invocation
+  for a given system, so there is nothing to be gained by repeating it.
+
+  @retval true               if the engine is deterministic
+  @retval false              if the engine is randomized
+*/
+    virtual bool   IsDeterministic(void) const noexcept
+    { return false; };
+
+/**
+  @brief  Returns the short name of the engine, as given to <b>-engine</b>
+
+  @retval const char*        containing the engine name
+*/
+    virtual const char* GetEngineName(void) const noexcept = 0;
+
+/**
+  @brief  Seeds generation with the test cases of an existing suite
+
+  The test cases are mapped onto the system by their level within each 
+  factor.  Factors beyond those of the seed suite, and levels the system no 
+  longer has, are left as don't-care levels for generation to assign.  The
+  seed is cleared by Init.
+
+  @param [in] system         target CComponentSystem
+  @param [in] rgMinLevel     minimum level of the seed suite, indexed by factor
+  @param [in] rgNumLevels    number of levels of the seed suite, indexed by 
+                             factor
+  @param [in] lstSeedSuite   the test cases of the seed suite
+
+  @retval size_t             containing the number of seed test cases
+*/
+    size_t SetSeedSuite(const CComponentSystem& system, const std::vector<LEVEL_T>& rgMinLevel,
+                        const std::vector<LEVEL_T>& rgNumLevels, 
+                        const std::list<CTestCase>& lstSeedSuite);
+
+/**
+  @brief  Tests whether the suite for a system would be constructed directly
+
+  Only an orthogonal array counts, being optimal; a recursive construction
+  can be larger than a searched suite, so is left to compete with one.
+
+  @param [in] system         target CComponentSystem
 
-  @retval size_t             containing the candidate coverage value
+  @retval true               if GenerateTestSuite would construct the whole
+                             optimal suite, leaving nothing for a search
+  @retval false              otherwise
 */
-    size_t GenerateT2TestCaseCandidate(const CComponentSystem& system, CTestCase& Candidate);
+    bool   CanConstructTestSuite(const CComponentSystem& system) const;
 
 /**
-  @brief  Generates a 3-way test case candidate
+  @brief  Generates a complete 3-way test suite
+
+  The uncovered tuple set is regenerated and seeded with the minimum and 
+  maximum level test cases, after which GenerateTestCase is repeatedly invoked 
+  until all 3-way tuples have been covered.  When a seed suite has been set it
+  takes the place of the minimum and maximum level test cases, extended 
+  horizontally across any factors it lacks, so only the remaining tuples are 
+  left to GenerateTestCase.  A system with a known optimal covering array is
+  constructed directly instead (see Construction.h).  Engines that do not 
+  construct the suite one test case at a time override this method in its 
+  entirety.
 
   @param [in]   system       CComponentSystem object, containing the inputs
-  @param [out]  Candidate    the resultant CTestCase object
 
-  @retval size_t             containing the candidate coverage value
+  @retval size_t             containing the number of test cases in the 
+                             generated suite
+*/
+    virtual size_t GenerateTestSuite(const CComponentSystem& system);
+
+/**
+  @brief  Removes redundant test cases from the suite
+
+  A coverage multiplicity count is built over the suite, after which every
+  test case whose tuples are all covered by at least one other test case is a
+  removal candidate.  Candidates are visited in ascending order of the 
+  number of tuples they share with exactly one other test case, each being 
+  re-checked against the updated counts before it is removed.  Since counts 
+  only ever decrease, a single pass suffices and the reduction runs in time 
+  proportional to rows x C(k, t).  Seed test cases are never removed, so 
+  they keep their positions at the start of the suite.  The tuples of any 
+  sub-relation are counted alongside those of the base strength.
+
+  @param [in]   system       CComponentSystem object, containing the inputs
+
+  @retval size_t             containing the number of test cases removed
+*/
+    size_t ReduceTestSuite(const CComponentSystem& system);
+
+/**
+  @brief  Marks non-contributing cells as don't-care and merges compatible
+          test cases
+
+  Visiting the suite in order, a cell is marked don't-care (LEVEL_INVALID) 
+  when every 3-way tuple it takes part in is also covered by some other test
+  case, the coverage counts being updated as each cell is released.  Test 
+  cases left without any valid cells are dropped, after which any two test 
+  cases agreeing on every factor where both have a valid level are merged.
+  Variable-strength suites are left as they are.
+
+  @param [in]   system       CComponentSystem object, containing the inputs
+
+  @retval size_t             containing the number of test cases removed
 */
-    size_t GenerateT3TestCaseCandidate(const CComponentSystem& system, CTestCase& Candidate);
+    size_t MergeTestSuite(const CComponentSystem& system);
 
 /**
   @brief  Adds a new 2-way test case to the suite
@@ -210,13 +450,34 @@ public:
     { return m_setUncoveredT2Tuples.size(); };
 
 /**
-  @brief  Returns the number of 3-way tuples in the uncovered tuple set
+  @brief  Returns the number of t-way tuples in the uncovered tuple set
 
-  @retval size_t             containing the current number of 
-                             uncovered 3-way tuples
+  @retval size_t             containing the current number of uncovered 
+                             tuples, sub-relations included
 */
     inline size_t get_NumUncoveredT3Tuples    (void) const noexcept
-    { return m_setUncoveredT3Tuples.size(); };
+    {
+        size_t nResult = m_bmpUncoveredT3Tuples.get_NumUncovered();
+
+        for (auto& it : m_rgRelations)
+            nResult += it.bmpUncovered.get_NumUncovered();
+
+        return nResult;
+    };
+
+/**
+  @brief  Returns the number of tuples left uncovered by the last generation
+          without being proven infeasible
+
+  Under constraints, a tuple whose completion into a valid test case could
+  be neither found nor ruled out within COMPLETION_RETRY_BUDGET search nodes
+  is dropped from the tuples to be covered, and counted here; the suite may
+  then fall short of full coverage of the feasible tuples.
+
+  @retval size_t             containing the number of unresolved tuples
+*/
+    inline size_t get_NumUnresolvedTuples     (void) const noexcept
+    { return m_nNumUnresolved; };
 
 /**
   @brief  Returns the current number of CTestCase objects 
@@ -229,6 +490,30 @@ public:
     { return m_lstTestSuite.size(); };
 
 
+/**
+  @brief  Returns the number of seed test cases at the start of the suite
+
+  Under constraints, or once extended, a seed test case may have been
+  dropped, so this may be fewer than were set by SetSeedSuite.
+
+  @retval size_t             containing the number of seed test cases
+*/
+    inline size_t get_NumSeedRows           (void) const noexcept
+    { return m_nNumSeedRowsAdded; };
+
+/**
+  @brief  Returns the coverage curve of the test suite
+
+  Entry n holds the number of 3-way tuples first covered by test case n, as
+  recorded by AddToT3TestSuite, so the cumulative coverage of any prefix of 
+  the suite is available without further computation.  The curve is rebuilt
+  whenever test cases are removed or altered.
+
+  @retval std::vector<size_t>  containing the newly covered tuples by row
+*/
+    inline const std::vector<size_t>& get_CoverageCurve(void) const noexcept
+    { return m_rgCoverageCurve; };
+
 /**
   @brief  Returns an iterator to the beginning of nonmutable sequence of 
           CTestCase objects contained in the current test suite collection
@@ -262,6 +547,165 @@ public:
 */
     size_t  SpliceTestSuite(std::list<CTestCase>& lstOther);
 
+/**
+  @brief Streams test cases to a writer as they are added to the suite
+
+  @param [in] pWriter        an open CSuiteWriter, or nullptr to stop streaming
+*/
+    void    SetSuiteWriter(CSuiteWriter* pWriter);
+
+/**
+  @brief Hands each test case to a sink as it is added to the suite
+
+  A row is handed over as soon as it is accepted, before the suite is 
+  complete, so its consumer may put it to use while the rest are generated.
+  The rows are those of the suite as generated, ahead of ReduceTestSuite or
+  MergeTestSuite; an engine building all of its rows at once, as IPOG does, 
+  hands them over together at the end.
+
+  @param [in] fnRowSink      the sink, or an empty ROW_SINK to stop streaming
+*/
+    inline void SetRowSink(const ROW_SINK& fnRowSink)
+    { m_fnRowSink = fnRowSink; };
+
+/**
+  @brief Sets a deadline by which GenerateTestSuite gives up
+
+  A suite abandoned at its deadline is left incomplete, with uncovered 
+  tuples remaining.
+
+  @param [in] tpDeadline     the deadline, time_point::max() for none
+*/
+    inline void set_Deadline(std::chrono::steady_clock::time_point tpDeadline) noexcept
+    { m_tpDeadline = tpDeadline; };
+
+/**
+  @brief Enables or disables the direct constructions of GenerateTestSuite
+
+  @param [in] bUseConstructions  false to always search for the suite
+*/
+    inline void set_UseConstructions(bool bUseConstructions) noexcept
+    { m_bUseConstructions = bUseConstructions; };
+
+/**
+  @brief Enables or disables the recursive constructions of GenerateTestSuite
+
+  Composed arrays are built far faster than they are searched for, though 
+  generally with more test cases.
+
+  @param [in] bUseRecursive  true to compose the suite from smaller arrays
+*/
+    inline void set_UseRecursive(bool bUseRecursive) noexcept
+    { m_bUseRecursive = bUseRecursive; };
+
+/**
+  @brief Indicates whether GenerateTestSuite consults the direct constructions
+
+  @retval bool               true unless disabled by set_UseConstructions
+*/
+    inline bool get_UseConstructions(void) const noexcept
+    { return m_bUseConstructions; };
+
+/**
+  @brief Indicates whether GenerateTestSuite composes recursive constructions
+
+  @retval bool               true if enabled by set_UseRecursive
+*/
+    inline bool get_UseRecursive(void) const noexcept
+    { return m_bUseRecursive; };
+
+/**
+  @brief Starts each fill of the coverage bitmap from a baseline image 
+
+  Rather than filling a bitmap of its own, the suite attaches its bitmap to 
+  a fresh view of the image each time the uncovered tuples are generated, 
+  so that processes sharing the image as copy-on-write memory each hold only
+  the pages their own generation has written to.  Set before Init, which 
+  then allocates no bitmap.
+
+  @param [in] fnBaseline     the source, or an empty BASELINE_SOURCE to fill
+                             the bitmap
+*/
+    inline void SetBaselineSource(const BASELINE_SOURCE& fnBaseline)
+    { m_fnBaseline = fnBaseline; };
+
+/**
+  @brief Sets where and beyond which size the coverage bitmap is spilled to 
+         a file of shards, rather than held in memory
+
+  Set before Init.  By default a bitmap larger than half of the physical 
+  memory is spilled to the temporary directory.
+
+  @param [in] szDirectory    directory of the file, or nullptr for the 
+                             temporary directory
+  @param [in] cbThreshold    size of the bitmap beyond which it is spilled, 
+                             in bytes, or 0 for half of the physical memory
+*/
+    inline void SetSpill(const TCHAR* szDirectory, QWORD cbThreshold)
+    { m_bmpUncoveredT3Tuples.SetSpill(szDirectory, cbThreshold); };
+
+/**
+  @brief Calls a sink after each test case the search adds to the suite
+
+  The sink may call SaveState to capture the generation at that point, which
+  is kept short, leaving anything slower, such as writing the state out, to 
+  another thread.
+
+  @param [in] fnCheckpoint   the sink, or an empty CHECKPOINT_SINK
+*/
+    inline void SetCheckpointSink(const CHECKPOINT_SINK& fnCheckpoint)
+    { m_fnCheckpoint = fnCheckpoint; };
+
+/**
+  @brief Captures the state of the generation in progress
+
+  Together with the state of the system's random engine, taken at the same 
+  point, this is all ResumeTestSuite needs to finish the generation exactly
+  as it would have finished uninterrupted.
+
+  @param [out] state         the generation state
+*/
+    void    SaveState(GENERATION_STATE& state) const;
+
+/**
+  @brief Carries on with a generation from a state saved by SaveState
+
+  The suite must be initialized for the same system and engine as it was 
+  when the state was saved, and the random engine restored to its state at 
+  the time.  The rows of the state are not handed to a row sink.
+
+  @param [in] system         target CComponentSystem
+  @param [in] state          the generation state
+
+  @retval true               on success, the suite being complete
+  @retval false              if the state does not fit the system, leaving
+                             the suite empty
+*/
+    bool    ResumeTestSuite(const CComponentSystem& system, const GENERATION_STATE& state);
+
+/**
+  @brief Returns the size of the baseline image of the initialized system
+
+  @retval size_t             containing the size in bytes
+*/
+    size_t  GetBaselineSize(void) const noexcept;
+
+/**
+  @brief Writes the baseline coverage image: the uncovered base strength 
+         tuples of the system, forbidden tuples excluded, along with their 
+         per-level counts
+
+  @param [in]  system        target CComponentSystem, as given to Init
+  @param [out] pImage        receives the image, 8 byte aligned
+  @param [in]  cbImage       size of pImage, at least GetBaselineSize()
+
+  @retval true               on success
+  @retval false              if the buffer is too small, the suite has a
+                             baseline source of its own, or its bitmap is 
+                             spilled
+*/
+    bool    WriteBaseline(const CComponentSystem& system, void* pImage, size_t cbImage);
+
 /**
   @brief Clears the underlying test case collection
 
@@ -270,6 +714,179 @@ public:
 */
     size_t  ClearTestSuite (void) noexcept;
 
+protected:
+/**
+  @brief  Initializes the leading columns to { 0, 1, ... t - 2 }
+
+  @param [out] rgOthers      the leading columns
+*/
+    inline void ResetOthers(FACTOR_T* rgOthers) const noexcept
+    {
+        for (WORD i = 0; i + 1 < m_nT; i++)
+            rgOthers[i] = i;
+    };
+
+/**
+  @brief  Builds a column combination from t - 1 leading columns and the
+          factor being added, which is always the highest column
+
+  @param [in]  rgOthers      the leading columns
+  @param [in]  nFactor       the factor being added
+  @param [out] rgColumns     the resultant column combination
+*/
+    inline void MakeColumns(const FACTOR_T* rgOthers, FACTOR_T nFactor, FACTOR_T* rgColumns) const noexcept
+    {
+        for (WORD i = 0; i + 1 < m_nT; i++)
+            rgColumns[i] = rgOthers[i];
+
+        rgColumns[m_nT - 1] = nFactor;
+    };
+
+/**
+  @brief  Assigns a level of the new factor to every existing test case
+
+  Test cases for which no level of the factor covers an uncovered tuple are 
+  left with a don't-care level.
+
+  @param [in]     system     CComponentSystem object, containing the inputs
+  @param [in]     nFactor    the factor being added, [t - 1 .. k)
+  @param [in,out] rgRows     the test cases, valid only below nFactor
+
+  @retval size_t             containing the number of tuples covered
+*/
+    size_t  ExtendHorizontal (const CComponentSystem& system, FACTOR_T nFactor,
+                              std::vector<CTestCase>& rgRows);
+
+/**
+  @brief  Selects the level of the new factor covering the most uncovered tuples
+          in a test case
+
+  Levels completing a forbidden tuple are never selected.
+
+  @param [in]   system         CComponentSystem object, containing the inputs
+  @param [in]   TestCase       target CTestCase object
+  @param [in]   nFactor        the factor being added
+  @param [in]   nMinLevel      the factor's minimum level
+  @param [in]   nNumLevels     the factor's number of levels
+  @param [out]  nBestCoverage  the number of tuples the level would cover
+
+  @retval LEVEL_T            on success containing the best level
+  @retval LEVEL_INVALID      if no level covers any uncovered tuples
+*/
+    LEVEL_T ScoreTestCase    (const CComponentSystem& system, const CTestCase& TestCase, 
+                              FACTOR_T nFactor, LEVEL_T nMinLevel, LEVEL_T nNumLevels, 
+                              size_t& nBestCoverage) const;
+
+/**
+  @brief  Tests whether generation is to give up, its deadline having passed
+          or its row sink having declined a row
+
+  @retval true               if generation is to give up
+  @retval false              otherwise
+*/
+    inline bool IsAbandoned(void) const noexcept
+    { return m_bAbandoned || (std::chrono::steady_clock::now() >= m_tpDeadline); };
+
+/**
+  @brief  Adds the test cases of a direct construction to the suite
+
+  An orthogonal array is taken when one applies, otherwise, if enabled, a 
+  recursively composed array, the forbidden cells and any factors it lacks 
+  being extended as a seed suite's are.  Nothing is added when constructions
+  are disabled, or a seed suite has been set, or no construction applies to
+  the system.  Any tuples left uncovered are for CoverRemainingTuples.
+
+  @param [in] system         target CComponentSystem
+
+  @retval size_t             containing the number of test cases added
+*/
+    size_t  AddConstructedTestCases(const CComponentSystem& system);
+
+/**
+  @brief  Generates test cases until every tuple has been covered
+
+  Under constraints, a candidate which leaves factors unassigned or holds a 
+  forbidden tuple is replaced by one from GenerateFeasibleTestCase, as is 
+  one covering nothing, which a variable-strength system's sub-relations
+  can otherwise leave the engines with.  Generation stops early once the 
+  deadline has passed.
+
+  @param [in]   system       CComponentSystem object, containing the inputs
+
+  @retval size_t             containing the number of test cases added
+*/
+    size_t  CoverRemainingTuples(const CComponentSystem& system);
+
+/**
+  @brief  Generates a valid test case around the lowest ranked uncovered tuple
+
+  Tuples of the base strength are taken before those of any sub-relation.
+  Uncovered tuples which can not be completed into a valid test case are 
+  dropped from the tuples to be covered along the way.  A tuple the search
+  runs out of nodes on is searched again with COMPLETION_RETRY_BUDGET nodes,
+  and should that fail as well, dropped and counted as unresolved.
+
+  @param [in]   system       CComponentSystem object, containing the inputs
+  @param [out]  TestCase     the resultant CTestCase object
+
+  @retval size_t             containing the number of uncovered tuples
+                             covered by the test case
+  @retval 0                  if no coverable tuples remain
+*/
+    size_t  GenerateFeasibleTestCase(const CComponentSystem& system, CTestCase& TestCase);
+
+/**
+  @brief  Completes a test case around an uncovered tuple, searching again with
+          a larger budget should the first search run out of nodes
+
+  A tuple neither completed nor proven infeasible is counted as unresolved.
+
+  @param [in]     system     CComponentSystem object, containing the inputs
+  @param [in,out] TestCase   the test case holding the tuple
+
+  @retval true               if the test case was completed
+  @retval false              if the tuple is to be dropped
+*/
+    bool    CompleteUncoveredTuple(const CComponentSystem& system, CTestCase& TestCase);
+
+/**
+  @brief  Assigns every don't-care level of a test case without completing a 
+          forbidden tuple
+
+  A depth-first search with a bounded number of nodes, trying the levels 
+  appearing in the most uncovered tuples first.
+
+  @param [in]     system     CComponentSystem object, containing the inputs
+  @param [in,out] TestCase   the [partial] test case, unchanged on failure
+  @param [in]     nBudget    maximum number of search nodes
+
+  @retval COMPLETION_RESULT  FOUND on success, INFEASIBLE if no valid
+                             assignment exists, EXHAUSTED if none was found
+                             within the budget
+*/
+    COMPLETION_RESULT CompleteTestCase(const CComponentSystem& system, CTestCase& TestCase,
+                                       size_t nBudget = COMPLETION_BUDGET) const;
+
+/**
+  @brief  Counts the uncovered tuples of a test case involving the new factor
+
+  @param [in]   TestCase     target CTestCase object
+  @param [in]   nFactor      the factor being added
+
+  @retval size_t             containing the number of uncovered tuples
+*/
+    size_t  CountNewTuples   (const CTestCase& TestCase, FACTOR_T nFactor) const;
+
+/**
+  @brief  Marks the tuples of a test case involving the new factor as covered
+
+  @param [in]   TestCase     target CTestCase object
+  @param [in]   nFactor      the factor being added
+
+  @retval size_t             containing the number of tuples newly covered
+*/
+    size_t  CoverNewTuples   (const CTestCase& TestCase, FACTOR_T nFactor);
+
 ///////////////////////////////////////////////////////////////////////
 // Following are internal helper methods used by the CTestSuite object
 //
@@ -285,15 +902,89 @@ private:
     size_t  GenerateTestCaseT2Tuples   (const CTestCase& TestCase);
 
 /**
-  @brief  Generates a set of tuples from a given test case
+  @brief  Extends the seed test cases across the system and adds them to the 
+          suite
 
-  @param [in] TestCase       target CTestCase
+  @param [in] system         target CComponentSystem
 
-  @retval size_t             on success, contains the number of test case 
-                             3-way tuples
-  @retval 0                  on error
+  @retval size_t             containing the number of test cases added
+*/
+    size_t  AddSeedTestCases(const CComponentSystem& system);
+
+/**
+  @brief  Extends partial test cases across the system and adds them to the 
+          suite
+
+  The tuples of the test cases are covered first, after which each factor's
+  don't-care levels are assigned by ExtendHorizontal.
+
+  @param [in] system          target CComponentSystem
+  @param [in] rgRows          the test cases, don't-care levels marking the
+                              cells to be assigned
+  @param [in] bKeepIncomplete under constraints, true to keep the don't-care
+                              levels of a test case which can't be completed,
+                              false to drop the test case
+
+  @retval size_t              containing the number of test cases added
+*/
+    size_t  ExtendTestCases (const CComponentSystem& system, std::vector<CTestCase> rgRows,
+                             bool bKeepIncomplete);
+
+/**
+  @brief  Rebuilds the coverage curve, and the uncovered tuple state, from 
+          the current collection of test cases
+
+  @param [in] system         target CComponentSystem
+*/
+    void    RecalcCoverageCurve(const CComponentSystem& system);
+
+/**
+  @brief  Attaches the coverage bitmap to a fresh view of the baseline image
+
+  @retval true               on success
+  @retval false              if the source supplied no view, or one not 
+                             matching the system
+*/
+    bool    AttachBaseline(void);
+
+/**
+  @brief  Removes the tuples holding a forbidden tuple from the uncovered 
+          tuple set
+
+  @param [in] system         target CComponentSystem
+
+  @retval size_t             containing the number of tuples removed
+*/
+    size_t  ExcludeForbiddenTuples(const CComponentSystem& system);
+
+/**
+  @brief  Tests whether merging two compatible test cases holds a forbidden 
+          tuple
+
+  A don't-care left in the merged test case must still admit every level of
+  its factor.
+
+  @param [in] system         target CComponentSystem
+  @param [in] lhs            first CTestCase
+  @param [in] rhs            second CTestCase
+
+  @retval true               if the merged test case is valid
+  @retval false              otherwise
+*/
+    bool    IsMergeFeasible(const CComponentSystem& system, const CTestCase& lhs, 
+                            const CTestCase& rhs) const;
+
+/**
+  @brief  Tests whether two test cases can be merged into one
+
+  @param [in] lhs            first CTestCase
+  @param [in] rhs            second CTestCase
+
+  @retval true               if the test cases agree on every factor where
+                             both have a valid level assigned
+  @retval false              otherwise
 */
-    size_t  GenerateTestCaseT3Tuples   (const CTestCase& TestCase);
+    bool    IsCompatible(const CTestCase& lhs, const CTestCase& rhs) const noexcept;
 };
 
 #endif
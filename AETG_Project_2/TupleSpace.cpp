@@ -0,0 +1,127 @@
+/**
+ *  @file       TupleSpace.cpp
+ *  @brief      CTupleSpace class implementation
+ *  @author     Mark L. Short
+ *  @date       October 18, 2026
+ */
+
+#include "stdafx.h"
+
+#include "ComponentSystem.h"
+#include "MathUtility.h"
+#include "TestCase.h"
+
+#include "TupleSpace.h"
+
+bool
+CTupleSpace::Init(const CComponentSystem& system, WORD nT)
+{
+    FACTOR_T             nNumFactors = system.get_NumFactors( );
+    std::vector<LEVEL_T> rgMinLevel (nNumFactors);
+    std::vector<LEVEL_T> rgNumLevels(nNumFactors);
+
+    for (FACTOR_T nCurFactor = 0; nCurFactor < nNumFactors; nCurFactor++)
+    {
+        rgMinLevel [nCurFactor] = system.GetMinLevel(nCurFactor);
+        rgNumLevels[nCurFactor] = system.GetMaxLevel(nCurFactor) - rgMinLevel[nCurFactor] + 1;
+    }
+
+    return Init(rgMinLevel, rgNumLevels, nT);
+}
+
+bool
+CTupleSpace::Init(const std::vector<LEVEL_T>& rgMinLevel, 
+                  const std::vector<LEVEL_T>& rgNumLevels, WORD nT)
+{
+    bool     bResult     = false;
+    FACTOR_T nNumFactors = static_cast<FACTOR_T>(rgNumLevels.size());
+
+    if ((nT > 0) && (nT <= MAX_T_WAY) && (nNumFactors >= nT) && 
+        (rgMinLevel.size() == rgNumLevels.size()))
+    {
+        m_nT          = nT;
+        m_nNumFactors = nNumFactors;
+        m_rgMinLevel  = rgMinLevel;
+        m_rgNumLevels = rgNumLevels;
+
+        m_nNumCombinations = N_Choose_T(m_nNumFactors, m_nT);
+
+        // binomial coefficients used for O(t) ranking of column combinations
+        m_rgBinomial.resize(static_cast<size_t>(m_nNumFactors) * (m_nT + 1));
+        for (FACTOR_T n = 0; n < m_nNumFactors; n++)
+        {
+            for (WORD j = 0; j <= m_nT; j++)
+                m_rgBinomial[n * (m_nT + 1) + j] = N_Choose_T(n, j);
+        }
+
+        bResult = true;
+    }
+
+    return bResult;
+}
+
+size_t
+CTupleSpace::GetRank(const FACTOR_T* rgColumns) const noexcept
+{
+    // the lexicographic rank is the complement of the co-lexicographic rank 
+    // of the complemented combination
+    size_t nColex = 0;
+
+    for (WORD i = 0; i < m_nT; i++)
+        nColex += m_rgBinomial[(m_nNumFactors - 1 - rgColumns[i]) * (m_nT + 1) + (m_nT - i)];
+
+    return m_nNumCombinations - 1 - nColex;
+}
+
+size_t
+CTupleSpace::GetBlockSize(const FACTOR_T* rgColumns) const noexcept
+{
+    size_t nResult = 1;
+
+    for (WORD i = 0; i < m_nT; i++)
+        nResult *= m_rgNumLevels[rgColumns[i]];
+
+    return nResult;
+}
+
+bool
+CTupleSpace::GetTupleIndex(const FACTOR_T* rgColumns, const CTestCase& TestCase, 
+                           size_t& nIndex) const noexcept
+{
+    nIndex = 0;
+
+    for (WORD i = 0; i < m_nT; i++)
+    {
+        FACTOR_T nCurFactor = rgColumns[i];
+        LEVEL_T  nLevel     = TestCase[nCurFactor];
+
+        if (IsValidLevel(nLevel) == false)
+            return false;
+
+        nIndex = nIndex * m_rgNumLevels[nCurFactor] + (nLevel - m_rgMinLevel[nCurFactor]);
+    }
+    return true;
+}
+
+size_t
+CTupleSpace::GetTupleIndex(const FACTOR_T* rgColumns, const LEVEL_T* rgLevels) const noexcept
+{
+    size_t nIndex = 0;
+
+    for (WORD i = 0; i < m_nT; i++)
+        nIndex = nIndex * m_rgNumLevels[rgColumns[i]] + (rgLevels[i] - m_rgMinLevel[rgColumns[i]]);
+
+    return nIndex;
+}
+
+void
+CTupleSpace::GetTupleLevels(const FACTOR_T* rgColumns, size_t nIndex, LEVEL_T* rgLevels) const noexcept
+{
+    for (int i = m_nT - 1; i >= 0; i--)
+    {
+        LEVEL_T nNumLevels = m_rgNumLevels[rgColumns[i]];
+
+        rgLevels[i] = static_cast<LEVEL_T>(m_rgMinLevel[rgColumns[i]] + nIndex % nNumLevels);
+        nIndex     /= nNumLevels;
+    }
+}
@@ -0,0 +1,229 @@
+/**
+ *  @file       TupleSpace.h
+ *  @brief      CTupleSpace class interface
+ *
+ *  Provides type definitions for: CTupleSpace
+ *
+ *  @author     Mark L. Short
+ *  @date       October 18, 2026
+ */
+#pragma once
+
+#if !defined(__TUPLE_SPACE_H__)
+#define __TUPLE_SPACE_H__
+
+#ifndef __COMMON_DEF_H__
+    #include "CommonDef.h"
+#endif
+
+#ifndef _VECTOR_
+    #include <vector>
+#endif
+
+#ifndef __MATH_UTILITY_H__
+    #include "MathUtility.h"
+#endif
+
+/// highest interaction strength supported by the tuple structures
+constexpr const WORD MAX_T_WAY = 6;
+
+// forward declarations
+class CComponentSystem;
+class CTestCase;
+
+/**
+  @brief  Enumerates the t-way variable-value configurations of a system
+
+  Column combinations are identified by their lexicographic rank, matching the
+  order in which NextCombination visits them.  Within a column combination, a 
+  tuple is identified by the mixed radix value of its local (zero based) 
+  levels, the last column being the least significant.
+
+  CTupleSpace provides this indexing scheme to the dense tuple structures
+  built on top of it.
+*/
+class CTupleSpace
+{
+protected:
+    WORD                  m_nT;               ///< interaction strength
+    FACTOR_T              m_nNumFactors;      ///< number of configured system factors
+    size_t                m_nNumCombinations; ///< number of t-way column combinations
+    std::vector<LEVEL_T>  m_rgMinLevel;       ///< minimum level, indexed by factor
+    std::vector<LEVEL_T>  m_rgNumLevels;      ///< number of levels, indexed by factor
+    std::vector<size_t>   m_rgBinomial;       ///< C(n, j) for n < m_nNumFactors, j <= m_nT
+
+public:
+    /// Default Constructor
+    CTupleSpace() noexcept
+        : m_nT(0),
+          m_nNumFactors(0),
+          m_nNumCombinations(0),
+          m_rgMinLevel(),
+          m_rgNumLevels(),
+          m_rgBinomial()
+    { };
+
+    /// Destructor
+    ~CTupleSpace() = default;
+
+/**
+  @brief  class initializer
+
+  @param [in] system         target CComponentSystem
+  @param [in] nT             the T-way value, [1..MAX_T_WAY]
+
+  @retval true               on success
+  @retval false              on error or invalid parameter values
+*/
+    bool   Init(const CComponentSystem& system, WORD nT);
+
+/**
+  @brief  class initializer, from explicit level ranges
+
+  @param [in] rgMinLevel     minimum level, indexed by factor
+  @param [in] rgNumLevels    number of levels, indexed by factor
+  @param [in] nT             the T-way value, [1..MAX_T_WAY]
+
+  @retval true               on success
+  @retval false              on error or invalid parameter values
+*/
+    bool   Init(const std::vector<LEVEL_T>& rgMinLevel, 
+                const std::vector<LEVEL_T>& rgNumLevels, WORD nT);
+
+/**
+  @brief  Returns the lexicographic rank of a column combination
+
+  @param [in] rgColumns      sorted column combination of get_T() factors
+
+  @retval size_t             containing the zero based rank
+*/
+    size_t GetRank(const FACTOR_T* rgColumns) const noexcept;
+
+/**
+  @brief  Returns the number of tuples contained in a column combination
+
+  @param [in] rgColumns      the column combination
+
+  @retval size_t             containing the product of the level counts
+*/
+    size_t GetBlockSize(const FACTOR_T* rgColumns) const noexcept;
+
+/**
+  @brief  Calculates the index of a test case tuple within its column 
+          combination
+
+  @param [in] rgColumns      the column combination
+  @param [in] TestCase       target CTestCase object
+  @param [out] nIndex        the tuple's index
+
+  @retval true               on success
+  @retval false              if any of the columns has no valid level assigned
+*/
+    bool   GetTupleIndex(const FACTOR_T* rgColumns, const CTestCase& TestCase, 
+                         size_t& nIndex) const noexcept;
+
+/**
+  @brief  Calculates the index of a tuple within its column combination
+
+  @param [in] rgColumns      the column combination
+  @param [in] rgLevels       the tuple's level for each of the columns
+
+  @retval size_t             containing the tuple's index
+*/
+    size_t GetTupleIndex(const FACTOR_T* rgColumns, const LEVEL_T* rgLevels) const noexcept;
+
+/**
+  @brief  Converts an index within a column combination back into tuple levels
+
+  @param [in]  rgColumns     the column combination
+  @param [in]  nIndex        the tuple's index
+  @param [out] rgLevels      the tuple's level for each of the columns
+*/
+    void   GetTupleLevels(const FACTOR_T* rgColumns, size_t nIndex, LEVEL_T* rgLevels) const noexcept;
+
+/**
+  @brief  Initializes a column combination to { 0, 1, ... nT - 1 }
+
+  @param [out] rgColumns     the column combination
+  @param [in]  nT            number of columns in the combination
+*/
+    static void ResetColumns(FACTOR_T* rgColumns, WORD nT) noexcept
+    {
+        for (WORD i = 0; i < nT; i++)
+            rgColumns[i] = i;
+    };
+
+/**
+  @brief  Invokes a function for every column combination containing a factor
+
+  @param [in] nFactor        the common factor
+  @param [in] fn             callable, invoked with the sorted column 
+                             combination as a const FACTOR_T*
+*/
+    template <typename FN>
+    void   ForEachCombination(FACTOR_T nFactor, FN fn) const;
+
+// Primitive data accessors
+/**
+  @brief  Returns the number of t-way column combinations
+
+  @retval size_t             containing the number of column combinations
+*/
+    inline size_t   get_NumCombinations(void) const noexcept
+    { return m_nNumCombinations; };
+
+/**
+  @brief  Returns the configured interaction strength
+
+  @retval WORD               containing the T-way value
+*/
+    inline WORD     get_T(void) const noexcept
+    { return m_nT; };
+
+/**
+  @brief  Returns the number of factors the tuple space was built for
+
+  @retval FACTOR_T           containing the number of factors
+*/
+    inline FACTOR_T get_NumFactors(void) const noexcept
+    { return m_nNumFactors; };
+};
+
+template <typename FN>
+void
+CTupleSpace::ForEachCombination(FACTOR_T nFactor, FN fn) const
+{
+    WORD     nOthers = m_nT - 1;
+
+    FACTOR_T rgOthers [MAX_T_WAY];
+    FACTOR_T rgColumns[MAX_T_WAY];
+
+    // visit every combination of the remaining factors, drawn from the 
+    // [0 .. m_nNumFactors - 2] sequence with nFactor removed from it
+    ResetColumns(rgOthers, nOthers);
+
+    do
+    {
+        WORD j     = 0;
+        bool bDone = false;
+
+        for (WORD i = 0; i < nOthers; i++)
+        {
+            FACTOR_T nCurFactor = (rgOthers[i] < nFactor) ? rgOthers[i] : rgOthers[i] + 1;
+
+            if (!bDone && (nCurFactor > nFactor))
+            {
+                rgColumns[j++] = nFactor;
+                bDone          = true;
+            }
+            rgColumns[j++] = nCurFactor;
+        }
+        if (!bDone)
+            rgColumns[j] = nFactor;
+
+        fn(static_cast<const FACTOR_T*>(rgColumns));
+
+    } while ((nOthers > 0) && NextCombination(rgOthers, nOthers, m_nNumFactors - 1));
+}
+
+#endif
@@ -0,0 +1,165 @@
+/**
+ *  @file       WorkPool.cpp
+ *  @brief      CWorkPool class implementation
+ *  @author     Mark L. Short
+ *  @date       October 18, 2026
+ */
+
+#include "stdafx.h"
+
+#include "ParallelUtility.h"
+
+#include "WorkPool.h"
+
+/// pool the current thread works for, nullptr outside of a worker
+static thread_local CWorkPool* g_pCurPool  = nullptr;
+/// index of the current worker's own deque
+static thread_local size_t     g_nCurQueue = 0;
+
+bool
+CWorkPool::Start(unsigned int nNumThreads)
+{
+    if (m_rgThreads.empty() == false)
+        return false;
+
+    if (nNumThreads == 0)
+        nNumThreads = GetNumWorkerThreads( );
+
+    m_bStop = false;
+
+    m_rgQueues.clear();
+    for (unsigned int i = 0; i < nNumThreads; i++)
+        m_rgQueues.emplace_back(new WORK_QUEUE);
+
+    for (unsigned int i = 0; i < nNumThreads; i++)
+        m_rgThreads.emplace_back(&CWorkPool::RunWorker, this, static_cast<size_t>(i));
+
+    return true;
+}
+
+void
+CWorkPool::Submit(WORK_ITEM fnItem)
+{
+    // with no workers to hand it to, the caller does the work itself
+    if (m_rgQueues.empty())
+    {
+        fnItem();
+        return;
+    }
+
+    size_t nQueue = (g_pCurPool == this) ? g_nCurQueue
+                                         : (m_nNextQueue++ % m_rgQueues.size());
+
+    m_nPending++;
+
+    {
+        std::lock_guard<std::mutex> lock(m_rgQueues[nQueue]->mtx);
+
+        m_rgQueues[nQueue]->dqItems.push_back(std::move(fnItem));
+        m_nQueued++;
+    }
+
+    // taking the lock orders the submission with a worker about to sleep
+    {
+        std::lock_guard<std::mutex> lock(m_mtxIdle);
+    }
+    m_cvWork.notify_one();
+}
+
+void
+CWorkPool::Wait(void)
+{
+    std::unique_lock<std::mutex> lock(m_mtxIdle);
+
+    m_cvIdle.wait(lock, [this] { return m_nPending == 0; });
+}
+
+void
+CWorkPool::Stop(void)
+{
+    if (m_rgThreads.empty())
+        return;
+
+    Wait( );
+
+    {
+        std::lock_guard<std::mutex> lock(m_mtxIdle);
+
+        m_bStop = true;
+        m_cvWork.notify_all();
+    }
+
+    for (auto& it : m_rgThreads)
+        it.join( );
+
+    m_rgThreads.clear();
+    m_rgQueues.clear();
+}
+
+void
+CWorkPool::RunWorker(size_t nQueue)
+{
+    g_pCurPool  = this;
+    g_nCurQueue = nQueue;
+
+    for (;;)
+    {
+        WORK_ITEM fnItem;
+
+        if (TakeWorkItem(nQueue, fnItem))
+        {
+            fnItem();
+            fnItem = nullptr;
+
+            if (--m_nPending == 0)
+            {
+                std::lock_guard<std::mutex> lock(m_mtxIdle);
+                m_cvIdle.notify_all();
+            }
+            continue;
+        }
+
+        std::unique_lock<std::mutex> lock(m_mtxIdle);
+
+        m_cvWork.wait(lock, [this] { return m_bStop || (m_nQueued > 0); });
+
+        if (m_bStop && (m_nQueued == 0))
+            break;
+    }
+
+    g_pCurPool = nullptr;
+}
+
+bool
+CWorkPool::TakeWorkItem(size_t nQueue, WORK_ITEM& fnItem)
+{
+    size_t nNumQueues = m_rgQueues.size( );
+
+    // the newest of its own work items first, then the oldest of another's
+    for (size_t i = 0; i < nNumQueues; i++)
+    {
+        WORK_QUEUE& queue = *m_rgQueues[(nQueue + i) % nNumQueues];
+
+        std::lock_guard<std::mutex> lock(queue.mtx);
+
+        if (queue.dqItems.empty())
+            continue;
+
+        if (i == 0)
+        {
+            fnItem = std::move(queue.dqItems.back());
+            queue.dqItems.pop_back();
+        }
+        else
+        {
+            fnItem = std::move(queue.dqItems.front());
+            queue.dqItems.pop_front();
+            m_nSteals++;
+        }
+
+        m_nQueued--;
+        return true;
+    }
+
+    return false;
+}
@@ -0,0 +1,177 @@
+/**
+ *  @file       WorkPool.h
+ *  @brief      CWorkPool class interface
+ *
+ *  Provides type definitions for: CWorkPool
+ *
+ *  @author     Mark L. Short
+ *  @date       October 18, 2026
+ */
+#pragma once
+
+#if !defined(__WORK_POOL_H__)
+#define __WORK_POOL_H__
+
+#ifndef _ATOMIC_
+    #include <atomic>
+#endif
+
+#ifndef _CONDITION_VARIABLE_
+    #include <condition_variable>
+#endif
+
+#ifndef _DEQUE_
+    #include <deque>
+#endif
+
+#ifndef _FUNCTIONAL_
+    #include <functional>
+#endif
+
+#ifndef _MEMORY_
+    #include <memory>
+#endif
+
+#ifndef _MUTEX_
+    #include <mutex>
+#endif
+
+#ifndef _THREAD_
+    #include <thread>
+#endif
+
+#ifndef _VECTOR_
+    #include <vector>
+#endif
+
+/// signature of a work item, which may itself submit further work items
+typedef std::function<void(void)> WORK_ITEM;
+
+/**
+  @brief  A fixed set of worker threads sharing work items by work stealing
+
+  Each worker owns a deque of work items.  A work item submitted from a
+  worker goes to the back of that worker's deque, and the worker takes its
+  own work from the back, so the pieces a work item splits itself into run
+  close to it, while they are still warm in cache.  A worker with nothing
+  left steals from the front of another worker's deque, taking the oldest
+  and so typically the largest piece of work there.  Work items submitted
+  from outside the pool are dealt round robin across the deques.
+
+  The result is that a mix of work items of very different costs keeps
+  every worker busy until the last of them: the workers done with the
+  cheap items steal the pieces of the expensive ones.
+*/
+class CWorkPool
+{
+/**
+  @brief  The deque of work items owned by a worker
+*/
+    struct WORK_QUEUE
+    {
+        std::mutex             mtx;         ///< guards dqItems
+        std::deque<WORK_ITEM>  dqItems;     ///< owner works at the back, thieves at the front
+    };
+
+    std::vector<std::unique_ptr<WORK_QUEUE>>  m_rgQueues;   ///< deque of each worker
+    std::vector<std::thread>   m_rgThreads;     ///< the workers
+    std::mutex                 m_mtxIdle;       ///< guards sleeping and waiting on the two below
+    std::condition_variable    m_cvWork;        ///< signalled as work items are submitted
+    std::condition_variable    m_cvIdle;        ///< signalled as the last pending work item ends
+    std::atomic<size_t>        m_nQueued;       ///< work items in the deques
+    std::atomic<size_t>        m_nPending;      ///< work items submitted, not yet ended
+    std::atomic<size_t>        m_nNextQueue;    ///< deque for the next work item from outside
+    std::atomic<size_t>        m_nSteals;       ///< work items taken from another worker
+    bool                       m_bStop;         ///< set once the workers are to exit
+
+public:
+    /// Default Constructor
+    CWorkPool()
+        : m_rgQueues(),
+          m_rgThreads(),
+          m_mtxIdle(),
+          m_cvWork(),
+          m_cvIdle(),
+          m_nQueued(0),
+          m_nPending(0),
+          m_nNextQueue(0),
+          m_nSteals(0),
+          m_bStop(false)
+    { };
+
+    /// Destructor
+    ~CWorkPool()
+    { Stop(); };
+
+    CWorkPool(const CWorkPool&)            = delete;
+    CWorkPool& operator=(const CWorkPool&) = delete;
+
+/**
+  @brief  Starts the workers
+
+  @param [in] nNumThreads    number of workers, or 0 for one per hardware thread
+
+  @retval true               on success
+  @retval false              if the pool is already started
+*/
+    bool   Start(unsigned int nNumThreads = 0);
+
+/**
+  @brief  Submits a work item
+
+  May be called from any thread, including from within a work item.
+
+  @param [in] fnItem         the work item
+*/
+    void   Submit(WORK_ITEM fnItem);
+
+/**
+  @brief  Waits for every work item submitted, and every work item those
+          submitted in turn, to end
+
+  Not to be called from within a work item.
+*/
+    void   Wait(void);
+
+/**
+  @brief  Waits for the pending work items, then stops the workers
+*/
+    void   Stop(void);
+
+/**
+  @brief  Returns the number of workers
+
+  @retval size_t             containing the number of workers, 0 if not started
+*/
+    inline size_t get_NumThreads(void) const noexcept
+    { return m_rgThreads.size(); };
+
+/**
+  @brief  Returns the number of work items taken from another worker's deque
+
+  @retval size_t             containing the number of steals
+*/
+    inline size_t get_NumSteals(void) const noexcept
+    { return m_nSteals.load(); };
+
+private:
+/**
+  @brief  Services the deques until the pool is stopped
+
+  @param [in] nQueue         index of the worker's own deque
+*/
+    void   RunWorker(size_t nQueue);
+
+/**
+  @brief  Takes the next work item for a worker, its own or a stolen one
+
+  @param [in]  nQueue        index of the worker's own deque
+  @param [out] fnItem        the work item
+
+  @retval true               on success
+  @retval false              if every deque is empty
+*/
+    bool   TakeWorkItem(size_t nQueue, WORK_ITEM& fnItem);
+};
+
+#endif